@@ -0,0 +1,346 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+/*! \file AsmCache.h
+ * \brief persistent cache of assembled binaries and cache of included files
+ */
+
+#ifndef __CLRX_ASMCACHE_H__
+#define __CLRX_ASMCACHE_H__
+
+#include <CLRX/Config.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <mutex>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/Containers.h>
+#include <CLRX/utils/CString.h>
+#include <CLRX/utils/GPUId.h>
+#include <CLRX/amdasm/Commons.h>
+#include <CLRX/amdasm/AsmSource.h>
+
+/// main namespace
+namespace CLRX
+{
+
+/// 128-bit hash of content (not cryptographic)
+struct AsmCacheHash
+{
+    uint64_t lo;    ///< low part
+    uint64_t hi;    ///< high part
+
+    /// equal operator
+    bool operator==(const AsmCacheHash& h) const
+    { return lo==h.lo && hi==h.hi; }
+    /// not equal operator
+    bool operator!=(const AsmCacheHash& h) const
+    { return lo!=h.lo || hi!=h.hi; }
+
+    /// convert to hexadecimal string
+    std::string toString() const;
+};
+
+/// incremental hasher for cache keys and file contents
+class AsmCacheHasher
+{
+private:
+    uint64_t h1, h2;
+    uint64_t length;
+    cxbyte tail[8];
+    cxuint tailSize;
+
+    void processWord(uint64_t word);
+public:
+    /// constructor
+    AsmCacheHasher();
+
+    /// update hash by data
+    void update(size_t size, const void* data);
+    /// update hash by string (with its length)
+    void update(const CString& str);
+    /// update hash by integer value
+    void updateValue(uint64_t value);
+
+    /// get final hash
+    AsmCacheHash finish() const;
+
+    /// compute hash of data
+    static AsmCacheHash hash(size_t size, const void* data);
+};
+
+/// dependency of cached binary (file read or probed by assembler)
+struct AsmCacheDependency
+{
+    CString path;   ///< path to file
+    bool exists;    ///< true if file has been read, false if probe failed
+    AsmCacheHash hash;  ///< hash of file content (if exists)
+
+    /// returns true if file is not changed
+    bool isUpToDate() const;
+};
+
+/// entry of assembler cache
+struct AsmCacheEntry
+{
+    std::vector<AsmCacheDependency> dependencies; ///< files used by assembler
+    std::string messages;   ///< warnings printed while assembling
+    std::string printed;    ///< output of .print pseudo-ops
+    Array<cxbyte> binary;   ///< output binary
+};
+
+/// persistent on-disk cache of assembled binaries
+/** entries are addressed by key (hash of assembler input and options) and
+ * they hold list of dependencies that must be up to date. Cache is shrunk to
+ * maximal size by removing least recently used entries. Cache can be shared by
+ * many assemblers and processes */
+class AsmCache: public NonCopyableAndNonMovable
+{
+private:
+    std::string directory;
+    uint64_t maxSize;
+
+    std::string getEntryPath(const AsmCacheHash& key) const;
+    bool readEntry(const AsmCacheHash& key, Array<cxbyte>& data) const;
+    void touchEntry(const AsmCacheHash& key) const;
+public:
+    /// constructor
+    /**
+     * \param directory directory of cache (will be created if it doesn't exist)
+     * \param maxSize maximal size of all entries in bytes
+     */
+    explicit AsmCache(const CString& directory, uint64_t maxSize = 64ULL<<20);
+
+    /// get directory
+    const std::string& getDirectory() const
+    { return directory; }
+    /// get maximal size
+    uint64_t getMaxSize() const
+    { return maxSize; }
+
+    /// load entry, returns true if entry found and all dependencies are up to date
+    bool load(const AsmCacheHash& key, AsmCacheEntry& entry) const;
+    /// store entry and remove least recently used entries if cache is too big
+    void store(const AsmCacheHash& key, const AsmCacheEntry& entry) const;
+    /// load raw data of entry, returns true if entry found
+    bool loadData(const AsmCacheHash& key, Array<cxbyte>& data) const;
+    /// store raw data of entry and remove least recently used entries
+    void storeData(const AsmCacheHash& key, const std::string& data) const;
+    /// remove least recently used entries until cache size fits to maximal size
+    void evict() const;
+};
+
+/// state of symbol read or changed by included file
+struct AsmIncludeSymbolState
+{
+    bool exists;    ///< symbol exists
+    bool hasValue;  ///< symbol has value
+    bool complex;   ///< symbol has expression, base expression or register range
+    bool pending;   ///< symbol is used by unevaluated expressions
+    bool onceDefined;   ///< symbol can be defined only once
+    cxbyte info;    ///< ELF symbol info
+    cxbyte other;   ///< ELF symbol other
+    cxuint sectionId;   ///< section id
+    uint64_t value; ///< value
+    uint64_t size;  ///< size
+    
+    /// equal operator
+    bool operator==(const AsmIncludeSymbolState& s) const
+    {
+        return exists==s.exists && hasValue==s.hasValue && complex==s.complex &&
+            pending==s.pending && onceDefined==s.onceDefined && info==s.info &&
+            other==s.other && sectionId==s.sectionId && value==s.value && size==s.size;
+    }
+    /// not equal operator
+    bool operator!=(const AsmIncludeSymbolState& s) const
+    { return !(*this == s); }
+};
+
+/// assembler settings that affect processing of included file
+struct AsmIncludeSettings
+{
+    BinaryFormat format;    ///< binary format
+    GPUDeviceType deviceType;   ///< GPU device type
+    bool _64bit;    ///< 64-bit mode
+    Flags flags;    ///< assembler flags
+    bool alternateMacro;    ///< alternate macro syntax
+    bool buggyFPLit;    ///< buggy floating point literals
+    bool macroCase;     ///< case-insensitive macro names
+    bool oldModParam;   ///< old modifier parametrization
+    
+    /// equal operator
+    bool operator==(const AsmIncludeSettings& s) const
+    {
+        return format==s.format && deviceType==s.deviceType && _64bit==s._64bit &&
+            flags==s.flags && alternateMacro==s.alternateMacro &&
+            buggyFPLit==s.buggyFPLit && macroCase==s.macroCase &&
+            oldModParam==s.oldModParam;
+    }
+};
+
+/// snapshot of changes made by included file
+/** snapshot holds incoming state read by included file (symbols, macros,
+ * settings, nested files) and changes of symbols, macros and settings. If incoming
+ * state is same, then snapshot can be replayed instead of assembling file */
+struct AsmIncludeSnapshot
+{
+    /// symbol with its state
+    typedef std::pair<CString, AsmIncludeSymbolState> Symbol;
+    /// macro (null if not defined)
+    typedef std::pair<CString, RefPtr<const AsmMacro> > Macro;
+    
+    AsmCacheHash hash;  ///< hash of content of included file
+    AsmIncludeSettings settings;    ///< incoming settings
+    std::vector<CString> includeDirs;   ///< include directories
+    bool withCounters;  ///< if macro counters used by included file
+    uint64_t macroCount;    ///< incoming macro counter
+    uint64_t localCount;    ///< incoming macro's local counter
+    std::vector<AsmCacheDependency> dependencies; ///< nested included files
+    std::vector<Symbol> symbolReads;    ///< incoming state of used symbols
+    std::vector<Macro> macroReads;  ///< origins of used macros
+    
+    RefPtr<const AsmSource> source;     ///< source of included file while recording
+    AsmIncludeSettings newSettings; ///< settings after inclusion
+    uint64_t newMacroCount; ///< macro counter after inclusion
+    uint64_t newLocalCount; ///< macro's local counter after inclusion
+    std::vector<Symbol> symbols;    ///< changed symbols
+    std::vector<Macro> macros;  ///< defined macros
+};
+
+/// cache of snapshots of included files
+/** cache can be shared by many assemblers that run sequentially (not thread-safe).
+ * Snapshots are addressed by path and content of included file. Content hashes are
+ * computed again only if timestamp or size of file has been changed.
+ * If persistent cache is given, then snapshots are also stored in its directory
+ * and they are loaded by other processes. Snapshots that use macros defined
+ * outside included file are kept only in memory */
+class AsmIncludeCache: public NonCopyableAndNonMovable
+{
+private:
+    struct FileEntry
+    {
+        uint64_t timestamp;
+        uint64_t size;
+        AsmCacheHash hash;
+        bool persistentLoaded;  // if snapshots has been loaded from persistent cache
+        std::vector<AsmIncludeSnapshot> snapshots;
+    };
+    std::unordered_map<std::string, FileEntry> files;
+    size_t maxSnapshots;
+    const AsmCache* persistentCache;
+    size_t hitsNum;
+    size_t storesNum;
+    
+    AsmCacheHash getPersistentKey(const std::string& path, const FileEntry& entry) const;
+    void loadPersistentSnapshots(const std::string& path, FileEntry& entry) const;
+    void storePersistentSnapshots(const std::string& path, const FileEntry& entry) const;
+public:
+    /// constructor
+    /**
+     * \param maxSnapshots maximal number of snapshots for single file
+     * \param persistentCache cache that stores snapshots on disk (can be null)
+     */
+    explicit AsmIncludeCache(size_t maxSnapshots = 8,
+                const AsmCache* persistentCache = nullptr);
+    
+    /// get hash of file content, returns false if file can not be read
+    bool getFileHash(const std::string& path, AsmCacheHash& hash);
+    /// returns true if file is not changed
+    bool isUpToDate(const AsmCacheDependency& dep);
+    
+    /// get persistent cache
+    const AsmCache* getPersistentCache() const
+    { return persistentCache; }
+    
+    /// get snapshots of file (can be null), loads them from persistent cache
+    const std::vector<AsmIncludeSnapshot>* getSnapshots(const std::string& path);
+    /// add snapshot of file
+    void addSnapshot(const std::string& path, AsmIncludeSnapshot&& snapshot);
+    /// remove all snapshots
+    void clear();
+    
+    /// increase number of replayed snapshots
+    void addHit()
+    { hitsNum++; }
+    /// get number of replayed snapshots
+    size_t getHitsNum() const
+    { return hitsNum; }
+    /// get number of stored snapshots
+    size_t getStoresNum() const
+    { return storesNum; }
+};
+
+/// process-wide cache of listings of include directories
+/** every include directory is listed once and files are searched by hash lookup
+ * in listing instead of probing filesystem. Listing is read again if modification
+ * time of directory has been changed. Cache is thread-safe */
+class AsmIncludeDirCache: public NonCopyableAndNonMovable
+{
+private:
+    struct DirEntry
+    {
+        bool listed;    // false if directory can not be listed (must be probed)
+        bool racy;      // directory modified while listing (listing can be obsolete)
+        uint64_t timestamp;
+        std::unordered_set<std::string> names;
+    };
+    std::mutex mutex;
+    std::unordered_map<std::string, DirEntry> dirs;
+    size_t lookupsNum;
+    size_t listingsNum;
+    
+    static void listDir(const std::string& dirPath, DirEntry& entry);
+public:
+    /// constructor
+    AsmIncludeDirCache();
+    
+    /// returns false if directory doesn't contain file (file doesn't need to be probed)
+    /**
+     * \param dirPath path to directory (system path)
+     * \param filename relative path to file in directory (system path)
+     * \param revalidate check whether directory has been changed since listing
+     * \param listed set to true if directory has been listed by this call
+     */
+    bool mayContain(const std::string& dirPath, const std::string& filename,
+                bool revalidate, bool& listed);
+    /// remove all listings
+    void clear();
+    
+    /// get number of lookups
+    size_t getLookupsNum();
+    /// get number of listings of directories
+    size_t getListingsNum();
+    
+    /// get cache shared by all assemblers in process
+    static AsmIncludeDirCache& getProcessCache();
+};
+
+/// statistics of searching of included files
+struct AsmIncludeSearchStats
+{
+    size_t probesNum;   ///< number of filesystem probes of files
+    size_t skippedProbesNum;    ///< number of probes avoided by listings of directories
+    size_t listingsNum; ///< number of listings of directories
+};
+
+};
+
+#endif
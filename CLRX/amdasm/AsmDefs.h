@@ -29,6 +29,8 @@
 #include <utility>
 #include <list>
 #include <unordered_map>
+#include <memory>
+#include <cstring>
 #include <CLRX/utils/Utilities.h>
 #include <CLRX/amdasm/Commons.h>
 #include <CLRX/amdasm/AsmSource.h>
@@ -169,6 +171,7 @@ struct AsmSymbol
     cxuint regRange:1;          ///< if symbol is register range
     cxuint detached:1;
     cxuint withUnevalExpr:1;
+    cxuint pending:1;           ///< if symbol is in pending symbols of its scope
     uint64_t value;         ///< value of symbol
     uint64_t size;          ///< size of symbol
     union {
@@ -183,21 +186,21 @@ struct AsmSymbol
     explicit AsmSymbol(bool _onceDefined = false) :
             refCount(1), sectionId(ASMSECT_ABS), info(0), other(0), hasValue(false),
             onceDefined(_onceDefined), resolving(false), base(false), snapshot(false),
-            regRange(false), detached(false), withUnevalExpr(false),
+            regRange(false), detached(false), withUnevalExpr(false), pending(false),
             value(0), size(0), expression(nullptr)
     { }
     /// constructor with expression
     explicit AsmSymbol(AsmExpression* expr, bool _onceDefined = false, bool _base = false) :
             refCount(1), sectionId(ASMSECT_ABS), info(0), other(0), hasValue(false),
-            onceDefined(_onceDefined), resolving(false), base(_base),
-            snapshot(false), regRange(false), detached(false), withUnevalExpr(false),
+            onceDefined(_onceDefined), resolving(false), base(_base), snapshot(false),
+            regRange(false), detached(false), withUnevalExpr(false), pending(false),
             value(0), size(0), expression(expr)
     { }
     /// constructor with value and section id
     explicit AsmSymbol(cxuint _sectionId, uint64_t _value, bool _onceDefined = false) :
             refCount(1), sectionId(_sectionId), info(0), other(0), hasValue(true),
             onceDefined(_onceDefined), resolving(false), base(false), snapshot(false),
-            regRange(false), detached(false), withUnevalExpr(false),
+            regRange(false), detached(false), withUnevalExpr(false), pending(false),
             value(_value), size(0), expression(nullptr)
     { }
     /// destructor
@@ -308,9 +311,16 @@ private:
     size_t symOccursNum;
     bool relativeSymOccurs;
     bool baseExpr;
-    Array<AsmExprOp> ops;
-    std::unique_ptr<LineCol[]> messagePositions;    ///< for every potential message
-    std::unique_ptr<AsmExprArg[]> args;
+    bool detachedSymOccurs; ///< true if some symbol has been freed before resolving
+    size_t opsNum;
+    size_t codeSize;    ///< size of bytecode (zero if not compiled)
+    cxuint maxStackDepth;   ///< maximal stack depth while evaluating
+    /// one storage for arguments, message positions, operators and bytecode
+    std::unique_ptr<uint64_t[]> storage;
+    AsmExprArg* args;
+    LineCol* messagePositions;    ///< for every potential message
+    AsmExprOp* ops;
+    cxbyte* code;   ///< bytecode (operators with fused arguments)
     
     AsmSourcePos getSourcePos(size_t msgPosIndex) const
     {
@@ -325,6 +335,12 @@ private:
                AsmSymbolEntry*& outSymEntry, const AsmSourcePos* topParentSourcePos);
     
     AsmExpression();
+    // allocate storage for operators, message positions and arguments
+    void allocate(size_t opsNum, size_t opPosNum, size_t argsNum);
+    // compile operators to bytecode
+    void compile();
+    // evaluate bytecode, returns false if general evaluation is needed
+    bool tryEvaluateCode(Assembler& assembler, uint64_t& value, cxuint& sectionId) const;
     void setParams(size_t symOccursNum, bool relativeSymOccurs,
             size_t _opsNum, const AsmExprOp* ops, size_t opPosNum, const LineCol* opPos,
             size_t argsNum, const AsmExprArg* args, bool baseExpr = false);
@@ -342,7 +358,7 @@ public:
     
     /// return true if expression is empty
     bool isEmpty() const
-    { return ops.empty(); }
+    { return opsNum==0; }
     
     /// helper to create symbol snapshot. Creates initial expression for symbol snapshot
     AsmExpression* createForSnapshot(const AsmSourcePos* exprSourcePos) const;
@@ -374,7 +390,7 @@ public:
      */
     AsmTryStatus tryEvaluate(Assembler& assembler, uint64_t& value, cxuint& sectionId,
                     bool withSectionDiffs = false) const
-    { return tryEvaluate(assembler, 0, ops.size(), value, sectionId, withSectionDiffs); }
+    { return tryEvaluate(assembler, 0, opsNum, value, sectionId, withSectionDiffs); }
     
     /// try to evaluate expression
     /**
@@ -384,7 +400,7 @@ public:
      * \return true if evaluated
      */
     bool evaluate(Assembler& assembler, uint64_t& value, cxuint& sectionId) const
-    { return tryEvaluate(assembler, 0, ops.size(), value, sectionId) !=
+    { return tryEvaluate(assembler, 0, opsNum, value, sectionId) !=
                     AsmTryStatus::FAILED; }
     
     /// try to evaluate expression
@@ -444,6 +460,15 @@ public:
     /// unreference symbol occurrences in expression (used internally)
     bool unrefSymOccursNum()
     { return --symOccursNum!=0; }
+    /// return true if some symbol has been freed before resolving
+    bool hasDetachedSymOccurs() const
+    { return detachedSymOccurs; }
+    /// detach occurrence of symbol freed before resolving (used internally)
+    void detachOccurrence(AsmExprSymbolOccurrence occurrence)
+    {
+        substituteOccurrence(occurrence, 0, ASMSECT_ABS);
+        detachedSymOccurs = true;
+    }
     
     /// substitute occurrence in expression by value
     void substituteOccurrence(AsmExprSymbolOccurrence occurrence, uint64_t value,
@@ -452,11 +477,14 @@ public:
     void replaceOccurrenceSymbol(AsmExprSymbolOccurrence occurrence,
                     AsmSymbolEntry* newSymEntry);
     /// get operators list
-    const Array<AsmExprOp>& getOps() const
+    const AsmExprOp* getOps() const
     { return ops; }
+    /// get number of operators
+    size_t getOpsNum() const
+    { return opsNum; }
     /// get argument list
     const AsmExprArg* getArgs() const
-    { return args.get(); }
+    { return args; }
     /// get source position
     const AsmSourcePos& getSourcePos() const
     { return sourcePos; }
@@ -584,6 +612,10 @@ struct AsmSingleVReg // key for regvar
     /// not equal operator
     bool operator!=(const AsmSingleVReg& r2) const
     { return regVar == r2.regVar && index == r2.index; }
+    /// less operator (order of regvars is unspecified, but it is constant)
+    bool operator<(const AsmSingleVReg& r2) const
+    { return std::less<const AsmRegVar*>()(regVar, r2.regVar) ||
+            (regVar == r2.regVar && index < r2.index); }
 };
 
 /// regvar map
@@ -661,6 +693,175 @@ struct AsmCodeFlowEntry
 /// assembler macro map
 typedef std::unordered_map<CString, RefPtr<const AsmMacro> > AsmMacroMap;
 
+/// identifier of interned name
+typedef uint32_t AsmNameId;
+
+/// assembler's name pool (interns names of symbols, regvars, scopes and macros)
+/**
+ * Names are stored in an arena and every distinct name gets a small identifier.
+ * Hash of name is computed once while interning, next lookups use only identifier.
+ */
+class AsmNamePool: public NonCopyableAndNonMovable
+{
+public:
+    /// no name identifier
+    static const AsmNameId NONE = UINT32_MAX;
+private:
+    struct Entry
+    {
+        const char* name;
+        size_t length;
+        size_t hash;
+    };
+    std::vector<std::unique_ptr<char[]> > chunks;
+    char* chunkPtr;
+    size_t chunkFree;
+    std::vector<Entry> entries;
+    std::vector<AsmNameId> table;   // open addressing table of identifiers
+    
+    static size_t hashName(const char* name, size_t length);
+    size_t findSlot(const char* name, size_t length, size_t hash) const;
+    const char* allocName(const char* name, size_t length);
+    void rehash(size_t newSize);
+public:
+    /// constructor
+    AsmNamePool();
+    
+    /// find name, returns NONE if not found
+    AsmNameId find(const char* name, size_t length) const;
+    /// find name, returns NONE if not found
+    AsmNameId find(const char* name) const
+    { return find(name, ::strlen(name)); }
+    /// intern name (add to pool if not exists) and return its identifier
+    AsmNameId intern(const char* name, size_t length);
+    /// intern name (add to pool if not exists) and return its identifier
+    AsmNameId intern(const char* name)
+    { return intern(name, ::strlen(name)); }
+    
+    /// get name by identifier (null-terminated)
+    const char* getName(AsmNameId id) const
+    { return entries[id].name; }
+    /// get name length by identifier
+    size_t getNameLength(AsmNameId id) const
+    { return entries[id].length; }
+    /// get number of interned names
+    size_t size() const
+    { return entries.size(); }
+};
+
+/// open addressing index of map entries keyed by interned name identifier
+/** used to accelerate lookups in scope's maps. Entries must be stable in memory.
+ * Index holds all entries of its map, so every insertion to map and every erasure
+ * from map must be done also in this index. */
+template<typename T>
+class AsmNameIndex
+{
+private:
+    struct Slot
+    {
+        AsmNameId id;
+        T* entry;
+    };
+    std::vector<Slot> slots;
+    size_t count;
+    
+    static size_t slotOf(AsmNameId id, size_t mask)
+    { return (size_t(id) * 0x9e3779b1U) & mask; }
+    
+    void rehash(size_t newSize)
+    {
+        std::vector<Slot> newSlots(newSize, Slot{ AsmNamePool::NONE, nullptr });
+        const size_t mask = newSize-1;
+        for (const Slot& slot: slots)
+            if (slot.id != AsmNamePool::NONE)
+            {
+                size_t i = slotOf(slot.id, mask);
+                while (newSlots[i].id != AsmNamePool::NONE)
+                    i = (i+1) & mask;
+                newSlots[i] = slot;
+            }
+        slots.swap(newSlots);
+    }
+public:
+    /// constructor
+    AsmNameIndex() : count(0)
+    { }
+    /// copy constructor (does not copy entries, because they point to other map)
+    AsmNameIndex(const AsmNameIndex&) : count(0)
+    { }
+    /// copy assignment (clears index)
+    AsmNameIndex& operator=(const AsmNameIndex&)
+    {
+        clear();
+        return *this;
+    }
+    
+    /// get number of entries
+    size_t size() const
+    { return count; }
+    
+    /// find entry, returns null if not found
+    T* find(AsmNameId id) const
+    {
+        if (count == 0)
+            return nullptr;
+        const size_t mask = slots.size()-1;
+        for (size_t i = slotOf(id, mask); slots[i].id != AsmNamePool::NONE;
+                    i = (i+1) & mask)
+            if (slots[i].id == id)
+                return slots[i].entry;
+        return nullptr;
+    }
+    
+    /// insert entry (replace if already exists)
+    void insert(AsmNameId id, T* entry)
+    {
+        if ((count+1)*2 > slots.size())
+            rehash(slots.empty() ? 16 : slots.size()<<1);
+        const size_t mask = slots.size()-1;
+        size_t i = slotOf(id, mask);
+        for (; slots[i].id != AsmNamePool::NONE; i = (i+1) & mask)
+            if (slots[i].id == id)
+            {
+                slots[i].entry = entry;
+                return;
+            }
+        slots[i] = Slot{ id, entry };
+        count++;
+    }
+    
+    /// erase entry, returns false if not found
+    bool erase(AsmNameId id)
+    {
+        if (count == 0)
+            return false;
+        const size_t mask = slots.size()-1;
+        size_t i = slotOf(id, mask);
+        for (; slots[i].id != id; i = (i+1) & mask)
+            if (slots[i].id == AsmNamePool::NONE)
+                return false;
+        // move back next entries of cluster whose probe sequence passes freed slot
+        for (size_t j = (i+1) & mask; slots[j].id != AsmNamePool::NONE; j = (j+1) & mask)
+        {
+            const size_t k = slotOf(slots[j].id, mask);
+            if ((i <= j) ? (i < k && k <= j) : (i < k || k <= j))
+                continue;
+            slots[i] = slots[j];
+            i = j;
+        }
+        slots[i] = Slot{ AsmNamePool::NONE, nullptr };
+        count--;
+        return true;
+    }
+    
+    /// clear index
+    void clear()
+    {
+        slots.clear();
+        count = 0;
+    }
+};
+
 struct AsmScope;
 
 /// type definition of scope's map
@@ -673,8 +874,15 @@ struct AsmScope
     AsmSymbolMap symbolMap; ///< symbol map
     AsmRegVarMap regVarMap; ///< regvar map
     AsmScopeMap scopeMap;   ///< scope map
+    AsmNameIndex<AsmSymbolEntry> symbolIndex;   ///< index of symbol map
+    AsmNameIndex<AsmRegVarEntry> regVarIndex;   ///< index of regvar map
+    AsmNameIndex<AsmScopeMap::value_type> scopeIndex; ///< index of scope map
     bool temporary; ///< true if temporary
     std::list<AsmScope*> usedScopes;    ///< list of used scope in this scope
+    /// symbols of this scope which can be unresolved (held by expressions or
+    /// defined in unresolvable section), resolved symbols are removed while
+    /// compacting (before list grows and before final resolving)
+    std::vector<AsmSymbolEntry*> pendingSymbols;
     
     /// set of used scopes in this scope
     std::unordered_map<AsmScope*, std::list<AsmScope*>::iterator> usedScopesSet;
@@ -736,8 +944,12 @@ struct AsmSection
     
     /// copy constructor
     AsmSection(const AsmSection& section);
+    /// move constructor
+    AsmSection(AsmSection&& section) noexcept;
     /// copy assignment
     AsmSection& operator=(const AsmSection& section);
+    /// move assignment
+    AsmSection& operator=(AsmSection&& section) noexcept;
     
     /// add code flow entry to this section
     void addCodeFlowEntry(const AsmCodeFlowEntry& entry)
@@ -0,0 +1,115 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+/*! \file AsmMacroLibrary.h
+ * \brief library of pre-parsed macros and absolute symbols
+ */
+
+#ifndef __CLRX_ASMMACROLIBRARY_H__
+#define __CLRX_ASMMACROLIBRARY_H__
+
+#include <CLRX/Config.h>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/CString.h>
+#include <CLRX/amdasm/AsmSource.h>
+
+/// main namespace
+namespace CLRX
+{
+
+class AsmMacroLibNodeReader;
+
+/// library of pre-parsed macros and absolute symbols (.clrxlib file)
+/** library holds compiled macros with their source positions and values of
+ * absolute symbols. File is memory-mapped and only names of macros and symbols
+ * are read while opening. Macro is deserialized when it is loaded first time */
+class AsmMacroLibrary: public NonCopyableAndNonMovable
+{
+public:
+    /// absolute symbol of library
+    struct Symbol
+    {
+        CString name;   ///< symbol name
+        uint64_t value; ///< value
+        bool onceDefined;   ///< symbol can be defined only once
+    };
+    /// macro to write to library
+    typedef std::pair<CString, RefPtr<const AsmMacro> > Macro;
+private:
+    struct MacroEntry
+    {
+        CString name;
+        size_t offset;
+        size_t size;
+    };
+    MemoryMappedFile mappedFile;
+    RefPtr<const AsmSource> parent;
+    LineNo lineNo;
+    ColNo colNo;
+    std::vector<Symbol> symbols;
+    std::vector<MacroEntry> macros;
+    size_t nodesOffset;
+    size_t nodesSize;
+    size_t nodesNum;
+    // sources and macro substitutions used by macros (read with first macro)
+    std::unique_ptr<AsmMacroLibNodeReader> nodeReader;
+    size_t loadedMacrosNum;
+
+    void open(const CString& filename);
+public:
+    /// constructor (library given by command line)
+    explicit AsmMacroLibrary(const CString& filename);
+    /// constructor (library included from source)
+    /**
+     * \param pos place of inclusion (sources of library are nested in this place)
+     * \param filename path to library file
+     */
+    AsmMacroLibrary(const AsmSourcePos& pos, const CString& filename);
+    /// destructor
+    ~AsmMacroLibrary();
+
+    /// get number of symbols
+    size_t getSymbolsNum() const
+    { return symbols.size(); }
+    /// get symbol
+    const Symbol& getSymbol(size_t i) const
+    { return symbols[i]; }
+    /// get number of macros
+    size_t getMacrosNum() const
+    { return macros.size(); }
+    /// get macro name
+    const CString& getMacroName(size_t i) const
+    { return macros[i].name; }
+    /// load macro (deserialize its content), throws Exception if data is corrupted
+    RefPtr<const AsmMacro> loadMacro(size_t i);
+    /// get number of loaded macros
+    size_t getLoadedMacrosNum() const
+    { return loadedMacrosNum; }
+
+    /// write library file (throws Exception if failed)
+    static void write(const CString& filename, const std::vector<Macro>& macros,
+                const std::vector<Symbol>& symbols);
+};
+
+};
+
+#endif
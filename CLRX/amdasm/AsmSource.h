@@ -31,6 +31,7 @@
 #include <vector>
 #include <utility>
 #include <memory>
+#include <unordered_map>
 #include <CLRX/amdasm/Commons.h>
 #include <CLRX/utils/Utilities.h>
 
@@ -162,6 +163,31 @@ struct AsmSourcePos
     void print(std::ostream& os, cxuint indentLevel = 0) const;
 };
 
+/// translator of sources of included file to its other inclusion
+/** used while replaying snapshot of included file. Sources which descend from
+ * old source of included file are recreated with new source of included file */
+class AsmSourceRebaser: public NonCopyableAndNonMovable
+{
+private:
+    RefPtr<const AsmSource> oldSource;
+    RefPtr<const AsmSource> newSource;
+    std::unordered_map<const AsmSource*, RefPtr<const AsmSource> > sourceMap;
+    std::unordered_map<const AsmMacroSubst*, RefPtr<const AsmMacroSubst> > macroSubstMap;
+public:
+    /// constructor
+    /**
+     * \param oldSource source of included file in old inclusion
+     * \param newSource source of included file in new inclusion
+     */
+    AsmSourceRebaser(RefPtr<const AsmSource> oldSource,
+                RefPtr<const AsmSource> newSource);
+    
+    /// translate source
+    RefPtr<const AsmSource> rebase(const RefPtr<const AsmSource>& source);
+    /// translate macro substitution
+    RefPtr<const AsmMacroSubst> rebase(const RefPtr<const AsmMacroSubst>& macroSubst);
+};
+
 /// line translations
 struct LineTrans
 {
@@ -180,8 +206,13 @@ struct AsmMacroArg
 };
 
 /// assembler macro
+/** after definition, content of macro is compiled to list of operations (text parts,
+ * argument and counter substitutions, column translations) for every line.
+ * That compiled form is used by substitution in non-altmacro mode */
 class AsmMacro: public FastRefCountable, public NonCopyableAndNonMovable
 {
+    friend class AsmMacroLibNodeWriter;
+    friend class AsmMacroLibNodeReader;
 public:
     /// source translation
     struct SourceTrans
@@ -189,6 +220,38 @@ public:
         LineNo lineNo;    ///< line number
         RefPtr<const AsmSource> source; ///< source
     };
+    
+    /// type of operation of compiled macro content
+    enum class OpType: cxbyte
+    {
+        TEXT = 0,   ///< copy text from content
+        ARG,        ///< put value of argument
+        COUNT,      ///< put value of macro counter ('\@')
+        COLTRANS,   ///< put column translation
+        SKIPTRANS   ///< skip column translation (inside argument)
+    };
+    
+    /// operation of compiled macro content
+    struct Op
+    {
+        OpType type;    ///< type of operation
+        bool newLine;   ///< column translation starts real new line
+        LineNo lineNo;  ///< line number (for column translation)
+        size_t start;   ///< start of text in content or argument index (in sorted order)
+        size_t size;    ///< size of text
+    };
+    
+    /// compiled line of macro content
+    struct Line
+    {
+        size_t opsStart;    ///< first operation
+        size_t opsEnd;      ///< end of operations
+        size_t nextPos;     ///< position of next line in content
+        LineNo firstLineNo; ///< line number of first column translation
+        LineNo lineNo;      ///< line number of column translation after line
+        /// column translation after line (0 - none, 1 - real new line, 2 - joined line)
+        cxbyte endTrans;
+    };
 private:
     LineNo contentLineNo;
     AsmSourcePos sourcePos;
@@ -196,11 +259,20 @@ private:
     std::vector<char> content;
     std::vector<SourceTrans> sourceTranslations;
     std::vector<LineTrans> colTranslations;
+    std::vector<Op> ops;
+    std::vector<Line> lines;
+    RefPtr<const AsmMacro> origin;
 public:
     /// constructor
     AsmMacro(const AsmSourcePos& pos, const Array<AsmMacroArg>& args);
     /// constructor with rlvalue for arguments
     AsmMacro(const AsmSourcePos& pos, Array<AsmMacroArg>&& args);
+    /// constructor of copy of compiled macro with translated sources
+    AsmMacro(const RefPtr<const AsmMacro>& macro, AsmSourceRebaser& rebaser);
+    
+    /// get macro from which this macro has been copied (or this macro)
+    const AsmMacro* getOrigin() const
+    { return origin ? origin.get() : this; }
     
     /// adds line to macro from source
     /**
@@ -233,6 +305,15 @@ public:
     /// get argument
     const AsmMacroArg& getArg(size_t i) const
     { return args[i]; }
+    
+    /// compile content (must be called after adding all lines)
+    void compile();
+    /// get compiled operations
+    const std::vector<Op>& getOps() const
+    { return ops; }
+    /// get compiled line
+    const Line& getLine(size_t i) const
+    { return lines[i]; }
 };
 
 /// assembler repeat
@@ -253,6 +334,8 @@ protected:
     std::vector<char> content;  ///< content
     std::vector<SourceTrans> sourceTranslations;    ///< source translations
     std::vector<LineTrans> colTranslations; ///< column translations
+    bool replicable;    ///< content has only data and instructions
+    std::vector<CString> operandNames;  ///< names used in operands of instructions
 public:
     /// constructor
     explicit AsmRepeat(const AsmSourcePos& pos, uint64_t repeatsNum);
@@ -286,6 +369,18 @@ public:
     /// get number of repetitions
     uint64_t getRepeatsNum() const
     { return repeatsNum; }
+    
+    /// analyze content (must be called after adding all lines)
+    /** checks whether content holds only data pseudo-ops with constant values and
+     * instructions without labels and symbol definitions. Output of first iteration
+     * of such content can be replicated instead of assembling next iterations */
+    void analyzeContent();
+    /// returns true if output of iteration can be replicated
+    bool isReplicable() const
+    { return replicable; }
+    /// get names used in operands of instructions (to check later)
+    const std::vector<CString>& getOperandNames() const
+    { return operandNames; }
 };
 
 /// assembler repeat 'for'
@@ -412,7 +507,8 @@ public:
 /// assembler input layout filter
 /** filters input from comments and join splitted lines by backslash.
  * readLine returns prepared line which have only space (' ') and
- * non-space characters. */
+ * non-space characters. Regular files given by filename are mapped to memory and
+ * lines that do not require filtering are returned directly from mapped file. */
 class AsmStreamInputFilter: public AsmInputFilter
 {
 private:
@@ -429,7 +525,13 @@ private:
     std::istream* stream;
     LineMode mode;
     size_t stmtPos;
+    std::unique_ptr<MemoryMappedFile> mappedFile;
+    const char* mappedData;
+    size_t mappedSize;
+    size_t mappedPos;
     
+    void openFile(const CString& filename);
+    size_t readInput(size_t destPos);
 public:
     /// constructor with input stream and their filename
     explicit AsmStreamInputFilter(std::istream& is, const CString& filename = "");
@@ -444,6 +546,10 @@ public:
     ~AsmStreamInputFilter();
     
     const char* readLine(Assembler& assembler, size_t& lineSize);
+    
+    /// get size of input (only for mapped file, otherwise zero)
+    size_t getInputSize() const
+    { return mappedSize; }
 };
 
 /// assembler macro input filter (for macro filtering)
@@ -465,6 +571,8 @@ private:
     const LineTrans* curColTrans;
     size_t realLinePos; ///< real line size
     bool alternateMacro;
+    
+    void nextSourceTrans();
 public:
     /// constructor with input macro, source position and arguments map
     AsmMacroInputFilter(RefPtr<const AsmMacro> macro, const AsmSourcePos& pos,
@@ -482,11 +590,39 @@ public:
 class AsmRepeatInputFilter: public AsmInputFilter
 {
 protected:
+    /// state of assembler before first iteration (to replicate its output)
+    struct ReplicationState
+    {
+        cxuint sectionId;       ///< current section
+        cxuint kernelId;        ///< current kernel
+        const void* scope;      ///< current scope
+        size_t sectionsNum;     ///< sections number
+        size_t contentStart;    ///< content size before iteration
+        size_t codeFlowSize;    ///< code flow size
+        size_t relocationsNum;  ///< relocations number
+        size_t unevalExprsNum;  ///< unevaluated expressions number
+        size_t symbolsNum;      ///< symbols number in current scope
+        size_t globalSymbolsNum;    ///< symbols number in global scope
+        size_t messagesNum;     ///< printed messages number
+        uint64_t macroCount;    ///< macro substitutions count
+        size_t contentSize;     ///< size of output of iteration (after trial)
+        bool usagesRecorded;    ///< true if register usages are recorded
+    };
+    
     std::unique_ptr<const AsmRepeat> repeat;
     uint64_t repeatCount;
     LineNo contentLineNo;
     size_t sourceTransIndex;
     const LineTrans* curColTrans;
+    bool replicationTrial;  ///< if current iteration is trial for replication
+    ReplicationState replState;
+    
+    /// start trial of replication (at first or second iteration)
+    void startReplication(Assembler& assembler);
+    /// check trial iteration, returns true if its output can be replicated
+    bool checkReplication(Assembler& assembler, const void* iterSymEntry);
+    /// replicate output of trial iteration
+    void replicateOutput(Assembler& assembler, uint64_t count);
 public:
     /// constructor
     explicit AsmRepeatInputFilter(const AsmRepeat* repeat);
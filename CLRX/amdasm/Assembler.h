@@ -31,7 +31,9 @@
 #include <iostream>
 #include <vector>
 #include <utility>
+#include <memory>
 #include <stack>
+#include <algorithm>
 #include <list>
 #include <unordered_set>
 #include <unordered_map>
@@ -41,6 +43,8 @@
 #include <CLRX/amdasm/AsmSource.h>
 #include <CLRX/amdasm/AsmFormats.h>
 #include <CLRX/amdasm/AsmDefs.h>
+#include <CLRX/amdasm/AsmCache.h>
+#include <CLRX/amdasm/AsmMacroLibrary.h>
 
 /// main namespace
 namespace CLRX
@@ -95,6 +99,8 @@ protected:
     cxbyte defaultInstrSize;    ///< default instruction size
     bool isNext;        ///< is next
     bool useRegMode;    ///< true if in usereg mode
+    bool recording;     ///< true if pushed usages are recorded
+    std::vector<AsmRegVarUsage> recordedUsages; ///< recorded pushed usages
     
     void skipBytesInInstrStruct();
     /// put space to offset
@@ -141,6 +147,19 @@ public:
     /// push regvar or register from usereg pseudo-op
     void pushUseRegUsage(const AsmRegVarUsage& rvu);
     
+    /// start recording usages pushed by pushUsage (clears recorded usages)
+    void startRecording()
+    {
+        recording = true;
+        recordedUsages.clear();
+    }
+    /// stop recording usages
+    void stopRecording()
+    { recording = false; }
+    /// get recorded usages
+    const std::vector<AsmRegVarUsage>& getRecordedUsages() const
+    { return recordedUsages; }
+    
     /// get RW flags (used by assembler)
     virtual cxbyte getRwFlags(AsmRegField regField, uint16_t rstart,
                       uint16_t rend) const = 0;
@@ -296,6 +315,169 @@ public:
     size_t getInstructionSize(size_t codeSize, const cxbyte* code) const;
 };
 
+/// live interval of variable of register allocator
+struct AsmLiveInterval
+{
+    size_t start;   ///< start of interval (live time)
+    size_t end;     ///< end of interval (after last live time)
+    size_t vidx;    ///< variable index (node of interference graph)
+};
+
+/// interference graph of register allocator
+/** graph is stored as packed triangular bit matrix (small graphs) or as sorted
+ * adjacency lists in compressed form (CSR, big graphs). Graph is built in one pass:
+ * reset, adding edges and finish */
+class AsmInterGraph
+{
+private:
+    size_t nodesNum;
+    bool dense;
+    // packed lower triangle of bit matrix (bit of edge (a,b), a>b: a*(a-1)/2+b)
+    std::vector<uint64_t> matrix;
+    std::vector<std::pair<size_t, size_t> > edges; // edges while building (CSR)
+    std::vector<size_t> adjOffsets; // offsets of adjacency lists (CSR)
+    std::vector<size_t> adjNodes;   // sorted adjacency lists (CSR)
+    std::vector<size_t> degrees;
+    
+    static size_t bitIndex(size_t a, size_t b)
+    { return (a > b) ? ((a*(a-1))>>1) + b : ((b*(b-1))>>1) + a; }
+public:
+    /// maximal number of nodes of graph stored as bit matrix
+    static const size_t maxDenseNodesNum = 2048;
+    
+    /// constructor
+    AsmInterGraph() : nodesNum(0), dense(true)
+    { }
+    
+    /// remove all nodes
+    void clear();
+    /// start building graph with nodes (representation is chosen by nodes number)
+    void reset(size_t nodesNum);
+    /// add edge (ignored if a==b)
+    void addEdge(size_t a, size_t b)
+    {
+        if (a == b)
+            return;
+        if (dense)
+        {
+            const size_t bit = bitIndex(a, b);
+            matrix[bit>>6] |= 1ULL<<(bit&63);
+        }
+        else
+            edges.push_back(std::make_pair(std::min(a, b), std::max(a, b)));
+    }
+    /// finish building (computes degrees and adjacency lists)
+    void finish();
+    /// build graph from live intervals (sorts intervals)
+    /** variables interfere if their intervals overlap. Graph is built by single
+     * sweep-line pass through sorted endpoints of intervals */
+    void build(size_t nodesNum, std::vector<AsmLiveInterval>& intervals);
+    
+    /// get number of nodes
+    size_t size() const
+    { return nodesNum; }
+    /// returns true if graph is stored as bit matrix
+    bool isDense() const
+    { return dense; }
+    /// returns true if nodes interfere
+    bool isAdjacent(size_t a, size_t b) const;
+    /// get degree of node
+    size_t getDegree(size_t node) const
+    { return degrees[node]; }
+    
+    /// call function for every neighbour of node (in increasing order)
+    template<typename F>
+    void forEachNeighbour(size_t node, F func) const
+    {
+        if (!dense)
+        {
+            for (size_t i = adjOffsets[node]; i < adjOffsets[node+1]; i++)
+                func(adjNodes[i]);
+            return;
+        }
+        // smaller nodes: contiguous bits in row of node
+        const size_t rowStart = bitIndex(node, 0);
+        for (size_t bit = rowStart; bit < rowStart+node; )
+        {
+            uint64_t word = matrix[bit>>6] >> (bit&63);
+            if (bit-rowStart + 64 - (bit&63) > node)
+                // mask bits over row end
+                word &= (1ULL<<(node-(bit-rowStart)))-1ULL;
+            if (word == 0)
+            {
+                bit += 64 - (bit&63);
+                continue;
+            }
+            bit += CTZ64(word);
+            func(bit-rowStart);
+            bit++;
+        }
+        // greater nodes: single bit in every next row
+        for (size_t b = node+1; b < nodesNum; b++)
+        {
+            const size_t bit = bitIndex(b, node);
+            if ((matrix[bit>>6] & (1ULL<<(bit&63))) != 0)
+                func(b);
+        }
+    }
+};
+
+/// linear scan register allocator (fast alternative to graph coloring)
+/** every variable gets single range (from first start to last end of its intervals).
+ * Variables of equal set get same register, variables of linear chain get
+ * consecutive registers (first register aligned). Variables are scanned in order of
+ * their starts and get lowest free registers */
+class AsmLinearScan
+{
+private:
+    size_t nodesNum;
+    std::vector<AsmLiveInterval> intervals;
+    std::vector<size_t> equalParents;   // union-find of equal variables
+    std::vector<size_t> nextNodes;  // next variable in linear chain (SIZE_MAX if none)
+    std::vector<cxbyte> aligns;
+    std::vector<cxuint> fixedRegs;  // register of real register (UINT_MAX if none)
+    
+    size_t findEqual(size_t node);
+public:
+    /// constructor
+    AsmLinearScan() : nodesNum(0)
+    { }
+    
+    /// start with variables (nodes)
+    void reset(size_t nodesNum);
+    /// add live interval of variable
+    void addInterval(const AsmLiveInterval& interval)
+    { intervals.push_back(interval); }
+    /// set alignment of register of variable
+    void setAlignment(size_t node, cxbyte align)
+    { aligns[node] = std::max(aligns[node], align); }
+    /// set fixed register of variable (real register)
+    void setFixedRegister(size_t node, cxuint reg)
+    { fixedRegs[node] = reg; }
+    /// variable next must get register after register of variable node
+    void addLinear(size_t node, size_t next)
+    { nextNodes[node] = next; }
+    /// variables must get same register
+    void addEqual(size_t a, size_t b);
+    
+    /// get number of variables
+    size_t size() const
+    { return nodesNum; }
+    /// allocate registers, returns number of used registers
+    /** throws AsmException if maxRegsNum registers is not enough
+     * \param maxRegsNum maximal number of registers
+     * \param regMap output registers of variables
+     */
+    cxuint allocate(cxuint maxRegsNum, Array<cxuint>& regMap);
+};
+
+/// register allocation algorithm
+enum class AsmRegAllocMode: cxbyte
+{
+    GRAPH_COLORING = 0, ///< coloring of interference graph (SDO/LDO ordering)
+    LINEAR_SCAN     ///< linear scan of live intervals (faster, more registers)
+};
+
 class AsmRegAllocator
 {
 public:
@@ -304,19 +486,20 @@ public:
         size_t block;
         bool isCall;
     };
+    /// SSA info (UINT32_MAX - no SSA id)
     struct SSAInfo
     {
-        size_t ssaIdBefore; ///< SSA id before first SSA in block
-        size_t ssaIdFirst; // SSA id at first change
-        size_t ssaId;   ///< original SSA id
-        size_t ssaIdLast; ///< last SSA id in last
-        size_t ssaIdChange; ///< number of SSA id changes
-        size_t firstPos;
-        size_t lastPos;
+        uint32_t ssaIdBefore; ///< SSA id before first SSA in block
+        uint32_t ssaIdFirst; // SSA id at first change
+        uint32_t ssaId;   ///< original SSA id
+        uint32_t ssaIdLast; ///< last SSA id in last
+        uint32_t ssaIdChange; ///< number of SSA id changes
+        uint32_t firstPos;
+        uint32_t lastPos;
         bool readBeforeWrite;   ///< have read before write
-        SSAInfo(size_t _bssaId = SIZE_MAX, size_t _ssaIdF = SIZE_MAX,
-                size_t _ssaId = SIZE_MAX, size_t _ssaIdL = SIZE_MAX,
-                size_t _ssaIdChange = 0, bool _readBeforeWrite = false)
+        SSAInfo(uint32_t _bssaId = UINT32_MAX, uint32_t _ssaIdF = UINT32_MAX,
+                uint32_t _ssaId = UINT32_MAX, uint32_t _ssaIdL = UINT32_MAX,
+                uint32_t _ssaIdChange = 0, bool _readBeforeWrite = false)
             : ssaIdBefore(_bssaId), ssaIdFirst(_ssaIdF), ssaId(_ssaId),
               ssaIdLast(_ssaIdL), ssaIdChange(_ssaIdChange),
               readBeforeWrite(_readBeforeWrite)
@@ -329,8 +512,8 @@ public:
         bool haveCalls;
         bool haveReturn;
         bool haveEnd;
-        // key - regvar, value - SSA info for this regvar
-        std::unordered_map<AsmSingleVReg, SSAInfo> ssaInfoMap;
+        // key - regvar, value - SSA info for this regvar (sorted by regvar)
+        std::vector<std::pair<AsmSingleVReg, SSAInfo> > ssaInfoMap;
         ISAUsageHandler::ReadPos usagePos;
     };
     
@@ -338,7 +521,7 @@ public:
     typedef std::pair<size_t, size_t> SSAReplace;
     typedef std::unordered_map<AsmSingleVReg, VectorSet<SSAReplace> > SSAReplacesMap;
     // interference graph type
-    typedef Array<std::unordered_set<size_t> > InterGraph;
+    typedef AsmInterGraph InterGraph;
     typedef std::unordered_map<AsmSingleVReg, std::vector<size_t> > VarIndexMap;
     struct LinearDep
     {
@@ -353,10 +536,14 @@ public:
     };
 private:
     Assembler& assembler;
+    AsmRegAllocMode mode;
     std::vector<CodeBlock> codeBlocks;
     SSAReplacesMap ssaReplacesMap;
     size_t regTypesNum;
     
+    size_t graphVregsCounts[MAX_REGTYPES_NUM];
+    std::vector<AsmLiveInterval> liveIntervals[MAX_REGTYPES_NUM];
+    cxuint regsNums[MAX_REGTYPES_NUM]; // number of allocated registers
     VarIndexMap vregIndexMaps[MAX_REGTYPES_NUM]; // indices to igraph for 2 reg types
     InterGraph interGraphs[MAX_REGTYPES_NUM]; // for 2 register 
     Array<cxuint> graphColorMaps[MAX_REGTYPES_NUM];
@@ -373,9 +560,23 @@ public:
     void applySSAReplaces();
     void createInterferenceGraph(ISAUsageHandler& usageHandler);
     void colorInterferenceGraph();
+    void linearScanRegisters();
     
     void allocateRegisters(cxuint sectionId);
     
+    /// get register allocation mode
+    AsmRegAllocMode getMode() const
+    { return mode; }
+    /// set register allocation mode
+    void setMode(AsmRegAllocMode _mode)
+    { mode = _mode; }
+    /// get number of allocated registers of register type (after allocation)
+    cxuint getRegistersNum(cxuint regType) const
+    { return regsNums[regType]; }
+    /// get registers of variables of register type (after allocation)
+    const Array<cxuint>& getGraphColorMap(cxuint regType) const
+    { return graphColorMaps[regType]; }
+    
     const std::vector<CodeBlock>& getCodeBlocks() const
     { return codeBlocks; }
     const SSAReplacesMap& getSSAReplacesMap() const
@@ -401,6 +602,26 @@ struct AsmClause
     AsmSourcePos prevIfPos; ///< position of previous if-clause
 };
 
+/// statistics of assembling (times in nanoseconds)
+/** times are measured only if statistics are enabled, counters are always updated.
+ * Times of phases are inclusive: time of pseudo-op dispatch includes evaluation of
+ * expressions and reading lines of macro definitions done by pseudo-ops */
+struct AsmStats
+{
+    uint64_t lineReadingTime;   ///< time of reading lines (including macro contents)
+    uint64_t macroExpansionTime;    ///< time of parsing arguments of macro calls
+    uint64_t pseudoOpTime;  ///< time of pseudo-op dispatch
+    uint64_t instrEncodingTime; ///< time of instruction encoding
+    uint64_t exprEvaluationTime;    ///< time of expression evaluation
+    uint64_t symbolResolvingTime;   ///< time of resolving pending symbols and expressions
+    uint64_t regAllocTime;  ///< time of register allocation
+    uint64_t binaryGenTime; ///< time of binary generation (including writeBinary)
+    size_t linesNum;    ///< number of read lines
+    size_t macroExpansionsNum;  ///< number of macro expansions
+    size_t deferredExprsNum;    ///< number of expressions evaluated later
+    size_t symbolsNum;  ///< number of created symbols
+};
+
 /// main class of assembler
 class Assembler: public NonCopyableAndNonMovable
 {
@@ -412,6 +633,7 @@ public:
 private:
     friend class AsmStreamInputFilter;
     friend class AsmMacroInputFilter;
+    friend class AsmRepeatInputFilter;
     friend class AsmForInputFilter;
     friend class AsmExpression;
     friend class AsmFormatHandler;
@@ -439,6 +661,7 @@ private:
     bool _64bit;    ///
     bool newROCmBinFormat;
     bool good;
+    size_t messagesNum; // number of printed messages
     bool resolvingRelocs;
     bool doNotRemoveFromSymbolClones;
     ISAAssembler* isaAssembler;
@@ -450,8 +673,14 @@ private:
     std::unordered_set<AsmSymbolEntry*> symbolClones;
     std::vector<AsmExpression*> unevalExpressions;
     std::vector<AsmRelocation> relocations;
+    AsmNamePool namePool;
     AsmScope globalScope;
     AsmMacroMap macroMap;
+    AsmNameIndex<AsmMacroMap::value_type> macroIndex;
+    std::vector<CString> macroLibraryFiles; // libraries given by user
+    std::vector<std::unique_ptr<AsmMacroLibrary> > macroLibraries;
+    // macros of libraries not loaded yet (library index, macro index)
+    std::unordered_map<CString, std::pair<size_t, size_t> > lazyMacros;
     std::stack<AsmScope*> scopeStack;
     std::vector<AsmScope*> abandonedScopes;
     AsmScope* currentScope;
@@ -473,6 +702,7 @@ private:
     
     size_t lineSize;
     const char* line;
+    size_t contentSizeHint; // reserved size for content of first code section
     bool endOfAssembly;
     bool sectionDiffsPrepared;
     
@@ -483,6 +713,66 @@ private:
     std::ostream& messageStream;
     std::ostream& printStream;
     
+    AsmCache* cache;
+    bool cacheRecording; // if dependencies and messages are recorded for cache
+    bool cacheable;
+    bool cacheHit;
+    bool useCachedBinary; // if binary is held in cacheEntry
+    AsmCacheEntry cacheEntry;
+    std::istream* inputStream; // input stream from constructor
+    CString inputStreamName;
+    std::string inputContent; // content of input stream (read if cache is used)
+    std::unique_ptr<std::istream> inputContentStream;
+    
+    // included file recorded to snapshot
+    struct IncludeFrame
+    {
+        const AsmInputFilter* filter;
+        std::string path;
+        AsmCacheHash hash;
+        RefPtr<const AsmSource> source;
+        AsmIncludeSettings settings;
+        uint64_t sideEffects;
+        size_t symbolReadsStart;
+        size_t macroReadsStart;
+        size_t depsStart;
+        size_t messagesNum;
+        size_t clausesNum;
+        size_t symbolsNum;
+        size_t sectionsNum;
+        size_t kernelsNum;
+        size_t scopesNum;
+        size_t regVarsNum;
+        size_t unevalExprsNum;
+        AsmFormatHandler* formatHandler;
+        cxuint currentSection;
+        uint64_t currentOutPos;
+        uint64_t macroCount;
+        uint64_t localCount;
+    };
+    AsmIncludeCache* includeCache;
+    std::vector<IncludeFrame> includeFrames;
+    // symbols and macros used by recorded included files (in usage order)
+    std::vector<AsmIncludeSnapshot::Symbol> includeSymbolReads;
+    std::vector<AsmIncludeSnapshot::Macro> includeMacroReads;
+    std::vector<AsmCacheDependency> includeDeps;
+    // counter of statements that can not be replayed from snapshot
+    uint64_t includeSideEffects;
+    
+    AsmIncludeDirCache* includeDirCache;
+    // include directories checked against changes in this assembling
+    std::unordered_set<std::string> validatedIncludeDirs;
+    AsmIncludeSearchStats includeSearchStats;
+    
+    bool statsEnabled;
+    // also updated by writeBinary (binary generation time)
+    mutable AsmStats stats;
+    
+    AsmRegAllocMode regAllocMode;
+    cxuint regAllocThreadsNum;
+    // register allocators of code sections (null if section has no code)
+    std::vector<std::unique_ptr<AsmRegAllocator> > regAllocators;
+    
     AsmFormatHandler* formatHandler;
     
     std::stack<AsmClause> clauses;
@@ -570,45 +860,94 @@ private:
     bool popClause(const char* string, AsmClauseType clauseType);
     
     // recursive function to find scope in scope
-    AsmScope* findScopeInScope(AsmScope* scope, const CString& scopeName,
+    AsmScope* findScopeInScope(AsmScope* scope, AsmNameId scopeNameId,
                     std::unordered_set<AsmScope*>& scopeSet);
     // find scope by identifier
     AsmScope* getRecurScope(const CString& scopePlace, bool ignoreLast = false,
-                    const char** lastStep = nullptr);
+                    const char** lastStep = nullptr)
+    { return getRecurScope(scopePlace.c_str(), scopePlace.c_str()+scopePlace.size(),
+                    ignoreLast, lastStep); }
+    // find scope by identifier (given by range)
+    // if createScopes is false, returns null if some scope doesn't exist
+    AsmScope* getRecurScope(const char* scopePlace, const char* scopePlaceEnd,
+                    bool ignoreLast = false, const char** lastStep = nullptr,
+                    bool createScopes = true);
     // find symbol in scopes
     // internal recursive function to find symbol in scope
-    AsmSymbolEntry* findSymbolInScopeInt(AsmScope* scope, const CString& symName,
-                    std::unordered_set<AsmScope*>& scopeSet);
-    // scope - return scope from scoped name
+    // symScope - return scope that holds found symbol
+    AsmSymbolEntry* findSymbolInScopeInt(AsmScope* scope, AsmNameId symNameId,
+                    std::unordered_set<AsmScope*>& scopeSet, AsmScope*& symScope);
+    // scope - return scope from scoped name, symScope - scope that holds symbol
     AsmSymbolEntry* findSymbolInScope(const CString& symName, AsmScope*& scope,
-                      CString& sameSymName, bool insertMode = false);
-    // similar to map::insert, but returns pointer
+                      CString& sameSymName, bool insertMode = false,
+                      AsmScope** symScope = nullptr);
+    // scope - return scope from scoped name, symNameId - last part of name
+    AsmSymbolEntry* findSymbolInScope(const char* symName, const char* symNameEnd,
+                AsmScope*& scope, AsmNameId& symNameId, bool insertMode = false,
+                AsmScope** symScope = nullptr);
+    // find existing symbol (does not create scopes and does not record symbol reads)
+    const AsmSymbolEntry* findExistingSymbol(const CString& symName);
+    // similar to map::insert, but returns pointer (symScope - scope that holds symbol)
     std::pair<AsmSymbolEntry*, bool> insertSymbolInScope(const CString& symName,
-                 const AsmSymbol& symbol);
+                 const AsmSymbol& symbol, AsmScope** symScope = nullptr);
+    // add symbol which can be unresolved to pending symbols of its scope
+    void addPendingSymbol(AsmScope* scope, AsmSymbolEntry& symEntry)
+    {
+        if (!symEntry.second.pending)
+        {
+            symEntry.second.pending = true;
+            // remove resolved symbols before list grows
+            if (scope->pendingSymbols.size() == scope->pendingSymbols.capacity())
+                compactPendingSymbols(scope);
+            scope->pendingSymbols.push_back(&symEntry);
+        }
+    }
+    // remove resolved symbols from pending symbols of scope (keeps order)
+    void compactPendingSymbols(AsmScope* scope);
     
-    // internal recursive function to find symbol in scope
-    AsmRegVarEntry* findRegVarInScopeInt(AsmScope* scope, const CString& rvName,
+    // internal recursive function to find regvar in scope
+    AsmRegVarEntry* findRegVarInScopeInt(AsmScope* scope, AsmNameId rvNameId,
                     std::unordered_set<AsmScope*>& scopeSet);
     // scope - return scope from scoped name
     AsmRegVarEntry* findRegVarInScope(const CString& rvName, AsmScope*& scope,
                       CString& sameRvName, bool insertMode = false);
+    // scope - return scope from scoped name, rvNameId - last part of name
+    AsmRegVarEntry* findRegVarInScope(const char* rvName, const char* rvNameEnd,
+                AsmScope*& scope, AsmNameId& rvNameId, bool insertMode = false);
     // similar to map::insert, but returns pointer
     std::pair<AsmRegVarEntry*, bool> insertRegVarInScope(const CString& rvName,
                  const AsmRegVar& regVar);
     
     // create scope
-    bool getScope(AsmScope* parent, const CString& scopeName, AsmScope*& scope);
+    bool getScope(AsmScope* parent, const CString& scopeName, AsmScope*& scope)
+    { return getScope(parent, namePool.intern(scopeName.c_str(), scopeName.size()),
+                    scope); }
+    // create scope (by interned name)
+    bool getScope(AsmScope* parent, AsmNameId scopeNameId, AsmScope*& scope);
     // push new scope level
     bool pushScope(const CString& scopeName);
     bool popScope();
     
     /// returns false when includeLevel is too deep, throw error if failed a file opening
     bool includeFile(const char* pseudoOpPlace, const std::string& filename);
+    // returns false if file doesn't exist in include directory (no probe needed)
+    bool probeIncludeDir(const std::string& incDirPath, const std::string& filename);
     
     ParseState makeMacroSubstitution(const char* string);
     
+    // find macro, load macro from library if not loaded yet
+    const AsmMacroMap::value_type* findMacro(const char* macroPlace,
+                const CString& macroName, AsmNameId macroNameId);
+    // put macros and symbols of library (pseudoOpPlace is null for user's library)
+    bool putMacroLibrary(const char* pseudoOpPlace,
+                std::unique_ptr<AsmMacroLibrary>&& library);
+    // open and put library included by pseudo-op
+    bool includeMacroLibrary(const char* pseudoOpPlace, const std::string& filename);
+    
     bool parseMacroArgValue(const char*& linePtr, std::string& outStr);
     
+    void applyContentSizeHint(AsmSection& section);
+    
     void putData(size_t size, const cxbyte* data)
     {
         AsmSection& section = sections[currentSection];
@@ -659,6 +998,22 @@ private:
     
     bool resolveExprTarget(const AsmExpression* expr, uint64_t value, cxuint sectionId);
     
+    AsmCacheHash computeCacheKey();
+    void addCacheDependency(const std::string& path, bool exists);
+    void addCacheDependency(const AsmCacheDependency& dep);
+    void writeCachedBinary(std::ostream& outStream) const;
+    
+    void markIncludeSideEffect()
+    { includeSideEffects++; }
+    void recordIncludeSymbol(const char* symName, const char* symNameEnd,
+                bool scoped, const AsmSymbolEntry* symEntry);
+    void recordIncludeMacro(const CString& macroName,
+                const AsmMacroMap::value_type* macroEntry);
+    AsmIncludeSettings getIncludeSettings() const;
+    bool replayIncludeSnapshot(const char* pseudoOpPlace, const std::string& filename);
+    void beginIncludeFrame(const std::string& filename);
+    void finishIncludeFrame();
+    
     void cloneSymEntryIfNeeded(AsmSymbolEntry& symEntry);
     
     void undefineSymbol(AsmSymbolEntry& symEntry);
@@ -803,6 +1158,82 @@ public:
     /// add initiali defsyms
     void addInitialDefSym(const CString& symName, uint64_t value);
     
+    /// add library of pre-parsed macros loaded before assembling
+    void addMacroLibrary(const CString& filename)
+    { macroLibraryFiles.push_back(filename); }
+    /// get number of macros loaded from libraries
+    size_t getLoadedLibraryMacrosNum() const;
+    /// write macros and absolute symbols to library (after assembling)
+    /** writes all macros and absolute symbols from global scope (except '.') */
+    void writeMacroLibrary(const CString& filename);
+    
+    /// get cache of assembled binaries
+    AsmCache* getCache() const
+    { return cache; }
+    /// set cache of assembled binaries (null disables caching)
+    /** if up to date binary has been found in cache, then assemble routine prints
+     * stored messages and skips assembling (sections, symbols and format handler
+     * are not available) */
+    void setCache(AsmCache* cache)
+    { this->cache = cache; }
+    /// returns true if binary has been loaded from cache
+    bool isCacheHit() const
+    { return cacheHit; }
+    
+    /// get cache of included files
+    AsmIncludeCache* getIncludeCache() const
+    { return includeCache; }
+    /// set cache of included files (null disables snapshots of included files)
+    /** included file that only defines macros and absolute symbols is recorded
+     * to snapshot. When this file will be included again with same incoming state,
+     * then snapshot is replayed instead of assembling file */
+    void setIncludeCache(AsmIncludeCache* includeCache)
+    { this->includeCache = includeCache; }
+    
+    /// get cache of listings of include directories
+    AsmIncludeDirCache* getIncludeDirCache() const
+    { return includeDirCache; }
+    /// set cache of listings of include directories (null - probe every directory)
+    /** by default, cache shared by all assemblers in process is used */
+    void setIncludeDirCache(AsmIncludeDirCache* includeDirCache)
+    { this->includeDirCache = includeDirCache; }
+    /// get statistics of searching of included files
+    const AsmIncludeSearchStats& getIncludeSearchStats() const
+    { return includeSearchStats; }
+    
+    /// returns true if measuring times of assembler phases is enabled
+    bool isStatsEnabled() const
+    { return statsEnabled; }
+    /// enable or disable measuring times of assembler phases
+    void setStatsEnabled(bool statsEnabled)
+    { this->statsEnabled = statsEnabled; }
+    /// get statistics of assembling
+    const AsmStats& getStats() const
+    { return stats; }
+    
+    /// get register allocation mode
+    AsmRegAllocMode getRegAllocMode() const
+    { return regAllocMode; }
+    /// set register allocation mode
+    void setRegAllocMode(AsmRegAllocMode regAllocMode)
+    { this->regAllocMode = regAllocMode; }
+    /// get number of threads used to allocate registers
+    cxuint getRegAllocThreadsNum() const
+    { return regAllocThreadsNum; }
+    /// set number of threads used to allocate registers
+    /** 1 - serial allocation (default), 0 - number of hardware threads.
+     * Code sections are independent and they are allocated in separate threads.
+     * Results are same for any number of threads */
+    void setRegAllocThreadsNum(cxuint regAllocThreadsNum)
+    { this->regAllocThreadsNum = regAllocThreadsNum; }
+    /// allocate registers in all code sections (after assembling)
+    /** throws AsmException if allocation failed (for first failed section) */
+    void allocateRegisters();
+    /// get register allocator of section (null if registers are not allocated)
+    const AsmRegAllocator* getRegAllocator(cxuint sectionId) const
+    { return sectionId < regAllocators.size() ? regAllocators[sectionId].get() :
+                nullptr; }
+    
     /// get format handler
     const AsmFormatHandler* getFormatHandler() const
     { return formatHandler; }
@@ -105,6 +105,7 @@ protected:
     size_t inputSize;   ///< size of input
     const cxbyte* input;    ///< input code
     bool dontPrintLabelsAfterCode;
+    size_t sectionId;   ///< section id for numbered labels (SIZE_MAX - section count)
     std::vector<size_t> labels; ///< list of local labels
     std::vector<std::pair<size_t, CString> > namedLabels;   ///< named labels
     std::vector<CString> relSymbols;    ///< symbols used by relocations
@@ -113,6 +114,9 @@ protected:
     
     /// constructor
     explicit ISADisassembler(Disassembler& disassembler, cxuint outBufSize = 600);
+    /// constructor with own output stream
+    ISADisassembler(Disassembler& disassembler, std::ostream& output,
+                cxuint outBufSize = 600);
     
     /// write location in the code
     void writeLocation(size_t pos);
@@ -141,6 +145,17 @@ public:
     void setDontPrintLabels(bool after)
     { dontPrintLabelsAfterCode = after; }
     
+    /// set section id used in names of numbered labels (SIZE_MAX - section count)
+    void setSectionId(size_t id)
+    { sectionId = id; }
+    /// get section id used in names of numbered labels
+    size_t getSectionId() const;
+    
+    /// create new ISA disassembler (without labels) that writes to other output
+    /** used to disassemble independent codes in parallel, default implementation
+     * throws DisasmException (parallel disassembling is not supported) */
+    virtual ISADisassembler* createForOutput(std::ostream& output) const;
+    
     /// analyze code before disassemblying
     virtual void analyzeBeforeDisassemble() = 0;
     
@@ -197,9 +212,14 @@ private:
 public:
     /// constructor
     GCNDisassembler(Disassembler& disassembler);
+    /// constructor with own output stream
+    GCNDisassembler(Disassembler& disassembler, std::ostream& output);
     /// destructor
     ~GCNDisassembler();
     
+    /// create new GCN disassembler that writes to other output
+    ISADisassembler* createForOutput(std::ostream& output) const;
+    
     /// analyze code before disassemblying
     void analyzeBeforeDisassemble();
     /// disassemble code
@@ -379,6 +399,7 @@ private:
     std::ostream& output;
     Flags flags;
     size_t sectionCount;
+    cxuint threadsNum;
 public:
     /// constructor for 32-bit GPU binary
     /**
@@ -482,6 +503,16 @@ public:
     void setFlags(Flags flags)
     { this->flags = flags; }
     
+    /// get number of threads used to disassemble codes of kernels
+    cxuint getThreadsNum() const
+    { return threadsNum; }
+    /// set number of threads used to disassemble codes of kernels
+    /** 1 - serial disassembling (default), 0 - number of hardware threads.
+     * Used only by AMD and AMD OpenCL 2.0 binaries (every kernel has own code).
+     * Output is same for any number of threads */
+    void setThreadsNum(cxuint threadsNum)
+    { this->threadsNum = threadsNum; }
+    
     /// get deviceType
     GPUDeviceType getDeviceType() const;
     
@@ -208,6 +208,7 @@ class AmdGPUBinGenerator: public NonCopyableAndNonMovable
 private:
     bool manageable;
     const AmdInput* input;
+    cxuint threadsNum;
     
     void generateInternal(std::ostream* osPtr, std::vector<char>* vPtr,
              Array<cxbyte>* aPtr) const;
@@ -241,6 +242,16 @@ public:
     /// set input
     void setInput(const AmdInput* input);
     
+    /// get number of threads used to generate inner binaries of kernels
+    cxuint getThreadsNum() const
+    { return threadsNum; }
+    
+    /// set number of threads used to generate inner binaries of kernels
+    /** 1 - serial generation (default), 0 - number of hardware threads.
+     * Generated binary is same for any number of threads */
+    void setThreadsNum(cxuint _threadsNum)
+    { threadsNum = _threadsNum; }
+    
     /// generates binary
     void generate(Array<cxbyte>& array) const;
     
@@ -29,12 +29,20 @@
 #include <string>
 #include <ostream>
 #include <cstring>
+#include <atomic>
+#include <new>
 #include <initializer_list>
 
 namespace CLRX
 {
 
 /// simple C-string container
+/** Short strings (up to 22 characters) are held inside object. Longer strings
+ * are held in reference counted buffer that is shared between copies and it is
+ * copied only before modification (copy-on-write). After getting non-const
+ * reference or pointer to characters, buffer is owned only by this string and
+ * next copies of string get own buffer.
+ */
 class CString
 {
 public:
@@ -44,111 +52,163 @@ public:
     typedef std::string::size_type size_type; ///< size type
     static const size_type npos = -1;   ///< value to indicate no position
 private:
-    char* ptr;
-public:
-    /// constructor
-    CString(): ptr(nullptr)
-    { }
+    // header of shared buffer, characters follows this header
+    struct SharedBuf
+    {
+        std::atomic<size_t> refCount;
+    };
+    struct SharedRef
+    {
+        SharedBuf* buf;
+        size_t length;
+    };
+    // last byte holds length of local string or SHARED_TAG
+    static const size_t LOCAL_MAX_SIZE = 22;
+    static const cxbyte SHARED_TAG = 0xff;
+    // reference counter of buffer that can not be shared (modifiable outside)
+    static const size_t UNSHAREABLE = ~size_t(0);
+    union
+    {
+        char local[LOCAL_MAX_SIZE+2];
+        SharedRef shared;
+    };
     
-    /// constructor from C-style string pointer
-    explicit CString(size_t n) : ptr(nullptr)
+    bool isLocal() const
+    { return cxbyte(local[LOCAL_MAX_SIZE+1]) != SHARED_TAG; }
+    
+    static char* sharedChars(SharedBuf* buf)
+    { return reinterpret_cast<char*>(buf+1); }
+    
+    void setEmpty()
     {
-        if (n == 0) return;
-        ptr = new char[n+1];
-        ptr[n] = 0;
+        local[0] = 0;
+        local[LOCAL_MAX_SIZE+1] = 0;
     }
     
-    /// constructor from C-style string pointer
-    CString(const char* str) : ptr(nullptr)
+    // prepare storage for n characters (old storage must be released)
+    char* allocate(size_t n)
     {
-        if (str == nullptr)
-            return;
-        const size_t n = ::strlen(str);
-        if (n == 0)
-            return;
-        ptr = new char[n+1];
-        ::memcpy(ptr, str, n);
-        ptr[n] = 0;
+        if (n <= LOCAL_MAX_SIZE)
+        {
+            local[n] = 0;
+            local[LOCAL_MAX_SIZE+1] = n;
+            return local;
+        }
+        SharedBuf* buf = static_cast<SharedBuf*>(::operator new(sizeof(SharedBuf)+n+1));
+        new(&buf->refCount) std::atomic<size_t>(1);
+        shared.buf = buf;
+        shared.length = n;
+        local[LOCAL_MAX_SIZE+1] = SHARED_TAG;
+        char* chars = sharedChars(buf);
+        chars[n] = 0;
+        return chars;
     }
     
-    /// constructor from C++ std::string
-    CString(const std::string& str) : ptr(nullptr)
+    // release shared buffer if this is a last reference
+    void release()
     {
-        const size_t n = str.size();
-        if (n == 0)
+        if (isLocal())
             return;
-        ptr = new char[n+1];
-        ::memcpy(ptr, str.c_str(), n);
-        ptr[n] = 0;
+        if (shared.buf->refCount.load() == UNSHAREABLE ||
+            shared.buf->refCount.fetch_sub(1) == 1)
+            ::operator delete(shared.buf);
     }
     
-    /// constructor
-    CString(const char* str, size_t n) : ptr(nullptr)
+    /* get characters for modification (make own copy of shared buffer).
+     * returned pointer can be used later, hence buffer becomes unshareable */
+    char* mutableChars()
     {
-        if (n == 0)
-            return;
-        ptr = new char[n+1];
-        ::memcpy(ptr, str, n);
-        ptr[n] = 0;
+        if (isLocal())
+            return local;
+        const size_t refCount = shared.buf->refCount.load();
+        if (refCount != 1 && refCount != UNSHAREABLE)
+        {
+            SharedBuf* oldBuf = shared.buf;
+            const size_t n = shared.length;
+            ::memcpy(allocate(n), sharedChars(oldBuf), n);
+            if (oldBuf->refCount.fetch_sub(1) == 1)
+                ::operator delete(oldBuf);
+        }
+        shared.buf->refCount.store(UNSHAREABLE);
+        return sharedChars(shared.buf);
     }
-    
+public:
     /// constructor
-    CString(const char* str, const char* end) : ptr(nullptr)
+    CString()
+    { setEmpty(); }
+    
+    /// constructor from C-style string pointer
+    explicit CString(size_t n)
+    { allocate(n); }
+    
+    /// constructor from C-style string pointer
+    CString(const char* str)
     {
-        const size_t n = end-str;
-        if (n == 0)
-            return;
-        ptr = new char[n+1];
-        ::memcpy(ptr, str, n);
-        ptr[n] = 0;
+        const size_t n = (str != nullptr) ? ::strlen(str) : 0;
+        char* chars = allocate(n);
+        if (n != 0)
+            ::memcpy(chars, str, n);
     }
     
-    /// constructor
-    CString(size_t n, char ch) : ptr(nullptr)
+    /// constructor from C++ std::string
+    CString(const std::string& str)
     {
-        if (n == 0)
-            return;
-        ptr = new char[n+1];
-        ::memset(ptr, ch, n);
-        ptr[n] = 0;
+        const size_t n = str.size();
+        ::memcpy(allocate(n), str.c_str(), n);
     }
     
-    /// copy-constructor
-    CString(const CString& cstr) : ptr(nullptr)
+    /// constructor
+    CString(const char* str, size_t n)
+    { ::memcpy(allocate(n), str, n); }
+    
+    /// constructor
+    CString(const char* str, const char* end)
+    { ::memcpy(allocate(end-str), str, end-str); }
+    
+    /// constructor
+    CString(size_t n, char ch)
+    { ::memset(allocate(n), ch, n); }
+    
+    /// copy-constructor (shares buffer unless it is unshareable)
+    CString(const CString& cstr)
     {
-        const size_t n = cstr.size();
-        if (n == 0)
+        if (!cstr.isLocal() && cstr.shared.buf->refCount.load() == UNSHAREABLE)
+        {
+            const size_t n = cstr.shared.length;
+            ::memcpy(allocate(n), sharedChars(cstr.shared.buf), n);
             return;
-        ptr = new char[n+1];
-        ::memcpy(ptr, cstr.c_str(), n);
-        ptr[n] = 0;
+        }
+        ::memcpy(local, cstr.local, sizeof(local));
+        if (!isLocal())
+            shared.buf->refCount.fetch_add(1);
     }
     
     /// move-constructor
-    CString(CString&& cstr) noexcept : ptr(cstr.ptr)
-    { cstr.ptr = nullptr; }
+    CString(CString&& cstr) noexcept
+    {
+        ::memcpy(local, cstr.local, sizeof(local));
+        cstr.setEmpty();
+    }
     
     /// constructor
-    CString(std::initializer_list<char> init) : ptr(nullptr)
+    CString(std::initializer_list<char> init)
     {
         const size_t n = init.size();
-        if (n == 0)
-            return;
-        ptr = new char[n+1];
-        std::copy(init.begin(), init.end(), ptr);
-        ptr[n] = 0; // null char
+        std::copy(init.begin(), init.end(), allocate(n));
     }
     
     /// destructor
     ~CString()
-    { delete[] ptr; }
+    { release(); }
     
     /// copy-assignment
     CString& operator=(const CString& cstr)
     {
         if (this==&cstr)
             return *this;
-        return assign(cstr.ptr);
+        CString newStr(cstr);
+        swap(newStr);
+        return *this;
     }
     
     /// assignment
@@ -158,9 +218,11 @@ public:
     /// move-assignment
     CString& operator=(CString&& cstr) noexcept
     {
-        delete[] ptr;   // delete old
-        ptr = cstr.ptr;
-        cstr.ptr = nullptr;
+        if (this==&cstr)
+            return *this;
+        release();   // delete old
+        ::memcpy(local, cstr.local, sizeof(local));
+        cstr.setEmpty();
         return *this;
     }
     
@@ -181,8 +243,7 @@ public:
     {
         if (str==nullptr)
         {
-            delete[] ptr;
-            ptr = nullptr;
+            clear();
             return *this;
         }
         size_t length = ::strlen(str);
@@ -192,18 +253,9 @@ public:
     /// assign string
     CString& assign(const char* str, size_t n)
     {
-        if (n == 0)
-        {
-            // just clear
-            delete[] ptr;
-            ptr = nullptr;
-            return *this;
-        }
-        char* newPtr = new char[n+1];
-        ::memcpy(newPtr, str, n);
-        newPtr[n] = 0;
-        delete[] ptr;
-        ptr = newPtr;
+        // string can be part of this string
+        CString newStr(str, n);
+        swap(newStr);
         return *this;
     }
     
@@ -214,91 +266,64 @@ public:
     /// assign string
     CString& assign (size_t n, char ch)
     {
-        if (n == 0)
-        {
-            // just clear
-            delete[] ptr;
-            ptr = nullptr;
-            return *this;
-        }
-        char* newPtr = new char[n+1];
-        ::memset(newPtr, ch, n);
-        newPtr[n] = 0; // null-char
-        delete[] ptr;
-        ptr = newPtr;
+        release();
+        ::memset(allocate(n), ch, n);
         return *this;
     }
     
     /// assign string
     CString& assign(std::initializer_list<char> init)
     {
-        const size_t n = init.size();
-        if (n == 0)
-        {
-            // just clear
-            delete[] ptr;
-            ptr = nullptr;
-            return *this;
-        }
-        char* newPtr = new char[n+1];
-        std::copy(init.begin(), init.end(), newPtr);
-        newPtr[n] = 0; // null char
-        delete[] ptr;
-        ptr = newPtr;
+        release();
+        std::copy(init.begin(), init.end(), allocate(init.size()));
         return *this;
     }
     
     /// return C-style string pointer
     const char* c_str() const
-    { return ptr!=nullptr ? ptr : ""; }
+    { return isLocal() ? local : sharedChars(shared.buf); }
     
     /// return C-style string pointer
     const char* begin() const
-    { return ptr!=nullptr ? ptr : ""; }
+    { return c_str(); }
     
     /// get ith character (use only if string is not empty)
     const char& operator[](size_t i) const
-    { return ptr[i]; }
+    { return c_str()[i]; }
     
     /// get ith character (use only if string is not empty)
     char& operator[](size_t i)
-    { return ptr[i]; }
+    { return mutableChars()[i]; }
     
     /// return C-style string pointer
     char* begin()
-    { return ptr; }
+    { return mutableChars(); }
     
-    /// compute size
+    /// get size
     size_t size() const
-    {
-        if (ptr==nullptr) return 0;
-        return ::strlen(ptr);
-    }
-    /// compute size
+    { return isLocal() ? cxbyte(local[LOCAL_MAX_SIZE+1]) : shared.length; }
+    /// get size
     size_t length() const
-    {
-        if (ptr==nullptr) return 0;
-        return ::strlen(ptr);
-    }
+    { return size(); }
     
     /// clear this string
     void clear()
     {
-        delete[] ptr;
-        ptr = nullptr;
+        release();
+        setEmpty();
     }
     
     /// return true if string is empty
     bool empty() const
-    { return ptr==nullptr; }
+    { return size()==0; }
     
     /// first character (use only if string is not empty)
     const char& front() const
-    { return ptr[0]; }
+    { return c_str()[0]; }
     
     /// first character (use only if string is not empty)
     char& front()
-    { return ptr[0]; }
+    { return mutableChars()[0]; }
     
     /// compare with string
     int compare(const CString& cstr) const
@@ -342,7 +367,12 @@ public:
     
     /// swap this string with another
     void swap(CString& s2) noexcept
-    { std::swap(ptr, s2.ptr); }
+    {
+        char temp[sizeof(local)];
+        ::memcpy(temp, local, sizeof(local));
+        ::memcpy(local, s2.local, sizeof(local));
+        ::memcpy(s2.local, temp, sizeof(local));
+    }
 };
 
 /// equal operator
@@ -347,38 +347,62 @@ public:
 };
 
 /// fast and direct output buffer
+/** output buffer writes to output stream through own buffer or directly to
+ * memory of specified size (then writes are plain stores and flush does nothing) */
 class FastOutputBuffer: public NonCopyableAndNonMovable
 {
 private:
-    std::ostream& os;
-    cxuint endPos;
-    cxuint bufSize;
-    std::unique_ptr<char[]> buffer;
+    std::ostream* os;
+    size_t endPos;
+    size_t bufSize;
+    std::unique_ptr<char[]> bufferHolder;
+    char* buffer;
     uint64_t written;
+    
+    void throwOverflow() const
+    { throw Exception("Output memory is too small"); }
 public:
     /// constructor with inBufSize and output
     /**
      * \param _bufSize max buffer size
      * \param output output stream
      */
-    FastOutputBuffer(cxuint _bufSize, std::ostream& output) : os(output), endPos(0),
-            bufSize(_bufSize), buffer(new char[_bufSize]), written(0)
+    FastOutputBuffer(cxuint _bufSize, std::ostream& output) : os(&output), endPos(0),
+            bufSize(_bufSize), bufferHolder(new char[_bufSize]),
+            buffer(bufferHolder.get()), written(0)
+    { }
+    /// constructor with output memory
+    /**
+     * \param outSize size of output memory
+     * \param outData output memory
+     */
+    FastOutputBuffer(size_t outSize, char* outData) : os(nullptr), endPos(0),
+            bufSize(outSize), buffer(outData), written(0)
     { }
     /// destructor
     ~FastOutputBuffer()
-    { 
-        flush();
-        os.flush();
+    {
+        if (os != nullptr)
+        {
+            flush();
+            os->flush();
+        }
     }
     
     /// get written bytes number
     uint64_t getWritten() const
     { return written; }
     
+    /// return true if output is memory
+    bool isMemoryOutput() const
+    { return os == nullptr; }
+    
     /// write output buffer
     void flush()
     {
-        os.write(buffer.get(), endPos);
+        if (os == nullptr)
+            return; // memory output
+        os->write(buffer, endPos);
         endPos = 0;
     }
     
@@ -386,8 +410,12 @@ public:
     char* reserve(cxuint toReserve)
     {
         if (toReserve > bufSize-endPos)
+        {
+            if (os == nullptr)
+                throwOverflow();
             flush();
-        return buffer.get() + endPos;
+        }
+        return buffer + endPos;
     }
     
     /// finish reservation and go forward
@@ -402,12 +430,14 @@ public:
     {
         if (length > bufSize-endPos)
         {
+            if (os == nullptr)
+                throwOverflow();
             flush();
-            os.write(string, length);
+            os->write(string, length);
         }
         else
         {
-            ::memcpy(buffer.get()+endPos, string, length);
+            ::memcpy(buffer+endPos, string, length);
             endPos += length;
         }
         written += length;
@@ -431,7 +461,11 @@ public:
     void put(char c)
     {
         if (endPos == bufSize)
+        {
+            if (os == nullptr)
+                throwOverflow();
             flush();
+        }
         buffer[endPos++] = c;
         written++;
     }
@@ -439,11 +473,13 @@ public:
     /// fill (put num c character)
     void fill(size_t num, char c)
     {
+        if (os == nullptr && num > bufSize-endPos)
+            throwOverflow();
         size_t count = num;
         while (count != 0)
         {
-             size_t bufNum = std::min(size_t(bufSize-endPos), count);
-             ::memset(buffer.get()+endPos, c, bufNum);
+             size_t bufNum = std::min(bufSize-endPos, count);
+             ::memset(buffer+endPos, c, bufNum);
              count -= bufNum;
              endPos += bufNum;
              if (endPos == bufSize)
@@ -454,10 +490,10 @@ public:
     
     /// get output stream
     const std::ostream& getOStream() const
-    { return os; }
+    { return *os; }
     /// get output stream
     std::ostream& getOStream()
-    { return os; }
+    { return *os; }
 };
 
 };
@@ -32,6 +32,8 @@
 #include <cstdint>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <functional>
 #include <CLRX/utils/Containers.h>
 #include <CLRX/utils/CString.h>
 
@@ -373,6 +375,34 @@ inline cxuint CLZ64(uint64_t v)
 #endif
 }
 
+/// counts trailing zeroes for 32-bit unsigned integer. For zero behavior is undefined
+inline cxuint CTZ32(uint32_t v);
+
+inline cxuint CTZ32(uint32_t v)
+{
+#ifdef __GNUC__
+    return __builtin_ctz(v);
+#else
+    cxuint count = 0;
+    for (uint32_t t = 1U; (t & v) == 0; t<<=1, count++);
+    return count;
+#endif
+}
+
+/// counts trailing zeroes for 64-bit unsigned integer. For zero behavior is undefined
+inline cxuint CTZ64(uint64_t v);
+
+inline cxuint CTZ64(uint64_t v)
+{
+#ifdef __GNUC__
+    return __builtin_ctzll(v);
+#else
+    cxuint count = 0;
+    for (uint64_t t = 1ULL; (t & v) == 0; t<<=1, count++);
+    return count;
+#endif
+}
+
 /// safely compares sum of two unsigned integers with other unsigned integer
 template<typename T, typename T2>
 inline bool usumGt(T a, T b, T2 c)
@@ -704,6 +734,43 @@ extern bool isFileExists(const char* path);
  */
 extern Array<cxbyte> loadDataFromFile(const char* filename);
 
+/// read-only memory mapped file
+/** maps whole regular file into memory. Mapping fails for non-regular files
+ * (pipes, devices, directories), thus caller should use streams for these files */
+class MemoryMappedFile: public NonCopyableAndNonMovable
+{
+private:
+    const cxbyte* data;
+    size_t size;
+    bool mapped;
+#ifdef HAVE_WINDOWS
+    void* fileHandle;
+    void* mapHandle;
+#endif
+public:
+    /// empty constructor
+    MemoryMappedFile();
+    /// constructor - maps file (throws Exception if failed)
+    explicit MemoryMappedFile(const char* filename);
+    /// destructor
+    ~MemoryMappedFile();
+
+    /// map file (throws Exception if failed)
+    void map(const char* filename);
+    /// unmap file
+    void unmap();
+
+    /// get mapped data (null if file is empty)
+    const cxbyte* getData() const
+    { return data; }
+    /// get size of mapped data
+    size_t getSize() const
+    { return size; }
+    /// returns true if mapped
+    bool isMapped() const
+    { return mapped; }
+};
+
 /// convert to filesystem from unified path (with slashes)
 extern void filesystemPath(char* path);
 /// convert to filesystem from unified path (with slashes)
@@ -714,6 +781,12 @@ extern std::string joinPaths(const std::string& path1, const std::string& path2)
 
 /// get file timestamp in nanosecond since Unix epoch
 extern uint64_t getFileTimestamp(const char* filename);
+/// get size of file in bytes
+extern uint64_t getFileSize(const char* filename);
+/// set modification time of file to current time
+extern void touchFile(const char* filename);
+/// list names of directory entries (without '.' and '..')
+extern std::vector<std::string> listDirectory(const char* dirname);
 
 /// get user's home directory
 extern std::string getHomeDir();
@@ -856,6 +929,10 @@ public:
     T* operator->() const
     { return ptr; }
     
+    /// get pointer
+    T* get() const
+    { return ptr; }
+    
     /// reset refpointer
     void reset()
     {
@@ -958,6 +1035,24 @@ inline void toUpperString(CString& string)
 { if (!string.empty())
     toUpperString(string.begin()); }
 
+/* parallel processing */
+
+/// get number of hardware threads (at least one)
+extern cxuint getHardwareThreadsNum();
+
+/// call function for every index from 0 to n-1 in specified number of threads
+/**
+ * \param n number of items
+ * \param threadsNum number of threads (0 - number of hardware threads, 1 - serial)
+ * \param func function called with index of item
+ *
+ * Items are taken by threads in increasing order. If function throws exceptions,
+ * then exception thrown for item with lowest index is rethrown after finishing
+ * all threads. Serial call stops at first exception.
+ */
+extern void parallelFor(size_t n, cxuint threadsNum,
+            const std::function<void(size_t)>& func);
+
 /* CALL once */
 
 #ifdef HAVE_CALL_ONCE
@@ -979,8 +1074,27 @@ struct OnceFlag: std::atomic<int>
 template<class Callable, class... Args>
 inline void callOnce(OnceFlag& flag, Callable&& f, Args&&... args)
 {
-    if (flag.exchange(1) == 0)
-        f(args...);
+    // 0 - not called, 1 - during call, 2 - called
+    while (true)
+    {
+        int expected = 0;
+        if (flag.compare_exchange_strong(expected, 1))
+        {
+            try
+            { f(args...); }
+            catch(...)
+            {
+                flag.store(0); // next call can retry
+                throw;
+            }
+            flag.store(2);
+            return;
+        }
+        if (expected == 2)
+            return;
+        // wait until other thread finishes call (shared data must be ready)
+        std::this_thread::yield();
+    }
 }
 #endif
 
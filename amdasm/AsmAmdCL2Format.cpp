@@ -34,8 +34,11 @@
 
 using namespace CLRX;
 
+namespace CLRX
+{
+
 // all AmdCL2 pseudo-op names (sorted)
-static const char* amdCL2PseudoOpNamesTbl[] =
+const char* amdCL2PseudoOpNamesTbl[] =
 {
     "acl_version", "arch_minor", "arch_stepping",
     "arg", "bssdata", "call_convention", "codeversion",
@@ -71,6 +74,10 @@ static const char* amdCL2PseudoOpNamesTbl[] =
     "workitem_vgpr_count"
 };
 
+const size_t amdCL2PseudoOpNamesNum = sizeof(amdCL2PseudoOpNamesTbl)/sizeof(char*);
+
+}
+
 // all enums for AmdCL2 pseudo-ops
 enum
 {
@@ -404,16 +411,6 @@ AsmFormatHandler::SectionInfo AsmAmdCL2Handler::getSectionInfo(cxuint sectionId)
 namespace CLRX
 {
 
-bool AsmAmdCL2PseudoOps::checkPseudoOpName(const CString& string)
-{
-    if (string.empty() || string[0] != '.')
-        return false;
-    const size_t pseudoOp = binaryFind(amdCL2PseudoOpNamesTbl, amdCL2PseudoOpNamesTbl +
-                sizeof(amdCL2PseudoOpNamesTbl)/sizeof(char*), string.c_str()+1,
-               CStringLess()) - amdCL2PseudoOpNamesTbl;
-    return pseudoOp < sizeof(amdCL2PseudoOpNamesTbl)/sizeof(char*);
-}
-
 void AsmAmdCL2PseudoOps::setAclVersion(AsmAmdCL2Handler& handler, const char* linePtr)
 {
     Assembler& asmr = handler.assembler;
@@ -1435,9 +1432,9 @@ void AsmAmdCL2PseudoOps::doConfig(AsmAmdCL2Handler& handler, const char* pseudoO
 bool AsmAmdCL2Handler::parsePseudoOp(const CString& firstName,
        const char* stmtPlace, const char* linePtr)
 {
-    const size_t pseudoOp = binaryFind(amdCL2PseudoOpNamesTbl, amdCL2PseudoOpNamesTbl +
-                    sizeof(amdCL2PseudoOpNamesTbl)/sizeof(char*), firstName.c_str()+1,
-                   CStringLess()) - amdCL2PseudoOpNamesTbl;
+    const AsmPseudoOpEntry* entry = AsmPseudoOps::findPseudoOp(firstName);
+    const size_t pseudoOp = (entry != nullptr) ?
+                entry->formatOps[ASMPOPFMT_AMDCL2] : ASMPOP_NONE;
     
     switch(pseudoOp)
     {
@@ -108,9 +108,13 @@ enum AmdCL2ConfigValueTarget
     AMDCL2CVAL_PGMRSRC2 = AMDCL2CVAL_HSA_PGMRSRC2
 };
 
+/// all AmdCL2 pseudo-op names (sorted)
+extern CLRX_INTERNAL const char* amdCL2PseudoOpNamesTbl[];
+/// number of AmdCL2 pseudo-op names
+extern CLRX_INTERNAL const size_t amdCL2PseudoOpNamesNum;
+
 struct CLRX_INTERNAL AsmAmdCL2PseudoOps: AsmPseudoOps
 {
-    static bool checkPseudoOpName(const CString& string);
     
     // .arch_minor
     static void setArchMinor(AsmAmdCL2Handler& handler, const char* linePtr);
@@ -31,8 +31,11 @@
 
 using namespace CLRX;
 
+namespace CLRX
+{
+
 // all AMD Catalyst pseudo-op names (sorted)
-static const char* amdPseudoOpNamesTbl[] =
+const char* amdPseudoOpNamesTbl[] =
 {
     "arg", "boolconsts", "calnote", "cbid",
     "cbmask", "compile_options", "condout", "config",
@@ -50,6 +53,10 @@ static const char* amdPseudoOpNamesTbl[] =
     "useprintf", "userdata", "vgprsnum"
 };
 
+const size_t amdPseudoOpNamesNum = sizeof(amdPseudoOpNamesTbl)/sizeof(char*);
+
+}
+
 // all AMD Catalyst pseudo-op names (sorted)
 enum
 {
@@ -289,16 +296,6 @@ AsmFormatHandler::SectionInfo AsmAmdHandler::getSectionInfo(cxuint sectionId) co
 namespace CLRX
 {
 
-bool AsmAmdPseudoOps::checkPseudoOpName(const CString& string)
-{
-    if (string.empty() || string[0] != '.')
-        return false;
-    const size_t pseudoOp = binaryFind(amdPseudoOpNamesTbl, amdPseudoOpNamesTbl +
-                sizeof(amdPseudoOpNamesTbl)/sizeof(char*), string.c_str()+1,
-               CStringLess()) - amdPseudoOpNamesTbl;
-    return pseudoOp < sizeof(amdPseudoOpNamesTbl)/sizeof(char*);
-}
-
 void AsmAmdPseudoOps::setCompileOptions(AsmAmdHandler& handler, const char* linePtr)
 {
     Assembler& asmr = handler.assembler;
@@ -1503,9 +1500,9 @@ void AsmAmdPseudoOps::doArg(AsmAmdHandler& handler, const char* pseudoOpPlace,
 bool AsmAmdHandler::parsePseudoOp(const CString& firstName,
        const char* stmtPlace, const char* linePtr)
 {
-    const size_t pseudoOp = binaryFind(amdPseudoOpNamesTbl, amdPseudoOpNamesTbl +
-                    sizeof(amdPseudoOpNamesTbl)/sizeof(char*), firstName.c_str()+1,
-                   CStringLess()) - amdPseudoOpNamesTbl;
+    const AsmPseudoOpEntry* entry = AsmPseudoOps::findPseudoOp(firstName);
+    const size_t pseudoOp = (entry != nullptr) ?
+                entry->formatOps[ASMPOPFMT_AMD] : ASMPOP_NONE;
     
     switch(pseudoOp)
     {
@@ -57,9 +57,13 @@ enum AmdConfigValueTarget
     AMDCVAL_EXCEPTIONS
 };
 
+/// all AMD Catalyst pseudo-op names (sorted)
+extern CLRX_INTERNAL const char* amdPseudoOpNamesTbl[];
+/// number of AMD Catalyst pseudo-op names
+extern CLRX_INTERNAL const size_t amdPseudoOpNamesNum;
+
 struct CLRX_INTERNAL AsmAmdPseudoOps: AsmPseudoOps
 {
-    static bool checkPseudoOpName(const CString& string);
     // .global_data (go to global data)
     static void doGlobalData(AsmAmdHandler& handler, const char* pseudoOpPlace,
                       const char* linePtr);
@@ -0,0 +1,826 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <iterator>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/MemAccess.h>
+#include <CLRX/amdasm/AsmCache.h>
+#include "AsmMacroLibInternals.h"
+
+using namespace CLRX;
+
+/*
+ * AsmCacheHasher
+ */
+
+static inline uint64_t rotl64(uint64_t v, cxuint s)
+{ return (v<<s) | (v>>(64-s)); }
+
+static inline uint64_t fmix64(uint64_t k)
+{
+    k ^= k>>33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k>>33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k>>33;
+    return k;
+}
+
+static const uint64_t hashC1 = 0x87c37b91114253d5ULL;
+static const uint64_t hashC2 = 0x4cf5ad432745937fULL;
+
+std::string AsmCacheHash::toString() const
+{
+    char buf[33];
+    for (cxuint i = 0; i < 32; i++)
+    {
+        const cxuint digit = ((i < 16 ? hi : lo) >> (60-(i&15)*4)) & 15;
+        buf[i] = (digit < 10) ? '0'+digit : 'a'+digit-10;
+    }
+    buf[32] = 0;
+    return buf;
+}
+
+AsmCacheHasher::AsmCacheHasher() : h1(0x9368e53c2f6af274ULL), h2(0x586dcd208f7cd3fdULL),
+        length(0), tailSize(0)
+{ }
+
+void AsmCacheHasher::processWord(uint64_t word)
+{
+    // two independent lanes (MurmurHash3-like mixing)
+    h1 ^= rotl64(word*hashC1, 31)*hashC2;
+    h1 = rotl64(h1, 27)*5 + 0x52dce729;
+    h2 ^= rotl64(word*hashC2, 33)*hashC1;
+    h2 = rotl64(h2, 31)*5 + 0x38495ab5;
+}
+
+void AsmCacheHasher::update(size_t size, const void* data)
+{
+    const cxbyte* p = reinterpret_cast<const cxbyte*>(data);
+    const cxbyte* end = p + size;
+    length += size;
+    if (tailSize != 0)
+    {
+        // fill tail by data
+        while (tailSize < 8 && p != end)
+            tail[tailSize++] = *p++;
+        if (tailSize < 8)
+            return;
+        processWord(ULEV(*reinterpret_cast<const uint64_t*>(tail)));
+        tailSize = 0;
+    }
+    for (; end-p >= 8; p += 8)
+        processWord(ULEV(*reinterpret_cast<const uint64_t*>(p)));
+    while (p != end)
+        tail[tailSize++] = *p++;
+}
+
+void AsmCacheHasher::update(const CString& str)
+{
+    updateValue(str.size());
+    update(str.size(), str.c_str());
+}
+
+void AsmCacheHasher::updateValue(uint64_t value)
+{
+    cxbyte buf[8];
+    for (cxuint i = 0; i < 8; i++)
+        buf[i] = value>>(i*8);
+    update(8, buf);
+}
+
+AsmCacheHash AsmCacheHasher::finish() const
+{
+    uint64_t f1 = h1, f2 = h2;
+    uint64_t last = 0;
+    for (cxuint i = 0; i < tailSize; i++)
+        last |= uint64_t(tail[i])<<(i*8);
+    f1 ^= rotl64(last*hashC1, 31)*hashC2;
+    f2 ^= rotl64(last*hashC2, 33)*hashC1;
+    f1 ^= length;
+    f2 ^= length;
+    f1 += f2;
+    f2 += f1;
+    f1 = fmix64(f1);
+    f2 = fmix64(f2);
+    f1 += f2;
+    f2 += f1;
+    return { f1, f2 };
+}
+
+AsmCacheHash AsmCacheHasher::hash(size_t size, const void* data)
+{
+    AsmCacheHasher hasher;
+    hasher.update(size, data);
+    return hasher.finish();
+}
+
+/*
+ * AsmCacheDependency
+ */
+
+bool AsmCacheDependency::isUpToDate() const
+{
+    if (!exists)
+        return !isFileExists(path.c_str());
+    try
+    {
+        MemoryMappedFile mappedFile(path.c_str());
+        return AsmCacheHasher::hash(mappedFile.getSize(), mappedFile.getData()) == hash;
+    }
+    catch(const Exception& ex)
+    { return false; }
+}
+
+/*
+ * AsmCache
+ */
+
+static const char asmCacheMagic[8] = { 'C', 'L', 'R', 'X', 'A', 'S', 'M', 'C' };
+static const uint32_t asmCacheVersion = 1;
+
+static void putCacheValue(std::string& out, uint64_t value)
+{
+    for (cxuint i = 0; i < 8; i++)
+        out.push_back(char(value>>(i*8)));
+}
+
+static void putCacheData(std::string& out, size_t size, const void* data)
+{
+    putCacheValue(out, size);
+    out.append(reinterpret_cast<const char*>(data), size);
+}
+
+static uint64_t getCacheValue(const cxbyte*& p, const cxbyte* end)
+{
+    if (end-p < 8)
+        throw Exception("Cache entry is truncated");
+    uint64_t value = 0;
+    for (cxuint i = 0; i < 8; i++)
+        value |= uint64_t(p[i])<<(i*8);
+    p += 8;
+    return value;
+}
+
+static const cxbyte* getCacheData(const cxbyte*& p, const cxbyte* end, size_t& size)
+{
+    const uint64_t dataSize = getCacheValue(p, end);
+    if (dataSize > uint64_t(end-p))
+        throw Exception("Cache entry is truncated");
+    const cxbyte* data = p;
+    size = dataSize;
+    p += dataSize;
+    return data;
+}
+
+AsmCache::AsmCache(const CString& _directory, uint64_t _maxSize)
+        : directory(_directory.c_str()), maxSize(_maxSize)
+{
+    filesystemPath(directory);
+    if (!isFileExists(directory.c_str()))
+    {
+        try
+        { makeDir(directory.c_str()); }
+        catch(const Exception& ex)
+        {
+            // directory can be created by other process in this time
+            if (!isFileExists(directory.c_str()))
+                throw;
+        }
+    }
+    if (!isDirectory(directory.c_str()))
+        throw Exception("Cache path is not directory");
+}
+
+std::string AsmCache::getEntryPath(const AsmCacheHash& key) const
+{
+    return joinPaths(directory, key.toString()+".cache");
+}
+
+bool AsmCache::readEntry(const AsmCacheHash& key, Array<cxbyte>& data) const
+{
+    const std::string path = getEntryPath(key);
+    if (!isFileExists(path.c_str()))
+        return false;
+    try
+    { data = loadDataFromFile(path.c_str()); }
+    catch(const Exception& ex)
+    { return false; } // removed by other process
+    return true;
+}
+
+void AsmCache::touchEntry(const AsmCacheHash& key) const
+{
+    // mark as recently used
+    try
+    { touchFile(getEntryPath(key).c_str()); }
+    catch(const Exception& ex)
+    { }
+}
+
+bool AsmCache::load(const AsmCacheHash& key, AsmCacheEntry& entry) const
+{
+    Array<cxbyte> data;
+    if (!readEntry(key, data))
+        return false;
+    try
+    {
+        const cxbyte* p = data.data();
+        const cxbyte* end = data.data() + data.size();
+        if (data.size() < 12 || ::memcmp(p, asmCacheMagic, 8) != 0 ||
+            ULEV(*reinterpret_cast<const uint32_t*>(p+8)) != asmCacheVersion)
+            return false; // not cache entry or other version
+        p += 12;
+        size_t size;
+        const uint64_t depsNum = getCacheValue(p, end);
+        if (depsNum > uint64_t(end-p))
+            return false;
+        entry.dependencies.resize(depsNum);
+        for (AsmCacheDependency& dep: entry.dependencies)
+        {
+            const cxbyte* pathData = getCacheData(p, end, size);
+            dep.path = CString((const char*)pathData, size);
+            dep.exists = getCacheValue(p, end) != 0;
+            dep.hash.lo = getCacheValue(p, end);
+            dep.hash.hi = getCacheValue(p, end);
+        }
+        const cxbyte* messages = getCacheData(p, end, size);
+        entry.messages.assign((const char*)messages, size);
+        const cxbyte* printed = getCacheData(p, end, size);
+        entry.printed.assign((const char*)printed, size);
+        const cxbyte* binary = getCacheData(p, end, size);
+        entry.binary.assign(binary, binary + size);
+    }
+    catch(const Exception& ex)
+    { return false; }
+
+    for (const AsmCacheDependency& dep: entry.dependencies)
+        if (!dep.isUpToDate())
+            return false;
+    touchEntry(key);
+    return true;
+}
+
+void AsmCache::store(const AsmCacheHash& key, const AsmCacheEntry& entry) const
+{
+    std::string out(asmCacheMagic, 8);
+    for (cxuint i = 0; i < 4; i++)
+        out.push_back(char(asmCacheVersion>>(i*8)));
+    putCacheValue(out, entry.dependencies.size());
+    for (const AsmCacheDependency& dep: entry.dependencies)
+    {
+        putCacheData(out, dep.path.size(), dep.path.c_str());
+        putCacheValue(out, dep.exists);
+        putCacheValue(out, dep.hash.lo);
+        putCacheValue(out, dep.hash.hi);
+    }
+    putCacheData(out, entry.messages.size(), entry.messages.data());
+    putCacheData(out, entry.printed.size(), entry.printed.data());
+    putCacheData(out, entry.binary.size(), entry.binary.data());
+    storeData(key, out);
+}
+
+bool AsmCache::loadData(const AsmCacheHash& key, Array<cxbyte>& data) const
+{
+    if (!readEntry(key, data))
+        return false;
+    touchEntry(key);
+    return true;
+}
+
+void AsmCache::storeData(const AsmCacheHash& key, const std::string& data) const
+{
+    /* write to temporary file and rename it to entry, hence other assemblers
+     * never read partially written entry */
+    const std::string path = getEntryPath(key);
+    const uint64_t tempId = std::chrono::steady_clock::now().time_since_epoch().count() ^
+            std::hash<std::thread::id>()(std::this_thread::get_id());
+    const std::string tempPath = path + ".tmp" +
+            AsmCacheHash{ tempId, 0 }.toString().substr(16);
+    {
+        std::ofstream ofs(tempPath.c_str(), std::ios::binary);
+        if (!ofs)
+            throw Exception("Can't create cache entry");
+        ofs.write(data.data(), data.size());
+        if (!ofs)
+        {
+            ofs.close();
+            std::remove(tempPath.c_str());
+            throw Exception("Can't write cache entry");
+        }
+    }
+#ifdef HAVE_WINDOWS
+    std::remove(path.c_str());
+#endif
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        throw Exception("Can't store cache entry");
+    }
+    evict();
+}
+
+void AsmCache::evict() const
+{
+    struct EntryFile
+    {
+        std::string path;
+        uint64_t timestamp;
+        uint64_t size;
+    };
+    std::vector<EntryFile> entries;
+    uint64_t totalSize = 0;
+    for (const std::string& name: listDirectory(directory.c_str()))
+    {
+        if (name.size() < 6 || name.compare(name.size()-6, 6, ".cache") != 0)
+            continue; // not cache entry
+        EntryFile entry;
+        entry.path = joinPaths(directory, name);
+        try
+        {
+            entry.timestamp = getFileTimestamp(entry.path.c_str());
+            entry.size = getFileSize(entry.path.c_str());
+        }
+        catch(const Exception& ex)
+        { continue; } // removed by other process
+        totalSize += entry.size;
+        entries.push_back(entry);
+    }
+    if (totalSize <= maxSize)
+        return;
+    // remove least recently used entries
+    std::sort(entries.begin(), entries.end(), [](const EntryFile& a, const EntryFile& b)
+            { return a.timestamp < b.timestamp; });
+    for (const EntryFile& entry: entries)
+    {
+        if (totalSize <= maxSize)
+            break;
+        std::remove(entry.path.c_str());
+        totalSize -= entry.size;
+    }
+}
+
+/*
+ * AsmIncludeCache
+ */
+
+/* layout of persistent snapshots of included file:
+ * magic and version, table of sources and macro substitutions (same as in macro
+ * library), snapshots (incoming state, changes and compiled macros).
+ * All integers are stored as LEB128 values */
+
+static const char asmIncludeCacheMagic[8] = { 'C', 'L', 'R', 'X', 'A', 'S', 'M', 'I' };
+static const uint32_t asmIncludeCacheVersion = 1;
+
+static void putIncludeSettings(std::string& out, const AsmIncludeSettings& settings)
+{
+    putLibValue(out, cxuint(settings.format));
+    putLibValue(out, cxuint(settings.deviceType));
+    putLibValue(out, settings._64bit);
+    putLibValue(out, settings.flags);
+    putLibValue(out, (settings.alternateMacro ? 1 : 0) | (settings.buggyFPLit ? 2 : 0) |
+            (settings.macroCase ? 4 : 0) | (settings.oldModParam ? 8 : 0));
+}
+
+static AsmIncludeSettings getIncludeSettings(const cxbyte*& p, const cxbyte* end)
+{
+    AsmIncludeSettings settings;
+    settings.format = BinaryFormat(getLibValue(p, end));
+    settings.deviceType = GPUDeviceType(getLibValue(p, end));
+    settings._64bit = getLibValue(p, end) != 0;
+    settings.flags = getLibValue(p, end);
+    const uint64_t bools = getLibValue(p, end);
+    settings.alternateMacro = (bools&1) != 0;
+    settings.buggyFPLit = (bools&2) != 0;
+    settings.macroCase = (bools&4) != 0;
+    settings.oldModParam = (bools&8) != 0;
+    return settings;
+}
+
+static void putIncludeSymbols(std::string& out,
+            const std::vector<AsmIncludeSnapshot::Symbol>& symbols)
+{
+    putLibValue(out, symbols.size());
+    for (const AsmIncludeSnapshot::Symbol& symbol: symbols)
+    {
+        const AsmIncludeSymbolState& state = symbol.second;
+        putLibString(out, symbol.first);
+        putLibValue(out, (state.exists ? 1 : 0) | (state.hasValue ? 2 : 0) |
+                (state.complex ? 4 : 0) | (state.pending ? 8 : 0) |
+                (state.onceDefined ? 16 : 0));
+        putLibValue(out, state.info);
+        putLibValue(out, state.other);
+        putLibValue(out, state.sectionId);
+        putLibValue(out, state.value);
+        putLibValue(out, state.size);
+    }
+}
+
+static void getIncludeSymbols(const cxbyte*& p, const cxbyte* end,
+            std::vector<AsmIncludeSnapshot::Symbol>& symbols)
+{
+    symbols.resize(getLibSize(p, end));
+    for (AsmIncludeSnapshot::Symbol& symbol: symbols)
+    {
+        AsmIncludeSymbolState& state = symbol.second;
+        symbol.first = getLibString(p, end);
+        const uint64_t bools = getLibValue(p, end);
+        state.exists = (bools&1) != 0;
+        state.hasValue = (bools&2) != 0;
+        state.complex = (bools&4) != 0;
+        state.pending = (bools&8) != 0;
+        state.onceDefined = (bools&16) != 0;
+        state.info = getLibValue(p, end);
+        state.other = getLibValue(p, end);
+        state.sectionId = getLibValue(p, end);
+        state.value = getLibValue(p, end);
+        state.size = getLibValue(p, end);
+    }
+}
+
+// origins of macros are known only in this process
+static bool isPersistentSnapshot(const AsmIncludeSnapshot& snapshot)
+{
+    for (const AsmIncludeSnapshot::Macro& macro: snapshot.macroReads)
+        if (macro.second)
+            return false;
+    return true;
+}
+
+AsmIncludeCache::AsmIncludeCache(size_t _maxSnapshots, const AsmCache* _persistentCache)
+        : maxSnapshots(_maxSnapshots), persistentCache(_persistentCache),
+          hitsNum(0), storesNum(0)
+{ }
+
+bool AsmIncludeCache::getFileHash(const std::string& path, AsmCacheHash& hash)
+{
+    uint64_t timestamp, size;
+    try
+    {
+        timestamp = getFileTimestamp(path.c_str());
+        size = getFileSize(path.c_str());
+    }
+    catch(const Exception& ex)
+    { return false; }
+    
+    auto it = files.find(path);
+    if (it != files.end() && it->second.timestamp == timestamp &&
+        it->second.size == size)
+    {
+        // file is not changed since last hashing
+        hash = it->second.hash;
+        return true;
+    }
+    try
+    {
+        MemoryMappedFile mappedFile(path.c_str());
+        hash = AsmCacheHasher::hash(mappedFile.getSize(), mappedFile.getData());
+    }
+    catch(const Exception& ex)
+    { return false; } // content of pipes and devices can't be verified later
+    
+    FileEntry& entry = files[path];
+    entry.timestamp = timestamp;
+    entry.size = size;
+    if (entry.hash != hash)
+    {
+        // snapshots of old content are useless
+        entry.snapshots.clear();
+        entry.persistentLoaded = false;
+    }
+    entry.hash = hash;
+    return true;
+}
+
+bool AsmIncludeCache::isUpToDate(const AsmCacheDependency& dep)
+{
+    if (!dep.exists)
+        return !isFileExists(dep.path.c_str());
+    AsmCacheHash hash;
+    return getFileHash(dep.path.c_str(), hash) && hash == dep.hash;
+}
+
+AsmCacheHash AsmIncludeCache::getPersistentKey(const std::string& path,
+            const FileEntry& entry) const
+{
+    AsmCacheHasher hasher;
+    hasher.update(CString("includeSnapshots"));
+    hasher.update(CString(path.c_str()));
+    hasher.updateValue(entry.hash.lo);
+    hasher.updateValue(entry.hash.hi);
+    return hasher.finish();
+}
+
+void AsmIncludeCache::loadPersistentSnapshots(const std::string& path,
+            FileEntry& entry) const
+{
+    Array<cxbyte> data;
+    if (!persistentCache->loadData(getPersistentKey(path, entry), data))
+        return;
+    std::vector<AsmIncludeSnapshot> snapshots;
+    try
+    {
+        const cxbyte* p = data.data();
+        const cxbyte* end = data.data() + data.size();
+        if (data.size() < 12 || ::memcmp(p, asmIncludeCacheMagic, 8) != 0 ||
+            ULEV(*reinterpret_cast<const uint32_t*>(p+8)) != asmIncludeCacheVersion)
+            return; // not snapshots or other version
+        p += 12;
+        AsmMacroLibNodeReader nodeReader;
+        const size_t nodesNum = getLibValue(p, end);
+        const size_t nodesSize = getLibSize(p, end);
+        const cxbyte* nodesData = p;
+        nodeReader.readNodes(nodesData, p + nodesSize, nodesNum,
+                    RefPtr<const AsmSource>(), 0, 0);
+        p += nodesSize;
+        
+        snapshots.resize(getLibSize(p, end));
+        for (AsmIncludeSnapshot& snapshot: snapshots)
+        {
+            snapshot.hash.lo = getLibValue(p, end);
+            snapshot.hash.hi = getLibValue(p, end);
+            snapshot.settings = getIncludeSettings(p, end);
+            snapshot.includeDirs.resize(getLibSize(p, end));
+            for (CString& includeDir: snapshot.includeDirs)
+                includeDir = getLibString(p, end);
+            snapshot.withCounters = getLibValue(p, end) != 0;
+            snapshot.macroCount = getLibValue(p, end);
+            snapshot.localCount = getLibValue(p, end);
+            snapshot.dependencies.resize(getLibSize(p, end));
+            for (AsmCacheDependency& dep: snapshot.dependencies)
+            {
+                dep.path = getLibString(p, end);
+                dep.exists = getLibValue(p, end) != 0;
+                dep.hash.lo = getLibValue(p, end);
+                dep.hash.hi = getLibValue(p, end);
+            }
+            getIncludeSymbols(p, end, snapshot.symbolReads);
+            // only undefined macros are read by stored snapshots
+            snapshot.macroReads.resize(getLibSize(p, end));
+            for (AsmIncludeSnapshot::Macro& macro: snapshot.macroReads)
+                macro.first = getLibString(p, end);
+            
+            snapshot.source = nodeReader.readSource(p, end);
+            snapshot.newSettings = getIncludeSettings(p, end);
+            snapshot.newMacroCount = getLibValue(p, end);
+            snapshot.newLocalCount = getLibValue(p, end);
+            getIncludeSymbols(p, end, snapshot.symbols);
+            snapshot.macros.resize(getLibSize(p, end));
+            for (AsmIncludeSnapshot::Macro& macro: snapshot.macros)
+            {
+                macro.first = getLibString(p, end);
+                macro.second = nodeReader.readMacro(p, end);
+            }
+            if (snapshot.hash != entry.hash ||
+                (!snapshot.source && !snapshot.macros.empty()))
+                return; // corrupted
+        }
+        if (p != end)
+            return;
+    }
+    catch(const Exception& ex)
+    { return; }
+    
+    // loaded snapshots are older than recorded by this cache
+    snapshots.insert(snapshots.end(), std::make_move_iterator(entry.snapshots.begin()),
+                std::make_move_iterator(entry.snapshots.end()));
+    if (snapshots.size() > maxSnapshots)
+        snapshots.erase(snapshots.begin(), snapshots.end() - maxSnapshots);
+    entry.snapshots = std::move(snapshots);
+}
+
+void AsmIncludeCache::storePersistentSnapshots(const std::string& path,
+            const FileEntry& entry) const
+{
+    AsmMacroLibNodeWriter nodeWriter;
+    std::string snapshotsData;
+    size_t snapshotsNum = 0;
+    for (const AsmIncludeSnapshot& snapshot: entry.snapshots)
+    {
+        if (!isPersistentSnapshot(snapshot))
+            continue;
+        snapshotsNum++;
+        putLibValue(snapshotsData, snapshot.hash.lo);
+        putLibValue(snapshotsData, snapshot.hash.hi);
+        putIncludeSettings(snapshotsData, snapshot.settings);
+        putLibValue(snapshotsData, snapshot.includeDirs.size());
+        for (const CString& includeDir: snapshot.includeDirs)
+            putLibString(snapshotsData, includeDir);
+        putLibValue(snapshotsData, snapshot.withCounters);
+        putLibValue(snapshotsData, snapshot.macroCount);
+        putLibValue(snapshotsData, snapshot.localCount);
+        putLibValue(snapshotsData, snapshot.dependencies.size());
+        for (const AsmCacheDependency& dep: snapshot.dependencies)
+        {
+            putLibString(snapshotsData, dep.path);
+            putLibValue(snapshotsData, dep.exists);
+            putLibValue(snapshotsData, dep.hash.lo);
+            putLibValue(snapshotsData, dep.hash.hi);
+        }
+        putIncludeSymbols(snapshotsData, snapshot.symbolReads);
+        putLibValue(snapshotsData, snapshot.macroReads.size());
+        for (const AsmIncludeSnapshot::Macro& macro: snapshot.macroReads)
+            putLibString(snapshotsData, macro.first);
+        
+        putLibValue(snapshotsData, nodeWriter.putSource(snapshot.source.get()));
+        putIncludeSettings(snapshotsData, snapshot.newSettings);
+        putLibValue(snapshotsData, snapshot.newMacroCount);
+        putLibValue(snapshotsData, snapshot.newLocalCount);
+        putIncludeSymbols(snapshotsData, snapshot.symbols);
+        putLibValue(snapshotsData, snapshot.macros.size());
+        for (const AsmIncludeSnapshot::Macro& macro: snapshot.macros)
+        {
+            putLibString(snapshotsData, macro.first);
+            nodeWriter.putMacro(snapshotsData, *macro.second.get());
+        }
+    }
+    if (snapshotsNum == 0)
+        return;
+    
+    std::string out(asmIncludeCacheMagic, 8);
+    for (cxuint i = 0; i < 4; i++)
+        out.push_back(char(asmIncludeCacheVersion>>(i*8)));
+    putLibValue(out, nodeWriter.getNodesNum());
+    putLibValue(out, nodeWriter.getOutput().size());
+    out.append(nodeWriter.getOutput());
+    putLibValue(out, snapshotsNum);
+    out.append(snapshotsData);
+    persistentCache->storeData(getPersistentKey(path, entry), out);
+}
+
+const std::vector<AsmIncludeSnapshot>* AsmIncludeCache::getSnapshots(
+            const std::string& path)
+{
+    auto it = files.find(path);
+    if (it == files.end())
+        return nullptr;
+    if (persistentCache != nullptr && !it->second.persistentLoaded)
+    {
+        loadPersistentSnapshots(path, it->second);
+        it->second.persistentLoaded = true;
+    }
+    return &it->second.snapshots;
+}
+
+void AsmIncludeCache::addSnapshot(const std::string& path, AsmIncludeSnapshot&& snapshot)
+{
+    auto it = files.find(path);
+    if (it == files.end() || it->second.hash != snapshot.hash)
+        return; // file has been changed while assembling
+    if (maxSnapshots == 0)
+        return;
+    // stored snapshots must not be lost while storing new snapshot
+    getSnapshots(path);
+    std::vector<AsmIncludeSnapshot>& snapshots = it->second.snapshots;
+    if (snapshots.size() >= maxSnapshots)
+        // remove oldest snapshot
+        snapshots.erase(snapshots.begin());
+    const bool persistent = isPersistentSnapshot(snapshot);
+    snapshots.push_back(std::move(snapshot));
+    storesNum++;
+    if (persistentCache != nullptr && persistent)
+    {
+        try
+        { storePersistentSnapshots(path, it->second); }
+        catch(const Exception& ex)
+        { } // snapshot is still available in memory
+    }
+}
+
+void AsmIncludeCache::clear()
+{
+    files.clear();
+}
+
+/*
+ * AsmIncludeDirCache
+ */
+
+AsmIncludeDirCache::AsmIncludeDirCache() : lookupsNum(0), listingsNum(0)
+{ }
+
+// file systems with low timestamp resolution can hide changes made just after listing
+static const uint64_t racyDirTimeNs = 2000000000ULL;
+
+void AsmIncludeDirCache::listDir(const std::string& dirPath, DirEntry& entry)
+{
+    entry.listed = true;
+    entry.racy = false;
+    entry.timestamp = 0;
+    entry.names.clear();
+    try
+    { entry.timestamp = getFileTimestamp(dirPath.c_str()); }
+    catch(const Exception& ex)
+    { return; } // no directory: no files
+    try
+    {
+        for (std::string& name: listDirectory(dirPath.c_str()))
+        {
+#ifdef HAVE_WINDOWS
+            toLowerString(name);
+#endif
+            entry.names.insert(std::move(name));
+        }
+    }
+    catch(const Exception& ex)
+    {
+        // directory can not be listed, but files can be opened
+        entry.listed = false;
+        return;
+    }
+    const uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    entry.racy = (now < entry.timestamp + racyDirTimeNs);
+}
+
+bool AsmIncludeDirCache::mayContain(const std::string& dirPath,
+            const std::string& filename, bool revalidate, bool& listed)
+{
+    listed = false;
+    // absolute paths doesn't depend on directory
+    if (filename.empty() || filename[0] == CLRX_NATIVE_DIR_SEP
+#ifdef HAVE_WINDOWS
+        || (filename.size() >= 2 && filename[1] == ':')
+#endif
+        )
+        return true;
+    // only first component of path is checked in listing
+    std::string name = filename.substr(0, filename.find(CLRX_NATIVE_DIR_SEP));
+    if (name == "." || name == "..")
+        return true;
+#ifdef HAVE_WINDOWS
+    toLowerString(name);
+#endif
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    lookupsNum++;
+    auto res = dirs.insert(std::make_pair(dirPath, DirEntry()));
+    DirEntry& entry = res.first->second;
+    bool doList = res.second;
+    if (!doList && revalidate)
+    {
+        uint64_t timestamp = 0;
+        try
+        { timestamp = getFileTimestamp(dirPath.c_str()); }
+        catch(const Exception& ex)
+        { }
+        doList = entry.racy || timestamp != entry.timestamp;
+    }
+    if (doList)
+    {
+        listDir(dirPath, entry);
+        listingsNum++;
+        listed = true;
+    }
+    return !entry.listed || entry.names.find(name) != entry.names.end();
+}
+
+void AsmIncludeDirCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    dirs.clear();
+}
+
+size_t AsmIncludeDirCache::getLookupsNum()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return lookupsNum;
+}
+
+size_t AsmIncludeDirCache::getListingsNum()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return listingsNum;
+}
+
+AsmIncludeDirCache& AsmIncludeDirCache::getProcessCache()
+{
+    static AsmIncludeDirCache processCache;
+    return processCache;
+}
@@ -42,10 +42,69 @@ static const uint64_t operatorWithMessage =
         (1ULL<<int(AsmExprOp::SHIFT_LEFT)) | (1ULL<<int(AsmExprOp::SHIFT_RIGHT)) |
         (1ULL<<int(AsmExprOp::SIGNED_SHIFT_RIGHT));
 
+// flag in bytecode: binary operator takes second operand from next argument
+static const cxbyte asmExprCodeWithArg = 0x80;
+// maximal stack depth of bytecode evaluation (fixed stack)
+static const cxuint asmExprCodeMaxStack = 32;
+
 AsmExpression::AsmExpression() : symOccursNum(0), relativeSymOccurs(false),
-            baseExpr(false)
+            baseExpr(false), detachedSymOccurs(false), opsNum(0), codeSize(0),
+            maxStackDepth(0), args(nullptr), messagePositions(nullptr), ops(nullptr),
+            code(nullptr)
 { }
 
+// allocate one storage for arguments, message positions, operators and bytecode
+void AsmExpression::allocate(size_t _opsNum, size_t _opPosNum, size_t _argsNum)
+{
+    const size_t argsSize = sizeof(AsmExprArg)*_argsNum;
+    const size_t opPosSize = sizeof(LineCol)*_opPosNum;
+    const size_t wordsNum = (argsSize + opPosSize + 2*_opsNum + 7)>>3;
+    storage.reset(new uint64_t[wordsNum]);
+    cxbyte* base = reinterpret_cast<cxbyte*>(storage.get());
+    args = reinterpret_cast<AsmExprArg*>(base);
+    messagePositions = reinterpret_cast<LineCol*>(base + argsSize);
+    ops = reinterpret_cast<AsmExprOp*>(base + argsSize + opPosSize);
+    code = base + argsSize + opPosSize + _opsNum;
+    opsNum = _opsNum;
+    codeSize = 0;
+    maxStackDepth = 0;
+}
+
+/* compile operators to bytecode. argument followed by binary operator is fused
+ * into single instruction (symbol+const, label difference, shift or mask).
+ * the bytecode depends only on positions of arguments, hence substituting
+ * symbols by values does not change it */
+void AsmExpression::compile()
+{
+    codeSize = 0;
+    maxStackDepth = 0;
+    cxuint depth = 0;
+    for (size_t i = 0; i < opsNum; i++)
+    {
+        const AsmExprOp op = ops[i];
+        if (isArg(op))
+        {
+            if (i+1 < opsNum && isBinaryOp(ops[i+1]))
+            {
+                // fused argument and binary operator
+                code[codeSize++] = cxbyte(ops[++i]) | asmExprCodeWithArg;
+                continue;
+            }
+            code[codeSize++] = cxbyte(AsmExprOp::ARG_VALUE);
+            depth++;
+            maxStackDepth = std::max(maxStackDepth, depth);
+            continue;
+        }
+        if (isBinaryOp(op))
+            depth--;
+        else if (op == AsmExprOp::CHOICE)
+            depth -= 2;
+        code[codeSize++] = cxbyte(op);
+    }
+    if (maxStackDepth > asmExprCodeMaxStack)
+        codeSize = 0; // too deep, use general evaluation
+}
+
 // set symbol occurrences, operators and arguments, line positions for messages
 void AsmExpression::setParams(size_t _symOccursNum,
           bool _relativeSymOccurs, size_t _opsNum, const AsmExprOp* _ops, size_t _opPosNum,
@@ -54,11 +113,12 @@ void AsmExpression::setParams(size_t _symOccursNum,
     symOccursNum = _symOccursNum;
     relativeSymOccurs = _relativeSymOccurs;
     baseExpr = _baseExpr;
-    args.reset(new AsmExprArg[_argsNum]);
-    ops.assign(_ops, _ops+_opsNum);
-    messagePositions.reset(new LineCol[_opPosNum]);
-    std::copy(_args, _args+_argsNum, args.get());
-    std::copy(_opPos, _opPos+_opPosNum, messagePositions.get());
+    detachedSymOccurs = false;
+    allocate(_opsNum, _opPosNum, _argsNum);
+    std::copy(_ops, _ops+_opsNum, ops);
+    std::copy(_args, _args+_argsNum, args);
+    std::copy(_opPos, _opPos+_opPosNum, messagePositions);
+    compile();
 }
 
 AsmExpression::AsmExpression(const AsmSourcePos& _pos, size_t _symOccursNum,
@@ -66,22 +126,24 @@ AsmExpression::AsmExpression(const AsmSourcePos& _pos, size_t _symOccursNum,
           const LineCol* _opPos, size_t _argsNum, const AsmExprArg* _args,
           bool _baseExpr)
         : sourcePos(_pos), symOccursNum(_symOccursNum), relativeSymOccurs(_relSymOccurs),
-          baseExpr(_baseExpr), ops(_ops, _ops+_opsNum)
+          baseExpr(_baseExpr), detachedSymOccurs(false)
 {
-    args.reset(new AsmExprArg[_argsNum]);
-    messagePositions.reset(new LineCol[_opPosNum]);
-    std::copy(_args, _args+_argsNum, args.get());
-    std::copy(_opPos, _opPos+_opPosNum, messagePositions.get());
+    allocate(_opsNum, _opPosNum, _argsNum);
+    std::copy(_ops, _ops+_opsNum, ops);
+    std::copy(_args, _args+_argsNum, args);
+    std::copy(_opPos, _opPos+_opPosNum, messagePositions);
+    compile();
 }
 
 AsmExpression::AsmExpression(const AsmSourcePos& _pos, size_t _symOccursNum,
             bool _relSymOccurs, size_t _opsNum, size_t _opPosNum, size_t _argsNum,
             bool _baseExpr)
         : sourcePos(_pos), symOccursNum(_symOccursNum), relativeSymOccurs(_relSymOccurs),
-          baseExpr(_baseExpr), ops(_opsNum)
+          baseExpr(_baseExpr), detachedSymOccurs(false)
 {
-    args.reset(new AsmExprArg[_argsNum]);
-    messagePositions.reset(new LineCol[_opPosNum]);
+    // operators will be filled later, hence no bytecode
+    allocate(_opsNum, _opPosNum, _argsNum);
+    std::fill(ops, ops+_opsNum, AsmExprOp::ARG_VALUE);
 }
 
 AsmExpression::~AsmExpression()
@@ -89,7 +151,7 @@ AsmExpression::~AsmExpression()
     if (!baseExpr)
     {
         // delete all occurrences in expression at that place
-        for (size_t i = 0, j = 0; i < ops.size(); i++)
+        for (size_t i = 0, j = 0; i < opsNum; i++)
             if (ops[i] == AsmExprOp::ARG_SYMBOL)
             {
                 args[j].symbol->second.removeOccurrenceInExpr(this, j, i);
@@ -198,12 +260,233 @@ static bool checkSectionDiffs(size_t n, const RelMultiply* relMultiplies,
 #define CHKSREL(rel) checkSectionDiffs(rel.size(), rel.data(), sections, \
                 withSectionDiffs, sectDiffsPrepared, tryLater)
 
+/* apply binary operator to absolute values in bytecode evaluation.
+ * returns false if operator gives message (that message will be printed by
+ * general evaluation) */
+static inline bool applyCodeBinaryOp(AsmExprOp op, uint64_t value2, uint64_t& value)
+{
+    switch (op)
+    {
+        case AsmExprOp::ADDITION:
+            value = value2 + value;
+            break;
+        case AsmExprOp::SUBTRACT:
+            value = value2 - value;
+            break;
+        case AsmExprOp::MULTIPLY:
+            value = value2 * value;
+            break;
+        case AsmExprOp::DIVISION:
+            if (value == 0)
+                return false;
+            value = value2 / value;
+            break;
+        case AsmExprOp::SIGNED_DIVISION:
+            if (value == 0)
+                return false;
+            value = int64_t(value2) / int64_t(value);
+            break;
+        case AsmExprOp::MODULO:
+            if (value == 0)
+                return false;
+            value = value2 % value;
+            break;
+        case AsmExprOp::SIGNED_MODULO:
+            if (value == 0)
+                return false;
+            value = int64_t(value2) % int64_t(value);
+            break;
+        case AsmExprOp::BIT_AND:
+            value = value2 & value;
+            break;
+        case AsmExprOp::BIT_OR:
+            value = value2 | value;
+            break;
+        case AsmExprOp::BIT_XOR:
+            value = value2 ^ value;
+            break;
+        case AsmExprOp::BIT_ORNOT:
+            value = value2 | ~value;
+            break;
+        case AsmExprOp::SHIFT_LEFT:
+            if (value >= 64)
+                return false;
+            value = value2 << value;
+            break;
+        case AsmExprOp::SHIFT_RIGHT:
+            if (value >= 64)
+                return false;
+            value = value2 >> value;
+            break;
+        case AsmExprOp::SIGNED_SHIFT_RIGHT:
+            if (value >= 64)
+                return false;
+            value = int64_t(value2) >> value;
+            break;
+        case AsmExprOp::LOGICAL_AND:
+            value = value2 && value;
+            break;
+        case AsmExprOp::LOGICAL_OR:
+            value = value2 || value;
+            break;
+        case AsmExprOp::EQUAL:
+            value = (value2 == value) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::NOT_EQUAL:
+            value = (value2 != value) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::LESS:
+            value = (int64_t(value2) < int64_t(value))? UINT64_MAX: 0;
+            break;
+        case AsmExprOp::LESS_EQ:
+            value = (int64_t(value2) <= int64_t(value)) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::GREATER:
+            value = (int64_t(value2) > int64_t(value)) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::GREATER_EQ:
+            value = (int64_t(value2) >= int64_t(value)) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::BELOW:
+            value = (value2 < value)? UINT64_MAX: 0;
+            break;
+        case AsmExprOp::BELOW_EQ:
+            value = (value2 <= value) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::ABOVE:
+            value = (value2 > value) ? UINT64_MAX : 0;
+            break;
+        case AsmExprOp::ABOVE_EQ:
+            value = (value2 >= value) ? UINT64_MAX : 0;
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+/* evaluate bytecode with fixed stack. values in stack are absolute or relative to
+ * single section. returns false if expression must be evaluated by general way:
+ * if more relatives, section in relspace, message (error or warning) occurred */
+bool AsmExpression::tryEvaluateCode(Assembler& assembler, uint64_t& outValue,
+                cxuint& outSectionId) const
+{
+    uint64_t values[asmExprCodeMaxStack];
+    cxuint sectionIds[asmExprCodeMaxStack];
+    const bool sectDiffsPrepared = assembler.sectionDiffsPrepared;
+    const std::vector<AsmSection>& sections = assembler.sections;
+    const AsmExprArg* arg = args;
+    cxuint sp = 0;
+    
+    for (const cxbyte* c = code; c != code+codeSize; c++)
+    {
+        const AsmExprOp op = AsmExprOp(*c & ~asmExprCodeWithArg);
+        uint64_t value;
+        cxuint sectionId = ASMSECT_ABS;
+        if ((*c & asmExprCodeWithArg) != 0 || op == AsmExprOp::ARG_VALUE)
+        {
+            // get argument
+            value = arg->relValue.value;
+            if (relativeSymOccurs)
+            {
+                sectionId = arg->relValue.sectionId;
+                if (sectionId != ASMSECT_ABS && sectDiffsPrepared &&
+                    sections[sectionId].relSpace != UINT_MAX)
+                    return false;
+            }
+            arg++;
+            if (op == AsmExprOp::ARG_VALUE)
+            {
+                values[sp] = value;
+                sectionIds[sp++] = sectionId;
+                continue;
+            }
+        }
+        else
+        {
+            value = values[--sp];
+            sectionId = sectionIds[sp];
+        }
+        
+        if (isUnaryOp(op))
+        {
+            if (sectionId != ASMSECT_ABS)
+                return false;
+            if (op == AsmExprOp::NEGATE)
+                value = -value;
+            else if (op == AsmExprOp::BIT_NOT)
+                value = ~value;
+            else if (op == AsmExprOp::LOGICAL_NOT)
+                value = !value;
+        }
+        else if (isBinaryOp(op))
+        {
+            const uint64_t value2 = values[--sp];
+            const cxuint sectionId2 = sectionIds[sp];
+            if (sectionId == ASMSECT_ABS && sectionId2 == ASMSECT_ABS)
+            {
+                if (!applyCodeBinaryOp(op, value2, value))
+                    return false;
+            }
+            else if (op == AsmExprOp::ADDITION)
+            {
+                // symbol+const or const+symbol
+                if (sectionId != ASMSECT_ABS && sectionId2 != ASMSECT_ABS)
+                    return false;
+                value = value2 + value;
+                sectionId = std::min(sectionId, sectionId2);
+            }
+            else if (op == AsmExprOp::SUBTRACT)
+            {
+                // symbol-const or label difference in this same section
+                if (sectionId != ASMSECT_ABS && sectionId != sectionId2)
+                    return false;
+                value = value2 - value;
+                sectionId = (sectionId != ASMSECT_ABS) ? ASMSECT_ABS : sectionId2;
+            }
+            else
+                return false;
+        }
+        else if (op == AsmExprOp::CHOICE)
+        {
+            const uint64_t value2 = values[--sp];
+            const cxuint sectionId2 = sectionIds[sp];
+            const uint64_t value3 = values[--sp];
+            if (sectionId != ASMSECT_ABS || sectionId2 != ASMSECT_ABS ||
+                sectionIds[sp] != ASMSECT_ABS)
+                return false;
+            value = value3 ? value2 : value;
+        }
+        values[sp] = value;
+        sectionIds[sp++] = sectionId;
+    }
+    outValue = (sp != 0) ? values[sp-1] : 0;
+    outSectionId = (sp != 0) ? sectionIds[sp-1] : ASMSECT_ABS;
+    return true;
+}
+
 AsmTryStatus AsmExpression::tryEvaluate(Assembler& assembler, size_t opStart, size_t opEnd,
                  uint64_t& outValue, cxuint& outSectionId, bool withSectionDiffs) const
 {
     if (symOccursNum != 0)
         throw AsmException("Expression can't be evaluated if "
                     "symbols still are unresolved!");
+    if (detachedSymOccurs)
+    {
+        /* some symbol has been freed with its scope before resolving. it was
+         * already reported while closing scope, unless unresolved symbols
+         * are not reported (test run) */
+        if ((assembler.flags&ASM_TESTRUN) != 0 && (assembler.flags&ASM_TESTRESOLVE) == 0)
+            assembler.printError(sourcePos,
+                    "Expression has unresolved symbol from closed scope");
+        return AsmTryStatus::FAILED;
+    }
+    AsmStatsTimer timer(assembler.statsEnabled, assembler.stats.exprEvaluationTime);
+    
+    // evaluate whole expression by bytecode if possible
+    if (codeSize != 0 && opStart == 0 && opEnd == opsNum &&
+        tryEvaluateCode(assembler, outValue, outSectionId))
+        return AsmTryStatus::SUCCESS;
     
     bool failed = false;
     bool tryLater = false;
@@ -945,7 +1228,10 @@ AsmTryStatus AsmExpression::tryEvaluate(Assembler& assembler, size_t opStart, si
         }
     }
     if (tryLater)
+    {
+        assembler.stats.deferredExprsNum++;
         return AsmTryStatus::TRY_LATER;
+    }
     if (!failed)
     {
         // write results only if no errors
@@ -1026,19 +1312,21 @@ AsmExpression* AsmExpression::createForSnapshot(const AsmSourcePos* exprSourcePo
     std::unique_ptr<AsmExpression> expr(new AsmExpression);
     size_t argsNum = 0;
     size_t msgPosNum = 0;
-    for (AsmExprOp op: ops)
-        if (AsmExpression::isArg(op))
+    for (size_t i = 0; i < opsNum; i++)
+        if (AsmExpression::isArg(ops[i]))
             argsNum++;
-        else if (operatorWithMessage & (1ULL<<int(op)))
+        else if (operatorWithMessage & (1ULL<<int(ops[i])))
             msgPosNum++;
     expr->sourcePos = sourcePos;
     expr->sourcePos.exprSourcePos = exprSourcePos;
-    expr->ops = ops;
-    expr->args.reset(new AsmExprArg[argsNum]);
-    std::copy(args.get(), args.get()+argsNum, expr->args.get());
-    expr->messagePositions.reset(new LineCol[msgPosNum]);
-    std::copy(messagePositions.get(), messagePositions.get()+msgPosNum,
-              expr->messagePositions.get());
+    expr->allocate(opsNum, msgPosNum, argsNum);
+    std::copy(ops, ops+opsNum, expr->ops);
+    std::copy(args, args+argsNum, expr->args);
+    std::copy(messagePositions, messagePositions+msgPosNum, expr->messagePositions);
+    std::copy(code, code+codeSize, expr->code);
+    expr->codeSize = codeSize;
+    expr->maxStackDepth = maxStackDepth;
+    expr->detachedSymOccurs = detachedSymOccurs;
     return expr.release();
 }
 
@@ -1106,10 +1394,10 @@ bool AsmExpression::makeSymbolSnapshot(Assembler& assembler,
         size_t opIndex = se.opIndex;
         size_t argIndex = se.argIndex;
         AsmExpression* expr = se.entry->second.expression;
-        const size_t opsSize = expr->ops.size();
+        const size_t opsSize = expr->opsNum;
         
-        AsmExprArg* args = expr->args.get();
-        AsmExprOp* ops = expr->ops.data();
+        AsmExprArg* args = expr->args;
+        AsmExprOp* ops = expr->ops;
         if (opIndex < opsSize)
         {
             for (; opIndex < opsSize; opIndex++)
@@ -1259,20 +1547,22 @@ AsmExpression* AsmExpression::createExprToEvaluate(Assembler& assembler) const
     {
     size_t argsNum = 0;
     size_t msgPosNum = 0;
-    for (AsmExprOp op: ops)
-        if (AsmExpression::isArg(op))
+    for (size_t i = 0; i < opsNum; i++)
+        if (AsmExpression::isArg(ops[i]))
             argsNum++;
-    else if (operatorWithMessage & (1ULL<<int(op)))
+    else if (operatorWithMessage & (1ULL<<int(ops[i])))
         msgPosNum++;
     std::unique_ptr<AsmExpression> newExpr(new AsmExpression(
-            sourcePos, symOccursNum, relativeSymOccurs, ops.size(), ops.data(),
-            msgPosNum, messagePositions.get(), argsNum, args.get(), false));
+            sourcePos, symOccursNum, relativeSymOccurs, opsNum, ops,
+            msgPosNum, messagePositions, argsNum, args, false));
+    newExpr->detachedSymOccurs = detachedSymOccurs;
     argsNum = 0;
     bool good = true;
     // try to resolve symbols
-    for (AsmExprOp& op: newExpr->ops)
-        if (AsmExpression::isArg(op))
+    for (size_t opIndex = 0; opIndex < opsNum; opIndex++)
+        if (AsmExpression::isArg(newExpr->ops[opIndex]))
         {
+            AsmExprOp& op = newExpr->ops[opIndex];
             if (op == AsmExprOp::ARG_SYMBOL) // if
             {
                 AsmExprArg& arg = newExpr->args[argsNum];
@@ -1819,6 +2109,8 @@ AsmExpression* AsmExpression::parse(Assembler& assembler, const char*& linePtr,
                   argsNum, args.data(), makeBase);
         if (!makeBase)
         {
+            // expression with unresolved symbols will be evaluated later
+            assembler.stats.deferredExprsNum += (symOccursNum != 0);
             // add expression into symbol occurrences in expressions
             // only for non-base expressions
             for (size_t i = 0, j = 0; j < argsNum; i++)
@@ -1902,6 +2194,7 @@ static const uint32_t acceptedCharsAfterFastExpr =
 bool AsmExpression::fastExprEvaluate(Assembler& assembler, const char*& linePtr,
                         uint64_t& value)
 {
+    AsmStatsTimer timer(assembler.statsEnabled, assembler.stats.exprEvaluationTime);
     const char* end = assembler.line + assembler.lineSize;
     uint64_t sum = 0;
     bool addition = true;
@@ -98,25 +98,26 @@ bool AsmFormatHandler::resolveLoHiRelocExpression(const AsmExpression* expr,
                 "code section");
         return false;
     }
-    const Array<AsmExprOp>& ops = expr->getOps();
+    const AsmExprOp* ops = expr->getOps();
+    const size_t opsNum = expr->getOpsNum();
     
     size_t relOpStart = 0;
-    size_t relOpEnd = ops.size();
+    size_t relOpEnd = opsNum;
     relType = RELTYPE_LOW_32BIT;
     // checking what is expression
     // get () OP () - operator between two parts
-    AsmExprOp lastOp = ops.back();
+    AsmExprOp lastOp = ops[opsNum-1];
     if (lastOp==AsmExprOp::BIT_AND || lastOp==AsmExprOp::MODULO ||
         lastOp==AsmExprOp::SIGNED_MODULO || lastOp==AsmExprOp::DIVISION ||
         lastOp==AsmExprOp::SIGNED_DIVISION || lastOp==AsmExprOp::SHIFT_RIGHT)
     {
         // check low or high relocation
         relOpStart = 0;
-        relOpEnd = expr->toTop(ops.size()-2);
+        relOpEnd = expr->toTop(opsNum-2);
         /// evaluate second argument
         cxuint tmpSectionId;
         uint64_t secondArg;
-        if (!expr->evaluate(assembler, relOpEnd, ops.size()-1, secondArg, tmpSectionId))
+        if (!expr->evaluate(assembler, relOpEnd, opsNum-1, secondArg, tmpSectionId))
             return false;
         if (tmpSectionId!=ASMSECT_ABS)
         {
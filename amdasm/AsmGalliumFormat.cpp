@@ -35,8 +35,11 @@
 
 using namespace CLRX;
 
+namespace CLRX
+{
+
 // all Gallium pseudo-op names (sorted)
-static const char* galliumPseudoOpNamesTbl[] =
+const char* galliumPseudoOpNamesTbl[] =
 {
     "arch_minor", "arch_stepping",
     "arg", "args", "call_convention", "codeversion",
@@ -79,6 +82,10 @@ static const char* galliumPseudoOpNamesTbl[] =
     "workitem_private_segment_size", "workitem_vgpr_count"
 };
 
+const size_t galliumPseudoOpNamesNum = sizeof(galliumPseudoOpNamesTbl)/sizeof(char*);
+
+}
+
 // all enums for Gallium pseudo-ops
 enum
 {
@@ -376,16 +383,6 @@ void AsmGalliumHandler::saveKcodeCurrentAllocRegs()
 namespace CLRX
 {
 
-bool AsmGalliumPseudoOps::checkPseudoOpName(const CString& string)
-{
-    if (string.empty() || string[0] != '.')
-        return false;
-    const size_t pseudoOp = binaryFind(galliumPseudoOpNamesTbl, galliumPseudoOpNamesTbl +
-                sizeof(galliumPseudoOpNamesTbl)/sizeof(char*), string.c_str()+1,
-               CStringLess()) - galliumPseudoOpNamesTbl;
-    return pseudoOp < sizeof(galliumPseudoOpNamesTbl)/sizeof(char*);
-}
-
 void AsmGalliumPseudoOps::setArchMinor(AsmGalliumHandler& handler, const char* linePtr)
 {
     Assembler& asmr = handler.assembler;
@@ -1264,9 +1261,9 @@ void AsmGalliumPseudoOps::scratchSymbol(AsmGalliumHandler& handler, const char*
 bool AsmGalliumHandler::parsePseudoOp(const CString& firstName,
            const char* stmtPlace, const char* linePtr)
 {
-    const size_t pseudoOp = binaryFind(galliumPseudoOpNamesTbl, galliumPseudoOpNamesTbl +
-                    sizeof(galliumPseudoOpNamesTbl)/sizeof(char*), firstName.c_str()+1,
-                   CStringLess()) - galliumPseudoOpNamesTbl;
+    const AsmPseudoOpEntry* entry = AsmPseudoOps::findPseudoOp(firstName);
+    const size_t pseudoOp = (entry != nullptr) ?
+                entry->formatOps[ASMPOPFMT_GALLIUM] : ASMPOP_NONE;
     
     switch(pseudoOp)
     {
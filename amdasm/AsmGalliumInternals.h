@@ -103,9 +103,13 @@ enum GalliumConfigValueTarget
     GALLIUMCVAL_HSA_FIRST_PARAM = GALLIUMCVAL_HSA_SGPRSNUM
 };
 
+/// all Gallium pseudo-op names (sorted)
+extern CLRX_INTERNAL const char* galliumPseudoOpNamesTbl[];
+/// number of Gallium pseudo-op names
+extern CLRX_INTERNAL const size_t galliumPseudoOpNamesNum;
+
 struct CLRX_INTERNAL AsmGalliumPseudoOps: AsmPseudoOps
 {
-    static bool checkPseudoOpName(const CString& string);
     
     // .arch_minor
     static void setArchMinor(AsmGalliumHandler& handler, const char* linePtr);
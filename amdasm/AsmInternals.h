@@ -21,11 +21,13 @@
 #define __CLRX_ASMINTERNALS_H__
 
 #include <CLRX/Config.h>
+#include <cassert>
 #include <cstdint>
 #include <string>
 #include <unordered_set>
 #include <utility>
 #include <memory>
+#include <chrono>
 #include <CLRX/utils/Utilities.h>
 #include <CLRX/amdasm/Assembler.h>
 #include "GCNInternals.h"
@@ -48,6 +50,10 @@ CString extractSymName(const char*& string, const char* end, bool localLabelSymN
 CString extractScopedSymName(const char*& string, const char* end,
            bool localLabelSymName = false);
 
+// skip scoped symbol name, returns end of name (without trailing '::')
+const char* skipScopedSymName(const char*& string, const char* end,
+           bool localLabelSymName = false);
+
 // extract label name from string (must be at start)
 // (but not symbol of backward of forward labels)
 static inline CString extractLabelName(const char*& string, const char* end)
@@ -63,8 +69,71 @@ static inline CString extractLabelName(const char*& string, const char* end)
 
 void skipSpacesAndLabels(const char*& linePtr, const char* end);
 
+// find entry in name-indexed map (symbol, regvar, scope or macro map)
+template<typename Map>
+static inline typename Map::value_type* findInNameIndexedMap(Map& map,
+            AsmNameIndex<typename Map::value_type>& index, const AsmNamePool& namePool,
+            AsmNameId nameId)
+{
+    // index must hold all entries (all insertions must go through index)
+    assert(index.size() == map.size());
+    return index.find(nameId);
+}
+
+// insert entry to name-indexed map (symbol, regvar, scope or macro map)
+template<typename Map>
+static inline std::pair<typename Map::value_type*, bool> insertInNameIndexedMap(
+            Map& map, AsmNameIndex<typename Map::value_type>& index,
+            const AsmNamePool& namePool, AsmNameId nameId,
+            const typename Map::mapped_type& value)
+{
+    typename Map::value_type* entry = findInNameIndexedMap(map, index, namePool, nameId);
+    if (entry != nullptr)
+        return std::make_pair(entry, false);
+    auto res = map.insert(std::make_pair(CString(namePool.getName(nameId),
+                namePool.getNameLength(nameId)), value));
+    index.insert(nameId, &*res.first);
+    return std::make_pair(&*res.first, true);
+}
+
+// erase entry from name-indexed map (symbol, regvar, scope or macro map)
+template<typename Map>
+static inline bool eraseFromNameIndexedMap(Map& map,
+            AsmNameIndex<typename Map::value_type>& index, const AsmNamePool& namePool,
+            AsmNameId nameId)
+{
+    if (!index.erase(nameId))
+        return false;
+    map.erase(CString(namePool.getName(nameId), namePool.getNameLength(nameId)));
+    return true;
+}
+
 class Assembler;
 
+/* measures time of assembler phase and adds it to statistics. If statistics are
+ * disabled, only single (well predicted) branch is executed */
+class CLRX_INTERNAL AsmStatsTimer
+{
+private:
+    uint64_t* time;
+    std::chrono::steady_clock::time_point start;
+public:
+    AsmStatsTimer(bool enabled, uint64_t& _time) : time(nullptr)
+    {
+        if (enabled)
+        {
+            time = &_time;
+            start = std::chrono::steady_clock::now();
+        }
+    }
+    ~AsmStatsTimer()
+    {
+        if (time != nullptr)
+            *time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+    }
+};
+
 enum class IfIntComp
 {
     EQUAL = 0,
@@ -144,8 +213,33 @@ enum class AsmPredefined: cxbyte
     VERSION
 };
 
+/// format handlers which have own pseudo-ops
+enum : cxuint
+{
+    ASMPOPFMT_AMD = 0,
+    ASMPOPFMT_AMDCL2,
+    ASMPOPFMT_GALLIUM,
+    ASMPOPFMT_ROCM,
+    ASMPOPFMT_MAX
+};
+
+/// id of pseudo-op that does not exist in table
+const size_t ASMPOP_NONE = SIZE_MAX;
+
+/// entry of pseudo-op table (common to all format handlers)
+struct AsmPseudoOpEntry
+{
+    const char* name;   ///< name (without '.')
+    size_t mainOp;  ///< index in main pseudo-op table or ASMPOP_NONE
+    /// indices in pseudo-op tables of format handlers or ASMPOP_NONE
+    size_t formatOps[ASMPOPFMT_MAX];
+};
+
 struct CLRX_INTERNAL AsmPseudoOps: AsmParseUtils
 {
+    /// find pseudo-op (name with '.'), returns null if not found
+    static const AsmPseudoOpEntry* findPseudoOp(const CString& name);
+    
     /*
      * pseudo-ops logic
      */
@@ -173,6 +267,9 @@ struct CLRX_INTERNAL AsmPseudoOps: AsmParseUtils
     /// include file
     static void includeFile(Assembler& asmr, const char* pseudoOpPlace,
                             const char* linePtr);
+    // include library of pre-parsed macros
+    static void includeMacroLibrary(Assembler& asmr, const char* pseudoOpPlace,
+                            const char* linePtr);
     // include binary file
     static void includeBinFile(Assembler& asmr, const char* pseudoOpPlace,
                        const char* linePtr);
@@ -0,0 +1,141 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef __CLRX_ASMMACROLIBINTERNALS_H__
+#define __CLRX_ASMMACROLIBINTERNALS_H__
+
+#include <CLRX/Config.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/CString.h>
+#include <CLRX/amdasm/AsmSource.h>
+
+/* serialization of compiled macros and their sources, used by macro libraries
+ * and by persistent snapshots of included files */
+
+namespace CLRX
+{
+
+// put LEB128 value
+static inline void putLibValue(std::string& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(char((value&0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(char(value));
+}
+
+static inline void putLibString(std::string& out, const CString& str)
+{
+    putLibValue(out, str.size());
+    out.append(str.c_str(), str.size());
+}
+
+static inline uint64_t getLibValue(const cxbyte*& p, const cxbyte* end)
+{
+    uint64_t value = 0;
+    for (cxuint shift = 0; shift < 64; shift += 7)
+    {
+        if (p == end)
+            throw Exception("Macro library is truncated");
+        const cxbyte b = *p++;
+        value |= uint64_t(b&0x7f)<<shift;
+        if ((b&0x80) == 0)
+            return value;
+    }
+    throw Exception("Macro library is corrupted");
+}
+
+// get size of data that follows value
+static inline size_t getLibSize(const cxbyte*& p, const cxbyte* end)
+{
+    const uint64_t size = getLibValue(p, end);
+    if (size > uint64_t(end-p))
+        throw Exception("Macro library is truncated");
+    return size;
+}
+
+static inline CString getLibString(const cxbyte*& p, const cxbyte* end)
+{
+    const size_t size = getLibSize(p, end);
+    CString str((const char*)p, size);
+    p += size;
+    return str;
+}
+
+// builds table of sources and macro substitutions used by macros
+class AsmMacroLibNodeWriter
+{
+private:
+    std::unordered_map<const void*, size_t> nodeIds;
+    std::string out;
+    size_t nodesNum;
+
+    size_t addNode(const void* node)
+    {
+        nodeIds.insert(std::make_pair(node, nodesNum));
+        return ++nodesNum;
+    }
+public:
+    AsmMacroLibNodeWriter() : nodesNum(0)
+    { }
+
+    // returns node index+1 or 0 if null
+    size_t putSource(const AsmSource* source);
+    size_t putMacroSubst(const AsmMacroSubst* macroSubst);
+    // put macro data to output (its sources are put to table)
+    void putMacro(std::string& macroOut, const AsmMacro& macro);
+
+    size_t getNodesNum() const
+    { return nodesNum; }
+    const std::string& getOutput() const
+    { return out; }
+};
+
+// reads table of sources and macro substitutions and macros that refer to them
+class AsmMacroLibNodeReader
+{
+private:
+    // sources and macro substitutions (null for other nodes)
+    std::vector<RefPtr<const AsmSource> > sources;
+    std::vector<RefPtr<const AsmMacroSubst> > macroSubsts;
+
+    RefPtr<const AsmSource> getSource(const cxbyte*& p, const cxbyte* end,
+                size_t nodesNum) const;
+    RefPtr<const AsmMacroSubst> getMacroSubst(const cxbyte*& p, const cxbyte* end,
+                size_t nodesNum) const;
+public:
+    // read table, root files are nested in parent at lineNo and colNo (if not null)
+    void readNodes(const cxbyte*& p, const cxbyte* end, size_t nodesNum,
+                const RefPtr<const AsmSource>& parent, LineNo lineNo, ColNo colNo);
+    // read source given by node index+1 (returns null if index is 0)
+    RefPtr<const AsmSource> readSource(const cxbyte*& p, const cxbyte* end) const
+    { return getSource(p, end, sources.size()); }
+    // read macro data
+    RefPtr<const AsmMacro> readMacro(const cxbyte*& p, const cxbyte* end) const;
+};
+
+};
+
+#endif
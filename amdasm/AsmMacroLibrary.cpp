@@ -0,0 +1,458 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <unordered_map>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/MemAccess.h>
+#include <CLRX/amdasm/AsmMacroLibrary.h>
+#include "AsmMacroLibInternals.h"
+
+using namespace CLRX;
+
+/* library file layout:
+ * magic and version, symbols (name, value, onceDefined), macro index (name,
+ * size of macro data), table of sources and macro substitutions, data of macros.
+ * All integers are stored as LEB128 values. Every source node refers only to nodes
+ * placed before, thus table can be read in single pass */
+
+static const char asmMacroLibMagic[8] = { 'C', 'L', 'R', 'X', 'M', 'L', 'I', 'B' };
+static const uint32_t asmMacroLibVersion = 1;
+
+// kinds of nodes in source table
+enum : cxuint
+{
+    MACROLIB_NODE_FILE = 0,
+    MACROLIB_NODE_MACRO,
+    MACROLIB_NODE_REPT,
+    MACROLIB_NODE_SUBST
+};
+
+/*
+ * AsmMacroLibNodeWriter
+ */
+
+size_t AsmMacroLibNodeWriter::putSource(const AsmSource* source)
+{
+    if (source == nullptr)
+        return 0;
+    auto it = nodeIds.find(source);
+    if (it != nodeIds.end())
+        return it->second+1;
+    // put referred nodes before this node
+    switch(source->type)
+    {
+        case AsmSourceType::FILE:
+        {
+            const AsmFile* file = static_cast<const AsmFile*>(source);
+            const size_t parentId = putSource(file->parent.get());
+            putLibValue(out, MACROLIB_NODE_FILE);
+            putLibValue(out, parentId);
+            putLibValue(out, file->lineNo);
+            putLibValue(out, file->colNo);
+            putLibString(out, file->file);
+            break;
+        }
+        case AsmSourceType::MACRO:
+        {
+            const AsmMacroSource* macroSource =
+                        static_cast<const AsmMacroSource*>(source);
+            const size_t macroId = putMacroSubst(macroSource->macro.get());
+            const size_t sourceId = putSource(macroSource->source.get());
+            putLibValue(out, MACROLIB_NODE_MACRO);
+            putLibValue(out, macroId);
+            putLibValue(out, sourceId);
+            break;
+        }
+        case AsmSourceType::REPT:
+        {
+            const AsmRepeatSource* repeatSource =
+                        static_cast<const AsmRepeatSource*>(source);
+            const size_t sourceId = putSource(repeatSource->source.get());
+            putLibValue(out, MACROLIB_NODE_REPT);
+            putLibValue(out, sourceId);
+            putLibValue(out, repeatSource->repeatCount);
+            putLibValue(out, repeatSource->repeatsNum);
+            break;
+        }
+    }
+    return addNode(source);
+}
+
+size_t AsmMacroLibNodeWriter::putMacroSubst(const AsmMacroSubst* macroSubst)
+{
+    if (macroSubst == nullptr)
+        return 0;
+    auto it = nodeIds.find(macroSubst);
+    if (it != nodeIds.end())
+        return it->second+1;
+    const size_t parentId = putMacroSubst(macroSubst->parent.get());
+    const size_t sourceId = putSource(macroSubst->source.get());
+    putLibValue(out, MACROLIB_NODE_SUBST);
+    putLibValue(out, parentId);
+    putLibValue(out, sourceId);
+    putLibValue(out, macroSubst->lineNo);
+    putLibValue(out, macroSubst->colNo);
+    return addNode(macroSubst);
+}
+
+void AsmMacroLibNodeWriter::putMacro(std::string& macroOut, const AsmMacro& macro)
+{
+    putLibValue(macroOut, macro.contentLineNo);
+    putLibValue(macroOut, putMacroSubst(macro.sourcePos.macro.get()));
+    putLibValue(macroOut, putSource(macro.sourcePos.source.get()));
+    putLibValue(macroOut, macro.sourcePos.lineNo);
+    putLibValue(macroOut, macro.sourcePos.colNo);
+    putLibValue(macroOut, macro.args.size());
+    for (const AsmMacroArg& arg: macro.args)
+    {
+        putLibString(macroOut, arg.name);
+        putLibString(macroOut, arg.defaultValue);
+        putLibValue(macroOut, (arg.vararg ? 1 : 0) | (arg.required ? 2 : 0));
+    }
+    putLibValue(macroOut, macro.content.size());
+    macroOut.append(macro.content.data(), macro.content.size());
+    putLibValue(macroOut, macro.sourceTranslations.size());
+    for (const AsmMacro::SourceTrans& sourceTrans: macro.sourceTranslations)
+    {
+        putLibValue(macroOut, sourceTrans.lineNo);
+        putLibValue(macroOut, putSource(sourceTrans.source.get()));
+    }
+    putLibValue(macroOut, macro.colTranslations.size());
+    for (const LineTrans& colTrans: macro.colTranslations)
+    {
+        const int64_t position = colTrans.position;
+        putLibValue(macroOut, (uint64_t(position)<<1) ^ uint64_t(position>>63));
+        putLibValue(macroOut, colTrans.lineNo);
+    }
+    putLibValue(macroOut, macro.ops.size());
+    for (const AsmMacro::Op& op: macro.ops)
+    {
+        putLibValue(macroOut, cxuint(op.type));
+        putLibValue(macroOut, op.newLine);
+        putLibValue(macroOut, op.lineNo);
+        putLibValue(macroOut, op.start);
+        putLibValue(macroOut, op.size);
+    }
+    putLibValue(macroOut, macro.lines.size());
+    for (const AsmMacro::Line& line: macro.lines)
+    {
+        putLibValue(macroOut, line.opsStart);
+        putLibValue(macroOut, line.opsEnd);
+        putLibValue(macroOut, line.nextPos);
+        putLibValue(macroOut, line.firstLineNo);
+        putLibValue(macroOut, line.lineNo);
+        putLibValue(macroOut, line.endTrans);
+    }
+}
+
+/*
+ * AsmMacroLibNodeReader
+ */
+
+RefPtr<const AsmSource> AsmMacroLibNodeReader::getSource(const cxbyte*& p,
+            const cxbyte* end, size_t nodesNum) const
+{
+    const size_t id = getLibValue(p, end);
+    if (id > nodesNum || (id != 0 && !sources[id-1]))
+        throw Exception("Macro library is corrupted");
+    return id != 0 ? sources[id-1] : RefPtr<const AsmSource>();
+}
+
+RefPtr<const AsmMacroSubst> AsmMacroLibNodeReader::getMacroSubst(const cxbyte*& p,
+            const cxbyte* end, size_t nodesNum) const
+{
+    const size_t id = getLibValue(p, end);
+    if (id > nodesNum || (id != 0 && !macroSubsts[id-1]))
+        throw Exception("Macro library is corrupted");
+    return id != 0 ? macroSubsts[id-1] : RefPtr<const AsmMacroSubst>();
+}
+
+void AsmMacroLibNodeReader::readNodes(const cxbyte*& p, const cxbyte* end,
+            size_t nodesNum, const RefPtr<const AsmSource>& parent,
+            LineNo lineNo, ColNo colNo)
+{
+    if (nodesNum > size_t(end-p))
+        throw Exception("Macro library is corrupted");
+    sources.assign(nodesNum, RefPtr<const AsmSource>());
+    macroSubsts.assign(nodesNum, RefPtr<const AsmMacroSubst>());
+    // every node refers only to nodes placed before
+    for (size_t i = 0; i < nodesNum; i++)
+    {
+        const uint64_t kind = getLibValue(p, end);
+        switch(kind)
+        {
+            case MACROLIB_NODE_FILE:
+            {
+                RefPtr<const AsmSource> fileParent = getSource(p, end, i);
+                const LineNo fileLineNo = getLibValue(p, end);
+                const ColNo fileColNo = getLibValue(p, end);
+                const CString file = getLibString(p, end);
+                if (fileParent)
+                    sources[i] = RefPtr<const AsmSource>(new AsmFile(fileParent,
+                                fileLineNo, fileColNo, file));
+                else if (parent) // root file is included by library inclusion
+                    sources[i] = RefPtr<const AsmSource>(new AsmFile(parent,
+                                lineNo, colNo, file));
+                else
+                    sources[i] = RefPtr<const AsmSource>(new AsmFile(file));
+                break;
+            }
+            case MACROLIB_NODE_MACRO:
+            {
+                RefPtr<const AsmMacroSubst> macroSubst = getMacroSubst(p, end, i);
+                RefPtr<const AsmSource> source = getSource(p, end, i);
+                sources[i] = RefPtr<const AsmSource>(
+                            new AsmMacroSource(macroSubst, source));
+                break;
+            }
+            case MACROLIB_NODE_REPT:
+            {
+                RefPtr<const AsmSource> source = getSource(p, end, i);
+                const uint64_t repeatCount = getLibValue(p, end);
+                const uint64_t repeatsNum = getLibValue(p, end);
+                sources[i] = RefPtr<const AsmSource>(
+                            new AsmRepeatSource(source, repeatCount, repeatsNum));
+                break;
+            }
+            case MACROLIB_NODE_SUBST:
+            {
+                RefPtr<const AsmMacroSubst> substParent = getMacroSubst(p, end, i);
+                RefPtr<const AsmSource> source = getSource(p, end, i);
+                const LineNo substLineNo = getLibValue(p, end);
+                const ColNo substColNo = getLibValue(p, end);
+                macroSubsts[i] = RefPtr<const AsmMacroSubst>(new AsmMacroSubst(
+                            substParent, source, substLineNo, substColNo));
+                break;
+            }
+            default:
+                throw Exception("Macro library is corrupted");
+        }
+    }
+}
+
+RefPtr<const AsmMacro> AsmMacroLibNodeReader::readMacro(const cxbyte*& p,
+            const cxbyte* end) const
+{
+    const size_t nodesNum = sources.size();
+    const LineNo contentLineNo = getLibValue(p, end);
+    AsmSourcePos sourcePos;
+    sourcePos.macro = getMacroSubst(p, end, nodesNum);
+    sourcePos.source = getSource(p, end, nodesNum);
+    sourcePos.lineNo = getLibValue(p, end);
+    sourcePos.colNo = getLibValue(p, end);
+    sourcePos.exprSourcePos = nullptr;
+
+    Array<AsmMacroArg> args(getLibSize(p, end));
+    for (AsmMacroArg& arg: args)
+    {
+        arg.name = getLibString(p, end);
+        arg.defaultValue = getLibString(p, end);
+        const uint64_t argFlags = getLibValue(p, end);
+        arg.vararg = (argFlags&1) != 0;
+        arg.required = (argFlags&2) != 0;
+    }
+    const size_t argsNum = args.size();
+    RefPtr<const AsmMacro> loadedMacro(new AsmMacro(sourcePos, std::move(args)));
+    RefPtr<AsmMacro> macro = loadedMacro.constCast<AsmMacro>();
+    macro->contentLineNo = contentLineNo;
+
+    const size_t contentSize = getLibSize(p, end);
+    macro->content.assign(p, p + contentSize);
+    p += contentSize;
+    macro->sourceTranslations.resize(getLibSize(p, end));
+    for (AsmMacro::SourceTrans& sourceTrans: macro->sourceTranslations)
+    {
+        sourceTrans.lineNo = getLibValue(p, end);
+        sourceTrans.source = getSource(p, end, nodesNum);
+        if (!sourceTrans.source)
+            throw Exception("Macro library is corrupted");
+    }
+    macro->colTranslations.resize(getLibSize(p, end));
+    for (LineTrans& colTrans: macro->colTranslations)
+    {
+        const uint64_t position = getLibValue(p, end);
+        // position stored in zigzag form
+        colTrans.position = ssize_t(position>>1) ^ -ssize_t(position&1);
+        colTrans.lineNo = getLibValue(p, end);
+    }
+    macro->ops.resize(getLibSize(p, end));
+    for (AsmMacro::Op& op: macro->ops)
+    {
+        const uint64_t type = getLibValue(p, end);
+        if (type > uint64_t(AsmMacro::OpType::SKIPTRANS))
+            throw Exception("Macro library is corrupted");
+        op.type = AsmMacro::OpType(type);
+        op.newLine = getLibValue(p, end) != 0;
+        op.lineNo = getLibValue(p, end);
+        op.start = getLibValue(p, end);
+        op.size = getLibValue(p, end);
+        if ((op.type == AsmMacro::OpType::TEXT && (op.start > contentSize ||
+                op.size > contentSize - op.start)) ||
+            (op.type == AsmMacro::OpType::ARG && op.start >= argsNum))
+            throw Exception("Macro library is corrupted");
+    }
+    macro->lines.resize(getLibSize(p, end));
+    for (AsmMacro::Line& line: macro->lines)
+    {
+        line.opsStart = getLibValue(p, end);
+        line.opsEnd = getLibValue(p, end);
+        line.nextPos = getLibValue(p, end);
+        line.firstLineNo = getLibValue(p, end);
+        line.lineNo = getLibValue(p, end);
+        const uint64_t endTrans = getLibValue(p, end);
+        if (line.opsStart > line.opsEnd || line.opsEnd > macro->ops.size() ||
+            line.nextPos > contentSize || endTrans > 2)
+            throw Exception("Macro library is corrupted");
+        line.endTrans = endTrans;
+    }
+    return loadedMacro;
+}
+
+/*
+ * AsmMacroLibrary
+ */
+
+AsmMacroLibrary::AsmMacroLibrary(const CString& filename) : lineNo(0), colNo(0),
+        nodesOffset(0), nodesSize(0), nodesNum(0), loadedMacrosNum(0)
+{
+    open(filename);
+}
+
+AsmMacroLibrary::AsmMacroLibrary(const AsmSourcePos& pos, const CString& filename)
+        : lineNo(pos.lineNo), colNo(pos.colNo), nodesOffset(0), nodesSize(0),
+          nodesNum(0), loadedMacrosNum(0)
+{
+    if (!pos.macro)
+        parent = pos.source;
+    else
+        parent = RefPtr<const AsmSource>(new AsmMacroSource(pos.macro, pos.source));
+    open(filename);
+}
+
+AsmMacroLibrary::~AsmMacroLibrary()
+{ }
+
+void AsmMacroLibrary::open(const CString& filename)
+{
+    mappedFile.map(filename.c_str());
+    const cxbyte* data = mappedFile.getData();
+    const cxbyte* end = data + mappedFile.getSize();
+    if (mappedFile.getSize() < 12 || ::memcmp(data, asmMacroLibMagic, 8) != 0)
+        throw Exception("File is not macro library");
+    if (ULEV(*reinterpret_cast<const uint32_t*>(data+8)) != asmMacroLibVersion)
+        throw Exception("Unsupported version of macro library");
+    const cxbyte* p = data + 12;
+
+    // read only names and values, macros will be read later
+    const size_t symbolsNum = getLibSize(p, end);
+    symbols.resize(symbolsNum);
+    for (Symbol& symbol: symbols)
+    {
+        symbol.name = getLibString(p, end);
+        symbol.value = getLibValue(p, end);
+        symbol.onceDefined = getLibValue(p, end) != 0;
+    }
+    const size_t macrosNum = getLibSize(p, end);
+    macros.resize(macrosNum);
+    size_t macrosSize = 0;
+    for (MacroEntry& macro: macros)
+    {
+        macro.name = getLibString(p, end);
+        macro.offset = macrosSize;
+        macro.size = getLibSize(p, end);
+        macrosSize += macro.size;
+    }
+    nodesNum = getLibSize(p, end);
+    nodesSize = getLibSize(p, end);
+    nodesOffset = p - data;
+    p += nodesSize;
+    if (macrosSize != size_t(end-p))
+        throw Exception("Macro library is corrupted");
+    for (MacroEntry& macro: macros)
+        macro.offset += p - data;
+}
+
+RefPtr<const AsmMacro> AsmMacroLibrary::loadMacro(size_t index)
+{
+    if (!nodeReader)
+    {
+        std::unique_ptr<AsmMacroLibNodeReader> reader(new AsmMacroLibNodeReader);
+        const cxbyte* p = mappedFile.getData() + nodesOffset;
+        reader->readNodes(p, p + nodesSize, nodesNum, parent, lineNo, colNo);
+        nodeReader = std::move(reader);
+    }
+    const MacroEntry& entry = macros[index];
+    const cxbyte* p = mappedFile.getData() + entry.offset;
+    const cxbyte* end = p + entry.size;
+    RefPtr<const AsmMacro> macro = nodeReader->readMacro(p, end);
+    if (p != end)
+        throw Exception("Macro library is corrupted");
+    loadedMacrosNum++;
+    return macro;
+}
+
+void AsmMacroLibrary::write(const CString& filename, const std::vector<Macro>& macros,
+            const std::vector<Symbol>& symbols)
+{
+    std::string out(asmMacroLibMagic, 8);
+    for (cxuint i = 0; i < 4; i++)
+        out.push_back(char(asmMacroLibVersion>>(i*8)));
+    putLibValue(out, symbols.size());
+    for (const Symbol& symbol: symbols)
+    {
+        putLibString(out, symbol.name);
+        putLibValue(out, symbol.value);
+        putLibValue(out, symbol.onceDefined);
+    }
+
+    // serialize macros and collect their sources
+    AsmMacroLibNodeWriter nodeWriter;
+    std::string macrosData;
+    std::vector<size_t> macroSizes(macros.size());
+    for (size_t i = 0; i < macros.size(); i++)
+    {
+        const AsmMacro& macro = *macros[i].second.get();
+        const size_t macroStart = macrosData.size();
+        nodeWriter.putMacro(macrosData, macro);
+        macroSizes[i] = macrosData.size() - macroStart;
+    }
+
+    putLibValue(out, macros.size());
+    for (size_t i = 0; i < macros.size(); i++)
+    {
+        putLibString(out, macros[i].first);
+        putLibValue(out, macroSizes[i]);
+    }
+    putLibValue(out, nodeWriter.getNodesNum());
+    putLibValue(out, nodeWriter.getOutput().size());
+    out.append(nodeWriter.getOutput());
+    out.append(macrosData);
+
+    std::ofstream ofs(filename.c_str(), std::ios::binary);
+    if (!ofs)
+        throw Exception("Can't create macro library file");
+    ofs.write(out.data(), out.size());
+    if (!ofs)
+        throw Exception("Can't write macro library file");
+}
@@ -23,6 +23,7 @@
 #include <cassert>
 #include <fstream>
 #include <vector>
+#include <unordered_map>
 #include <utility>
 #include <algorithm>
 #include <CLRX/utils/Utilities.h>
@@ -117,7 +118,7 @@ static const char* pseudoOpNamesTbl[] =
     "ifeqs", "iffmt", "ifge", "ifgpu", "ifgt", "ifle",
     "iflt", "ifnarch", "ifnb", "ifnc", "ifndef",
     "ifne", "ifnes", "ifnfmt", "ifngpu", "ifnotdef", "incbin",
-    "include", "int", "irp", "irpc", "kernel", "lflags",
+    "include", "includelib", "int", "irp", "irpc", "kernel", "lflags",
     "line", "ln", "local", "long",
     "macro", "macrocase", "main", "noaltmacro",
     "nobuggyfplit", "nomacrocase", "nooldmodparam", "octa",
@@ -160,7 +161,8 @@ enum
     ASMOP_IFEQS, ASMOP_IFFMT, ASMOP_IFGE, ASMOP_IFGPU, ASMOP_IFGT, ASMOP_IFLE,
     ASMOP_IFLT, ASMOP_IFNARCH, ASMOP_IFNB, ASMOP_IFNC, ASMOP_IFNDEF,
     ASMOP_IFNE, ASMOP_IFNES, ASMOP_IFNFMT, ASMOP_IFNGPU, ASMOP_IFNOTDEF, ASMOP_INCBIN,
-    ASMOP_INCLUDE, ASMOP_INT, ASMOP_IRP, ASMOP_IRPC, ASMOP_KERNEL, ASMOP_LFLAGS,
+    ASMOP_INCLUDE, ASMOP_INCLUDELIB, ASMOP_INT, ASMOP_IRP, ASMOP_IRPC, ASMOP_KERNEL,
+    ASMOP_LFLAGS,
     ASMOP_LINE, ASMOP_LN, ASMOP_LOCAL, ASMOP_LONG,
     ASMOP_MACRO, ASMOP_MACROCASE, ASMOP_MAIN, ASMOP_NOALTMACRO,
     ASMOP_NOBUGGYFPLIT, ASMOP_NOMACROCASE, ASMOP_NOOLDMODPARAM, ASMOP_OCTA,
@@ -175,9 +177,147 @@ enum
     ASMOP_WARNING, ASMOP_WEAK, ASMOP_WHILE, ASMOP_WORD
 };
 
+/* perfect hash table of all pseudo-op names (main pseudo-ops and pseudo-ops of
+ * format handlers). Entries are split into buckets by name hash. Every bucket have
+ * displacement choosen that names from bucket are placed to free slots.
+ * Finding pseudo-op requires only one hashing and one comparison. */
+
+static inline uint32_t hashPseudoOpName(const char* name)
+{
+    uint32_t hash = 2166136261U;
+    for (; *name != 0; name++)
+        hash = (hash ^ cxbyte(*name)) * 16777619U;
+    return hash;
+}
+
+static inline uint32_t getPseudoOpSlot(uint32_t hash, uint32_t displacement)
+{
+    uint32_t x = (hash ^ displacement) * 0x9e3779b1U;
+    return x ^ (x>>15);
+}
+
+namespace
+{
+
+struct AsmPseudoOpHashTable
+{
+    std::vector<AsmPseudoOpEntry> entries;
+    std::vector<uint32_t> displacements;    // displacements for buckets
+    std::vector<size_t> slots;  // index of entry or SIZE_MAX if empty
+    uint32_t bucketMask;
+    uint32_t slotMask;
+    
+    AsmPseudoOpHashTable();
+    
+    void addNames(const char** names, size_t namesNum, cxuint format,
+                  std::unordered_map<std::string, size_t>& entryMap);
+};
+
+void AsmPseudoOpHashTable::addNames(const char** names, size_t namesNum,
+            cxuint format, std::unordered_map<std::string, size_t>& entryMap)
+{
+    for (size_t i = 0; i < namesNum; i++)
+    {
+        auto res = entryMap.insert(std::make_pair(std::string(names[i]),
+                        entries.size()));
+        if (res.second)
+            entries.push_back({ names[i], ASMPOP_NONE,
+                    { ASMPOP_NONE, ASMPOP_NONE, ASMPOP_NONE, ASMPOP_NONE } });
+        AsmPseudoOpEntry& entry = entries[res.first->second];
+        if (format == ASMPOPFMT_MAX)
+            entry.mainOp = i;
+        else
+            entry.formatOps[format] = i;
+    }
+}
+
+AsmPseudoOpHashTable::AsmPseudoOpHashTable()
+{
+    std::unordered_map<std::string, size_t> entryMap;
+    addNames(pseudoOpNamesTbl, sizeof(pseudoOpNamesTbl)/sizeof(char*),
+             ASMPOPFMT_MAX, entryMap);
+    addNames(amdPseudoOpNamesTbl, amdPseudoOpNamesNum, ASMPOPFMT_AMD, entryMap);
+    addNames(amdCL2PseudoOpNamesTbl, amdCL2PseudoOpNamesNum, ASMPOPFMT_AMDCL2, entryMap);
+    addNames(galliumPseudoOpNamesTbl, galliumPseudoOpNamesNum,
+             ASMPOPFMT_GALLIUM, entryMap);
+    addNames(rocmPseudoOpNamesTbl, rocmPseudoOpNamesNum, ASMPOPFMT_ROCM, entryMap);
+    
+    // about four names per bucket and half of slots are empty
+    uint32_t slotsNum = 1;
+    while (slotsNum < entries.size()*2)
+        slotsNum <<= 1;
+    const uint32_t bucketsNum = std::max(slotsNum>>3, 1U);
+    slotMask = slotsNum-1;
+    bucketMask = bucketsNum-1;
+    
+    std::vector<uint32_t> hashes(entries.size());
+    std::vector<std::vector<size_t> > buckets(bucketsNum);
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        hashes[i] = hashPseudoOpName(entries[i].name);
+        buckets[hashes[i] & bucketMask].push_back(i);
+    }
+    // place biggest buckets first
+    std::vector<uint32_t> bucketOrder(bucketsNum);
+    for (uint32_t i = 0; i < bucketsNum; i++)
+        bucketOrder[i] = i;
+    std::stable_sort(bucketOrder.begin(), bucketOrder.end(),
+            [&buckets](uint32_t a, uint32_t b)
+            { return buckets[a].size() > buckets[b].size(); });
+    
+    displacements.assign(bucketsNum, 0);
+    slots.assign(slotsNum, SIZE_MAX);
+    std::vector<uint32_t> bucketSlots;
+    for (uint32_t b: bucketOrder)
+    {
+        const std::vector<size_t>& bucket = buckets[b];
+        if (bucket.empty())
+            break;
+        // find displacement that place all names in free and distinct slots
+        for (uint32_t d = 0; ; d++)
+        {
+            bucketSlots.clear();
+            bool good = true;
+            for (size_t i: bucket)
+            {
+                const uint32_t slot = getPseudoOpSlot(hashes[i], d) & slotMask;
+                if (slots[slot] != SIZE_MAX || std::find(bucketSlots.begin(),
+                            bucketSlots.end(), slot) != bucketSlots.end())
+                {
+                    good = false;
+                    break;
+                }
+                bucketSlots.push_back(slot);
+            }
+            if (!good)
+                continue;
+            for (size_t i = 0; i < bucket.size(); i++)
+                slots[bucketSlots[i]] = bucket[i];
+            displacements[b] = d;
+            break;
+        }
+    }
+}
+
+};
+
 namespace CLRX
 {
 
+const AsmPseudoOpEntry* AsmPseudoOps::findPseudoOp(const CString& name)
+{
+    if (name.size() < 2 || name[0] != '.')
+        return nullptr;
+    // table is built once at first use
+    static const AsmPseudoOpHashTable table;
+    const uint32_t hash = hashPseudoOpName(name.c_str()+1);
+    const size_t index = table.slots[getPseudoOpSlot(hash,
+                table.displacements[hash & table.bucketMask]) & table.slotMask];
+    if (index == SIZE_MAX || ::strcmp(table.entries[index].name, name.c_str()+1) != 0)
+        return nullptr;
+    return &table.entries[index];
+}
+
 void AsmPseudoOps::setBitness(Assembler& asmr, const char* linePtr, bool _64Bit)
 {
     if (!checkGarbagesAtEnd(asmr, linePtr))
@@ -443,6 +583,7 @@ void AsmPseudoOps::includeFile(Assembler& asmr, const char* pseudoOpPlace,
         bool failedOpen = false;
         // convert path to system path (with system dir separators)
         filesystemPath(sysfilename);
+        asmr.includeSearchStats.probesNum++;
         try
         {
             asmr.includeFile(pseudoOpPlace, sysfilename);
@@ -458,10 +599,17 @@ void AsmPseudoOps::includeFile(Assembler& asmr, const char* pseudoOpPlace,
             std::string incDirPath(incDir.c_str());
             // convert path to system path (with system dir separators)
             filesystemPath(incDirPath);
+            const std::string path = joinPaths(incDirPath, sysfilename);
+            if (!asmr.probeIncludeDir(incDirPath, sysfilename))
+            {
+                // not in directory listing
+                asmr.addCacheDependency(path, false);
+                failedOpen = true;
+                continue;
+            }
             try
             {
-                asmr.includeFile(pseudoOpPlace, joinPaths(
-                            std::string(incDirPath.c_str()), sysfilename));
+                asmr.includeFile(pseudoOpPlace, path);
                 break;
             }
             catch(const Exception& ex)
@@ -474,6 +622,48 @@ void AsmPseudoOps::includeFile(Assembler& asmr, const char* pseudoOpPlace,
     }
 }
 
+void AsmPseudoOps::includeMacroLibrary(Assembler& asmr, const char* pseudoOpPlace,
+                   const char* linePtr)
+{
+    const char* end = asmr.line + asmr.lineSize;
+    skipSpacesToEnd(linePtr, end);
+    std::string filename, sysfilename;
+    const char* namePlace = linePtr;
+    if (asmr.parseString(filename, linePtr))
+    {
+        if (!checkGarbagesAtEnd(asmr, linePtr))
+            return;
+        sysfilename = filename;
+        // convert path to system path (with system dir separators)
+        filesystemPath(sysfilename);
+        asmr.includeSearchStats.probesNum++;
+        if (isFileExists(sysfilename.c_str()))
+        {
+            asmr.includeMacroLibrary(pseudoOpPlace, sysfilename);
+            return;
+        }
+        asmr.addCacheDependency(sysfilename, false);
+        
+        // find in include paths
+        for (const CString& incDir: asmr.includeDirs)
+        {
+            std::string incDirPath(incDir.c_str());
+            // convert path to system path (with system dir separators)
+            filesystemPath(incDirPath);
+            const std::string path = joinPaths(incDirPath, sysfilename);
+            if (asmr.probeIncludeDir(incDirPath, sysfilename) &&
+                isFileExists(path.c_str()))
+            {
+                asmr.includeMacroLibrary(pseudoOpPlace, path);
+                return;
+            }
+            asmr.addCacheDependency(path, false);
+        }
+        asmr.printError(namePlace, (std::string("Macro library '") + filename +
+                    "' not found or unavailable in any directory").c_str());
+    }
+}
+
 void AsmPseudoOps::includeBinFile(Assembler& asmr, const char* pseudoOpPlace,
                           const char* linePtr)
 {
@@ -534,23 +724,32 @@ void AsmPseudoOps::includeBinFile(Assembler& asmr, const char* pseudoOpPlace,
     std::ifstream ifs;
     sysfilename = filename;
     filesystemPath(sysfilename);
+    std::string foundPath = sysfilename;
     // try in this directory
+    asmr.includeSearchStats.probesNum++;
     ifs.open(sysfilename.c_str(), std::ios::binary);
     if (!ifs)
     {
+        asmr.addCacheDependency(sysfilename, false);
         // find in include paths
         for (const CString& incDir: asmr.includeDirs)
         {
             std::string incDirPath(incDir.c_str());
             filesystemPath(incDirPath);
-            ifs.open(joinPaths(incDirPath.c_str(), sysfilename).c_str(), std::ios::binary);
-            if (ifs)
-                break;
+            foundPath = joinPaths(incDirPath.c_str(), sysfilename);
+            if (asmr.probeIncludeDir(incDirPath, sysfilename))
+            {
+                ifs.open(foundPath.c_str(), std::ios::binary);
+                if (ifs)
+                    break;
+            }
+            asmr.addCacheDependency(foundPath, false);
         }
     }
     if (!ifs)
         ASM_RETURN_BY_ERROR(namePlace, (std::string("Binary file '") + filename +
                     "' not found or unavailable in any directory").c_str())
+    asmr.addCacheDependency(foundPath, true);
     // exception for checking file seeking
     bool seekingIsWorking = true;
     ifs.exceptions(std::ios::badbit | std::ios::failbit); // exceptions
@@ -1317,6 +1516,12 @@ void AsmPseudoOps::doPrint(Assembler& asmr, const char* linePtr)
         return;
     asmr.printStream.write(outStr.c_str(), outStr.size());
     asmr.printStream.put('\n');
+    if (asmr.cacheRecording)
+    {
+        // keep output to print it again when binary will be loaded from cache
+        asmr.cacheEntry.printed.append(outStr);
+        asmr.cacheEntry.printed.push_back('\n');
+    }
 }
 
 /// perform .if for integer comparisons '.iflt', '.ifle', '.ifne'
@@ -1658,6 +1863,7 @@ void AsmPseudoOps::doRepeat(Assembler& asmr, const char* pseudoOpPlace,
                 asmr.getSourcePos(pseudoOpPlace), repeatsNum));
     if (asmr.putRepetitionContent(*repeat))
     {
+        repeat->analyzeContent();
         // and input stream filter
         std::unique_ptr<AsmInputFilter> newInputFilter(
                     new AsmRepeatInputFilter(repeat.release()));
@@ -1692,7 +1898,13 @@ void AsmPseudoOps::doMacro(Assembler& asmr, const char* pseudoOpPlace, const cha
     bool good = true;
     bool haveVarArg = false;
     
-    if (asmr.macroMap.find(macroName) != asmr.macroMap.end())
+    const AsmNameId macroNameId = asmr.namePool.intern(macroName.c_str(),
+                macroName.size());
+    const AsmMacroMap::value_type* oldMacroEntry = asmr.findMacro(macroNamePlace,
+                macroName, macroNameId);
+    if (!asmr.includeFrames.empty())
+        asmr.recordIncludeMacro(macroName, oldMacroEntry);
+    if (oldMacroEntry != nullptr)
         ASM_NOTGOOD_BY_ERROR(macroNamePlace, (std::string("Macro '") + macroName.c_str() +
                 "' is already defined").c_str())
     
@@ -1788,7 +2000,8 @@ void AsmPseudoOps::doMacro(Assembler& asmr, const char* pseudoOpPlace, const cha
         asmr.pushClause(pseudoOpPlace, AsmClauseType::MACRO);
         if (!asmr.putMacroContent(macro.constCast<AsmMacro>()))
             return;
-        asmr.macroMap.insert(std::make_pair(std::move(macroName), std::move(macro)));
+        insertInNameIndexedMap(asmr.macroMap, asmr.macroIndex, asmr.namePool,
+                    macroNameId, macro);
     }
 }
 
@@ -1916,8 +2129,9 @@ void AsmPseudoOps::doFor(Assembler& asmr, const char* pseudoOpPlace, const char*
     good &= AsmParseUtils::getAnyValueArg(asmr, value, sectionId, linePtr);
     if (good)
     {
+        AsmScope* symScope;
         std::pair<AsmSymbolEntry*, bool> res = asmr.insertSymbolInScope(symName,
-                    AsmSymbol(sectionId, value));
+                    AsmSymbol(sectionId, value), &symScope);
         if (!res.second)
         {
             // if symbol found
@@ -1932,6 +2146,8 @@ void AsmPseudoOps::doFor(Assembler& asmr, const char* pseudoOpPlace, const char*
         }
         else // set hasValue (by isResolvableSection
             res.first->second.hasValue = asmr.isResolvableSection(sectionId);
+        if (!res.first->second.hasValue) // resolved at end of assembly
+            asmr.addPendingSymbol(symScope, *res.first);
         iterSymbol = res.first;
     }
     
@@ -1961,6 +2177,7 @@ void AsmPseudoOps::doFor(Assembler& asmr, const char* pseudoOpPlace, const char*
     nextExpr.release();
     if (asmr.putRepetitionContent(*repeat))
     {
+        repeat->analyzeContent();
         // and input stream filter
         std::unique_ptr<AsmInputFilter> newInputFilter(
                     new AsmForInputFilter(repeat.release()));
@@ -1990,6 +2207,7 @@ void AsmPseudoOps::doWhile(Assembler& asmr, const char* pseudoOpPlace, const cha
     condExpr.release();
     if (asmr.putRepetitionContent(*repeat))
     {
+        repeat->analyzeContent();
         // and input stream filter
         std::unique_ptr<AsmInputFilter> newInputFilter(
                     new AsmForInputFilter(repeat.release()));
@@ -2014,7 +2232,9 @@ void AsmPseudoOps::purgeMacro(Assembler& asmr, const char* linePtr)
     if (asmr.macroCase)
         toLowerString(macroName); // macro name is lowered
     
-    if (!asmr.macroMap.erase(macroName))
+    if (!eraseFromNameIndexedMap(asmr.macroMap, asmr.macroIndex, asmr.namePool,
+                asmr.namePool.intern(macroName.c_str(), macroName.size())) &&
+        !asmr.lazyMacros.erase(macroName))
         asmr.printWarning(macroNamePlace, (std::string("Macro '")+macroName.c_str()+
                 "' already doesn't exist").c_str());
 }
@@ -2154,12 +2374,19 @@ void AsmPseudoOps::undefSymbol(Assembler& asmr, const char* linePtr)
     
     CString sameSymName;
     AsmScope* outScope;
-    AsmSymbolEntry* it = asmr.findSymbolInScope(symName, outScope, sameSymName);
+    AsmScope* symScope;
+    AsmSymbolEntry* it = asmr.findSymbolInScope(symName, outScope, sameSymName,
+                false, &symScope);
     if (it == nullptr || !it->second.isDefined())
         asmr.printWarning(symNamePlace, (std::string("Symbol '") + symName.c_str() +
                 "' already doesn't exist").c_str());
-    else // always undefine (do not remove, due to .eqv evaluation)
+    else
+    {
+        // always undefine (do not remove, due to .eqv evaluation)
         asmr.undefineSymbol(*it);
+        // expressions of other symbols can still refer to this symbol
+        asmr.addPendingSymbol(symScope, *it);
+    }
 }
 
 void AsmPseudoOps::setAbsoluteOffset(Assembler& asmr, const char* linePtr)
@@ -2315,32 +2542,111 @@ void AsmPseudoOps::ignoreString(Assembler& asmr, const char* linePtr)
 // (checking any extra pseudo-op provided by format handler)
 bool AsmPseudoOps::checkPseudoOpName(const CString& string)
 {
-    if (string.empty() || string[0] != '.')
-        return false;
-    const size_t pseudoOp = binaryFind(pseudoOpNamesTbl, pseudoOpNamesTbl +
-                    sizeof(pseudoOpNamesTbl)/sizeof(char*), string.c_str()+1,
-                   CStringLess()) - pseudoOpNamesTbl;
-    if (pseudoOp < sizeof(pseudoOpNamesTbl)/sizeof(char*))
-        return true;
-    if (AsmGalliumPseudoOps::checkPseudoOpName(string))
-        return true;
-    if (AsmAmdPseudoOps::checkPseudoOpName(string))
-        return true;
-    if (AsmAmdCL2PseudoOps::checkPseudoOpName(string))
-        return true;
-    if (AsmROCmPseudoOps::checkPseudoOpName(string))
-        return true;
-    return false;
+    // any entry in table is main pseudo-op or pseudo-op of some format handler
+    return findPseudoOp(string) != nullptr;
 }
 
 };
 
+// returns true if pseudo-op only changes symbols, macros or conditions
+// (such pseudo-ops can be replayed from snapshot of included file)
+static bool isReplayablePseudoOp(size_t pseudoOp)
+{
+    switch(pseudoOp)
+    {
+        case ASMOP_ALTMACRO:
+        case ASMOP_BUGGYFPLIT:
+        case ASMOP_ELSE:
+        case ASMOP_ELSEIF:
+        case ASMOP_ELSEIF32:
+        case ASMOP_ELSEIF64:
+        case ASMOP_ELSEIFARCH:
+        case ASMOP_ELSEIFB:
+        case ASMOP_ELSEIFC:
+        case ASMOP_ELSEIFDEF:
+        case ASMOP_ELSEIFEQ:
+        case ASMOP_ELSEIFEQS:
+        case ASMOP_ELSEIFFMT:
+        case ASMOP_ELSEIFGE:
+        case ASMOP_ELSEIFGPU:
+        case ASMOP_ELSEIFGT:
+        case ASMOP_ELSEIFLE:
+        case ASMOP_ELSEIFLT:
+        case ASMOP_ELSEIFNARCH:
+        case ASMOP_ELSEIFNB:
+        case ASMOP_ELSEIFNC:
+        case ASMOP_ELSEIFNDEF:
+        case ASMOP_ELSEIFNE:
+        case ASMOP_ELSEIFNES:
+        case ASMOP_ELSEIFNFMT:
+        case ASMOP_ELSEIFNGPU:
+        case ASMOP_ELSEIFNOTDEF:
+        case ASMOP_ENDIF:
+        case ASMOP_ENDM:
+        case ASMOP_ENDMACRO:
+        case ASMOP_ENDR:
+        case ASMOP_ENDREPT:
+        case ASMOP_EQU:
+        case ASMOP_EQUIV:
+        case ASMOP_EQV:
+        case ASMOP_ERR:
+        case ASMOP_ERROR:
+        case ASMOP_EXITM:
+        case ASMOP_FAIL:
+        case ASMOP_FOR:
+        case ASMOP_IF:
+        case ASMOP_IF32:
+        case ASMOP_IF64:
+        case ASMOP_IFARCH:
+        case ASMOP_IFB:
+        case ASMOP_IFC:
+        case ASMOP_IFDEF:
+        case ASMOP_IFEQ:
+        case ASMOP_IFEQS:
+        case ASMOP_IFFMT:
+        case ASMOP_IFGE:
+        case ASMOP_IFGPU:
+        case ASMOP_IFGT:
+        case ASMOP_IFLE:
+        case ASMOP_IFLT:
+        case ASMOP_IFNARCH:
+        case ASMOP_IFNB:
+        case ASMOP_IFNC:
+        case ASMOP_IFNDEF:
+        case ASMOP_IFNE:
+        case ASMOP_IFNES:
+        case ASMOP_IFNFMT:
+        case ASMOP_IFNGPU:
+        case ASMOP_IFNOTDEF:
+        case ASMOP_INCLUDE:
+        case ASMOP_IRP:
+        case ASMOP_IRPC:
+        case ASMOP_MACRO:
+        case ASMOP_MACROCASE:
+        case ASMOP_NOALTMACRO:
+        case ASMOP_NOBUGGYFPLIT:
+        case ASMOP_NOMACROCASE:
+        case ASMOP_NOOLDMODPARAM:
+        case ASMOP_OLDMODPARAM:
+        case ASMOP_REPT:
+        case ASMOP_SET:
+        case ASMOP_WARNING:
+        case ASMOP_WHILE:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void Assembler::parsePseudoOps(const CString& firstName,
        const char* stmtPlace, const char* linePtr)
 {
-    const size_t pseudoOp = binaryFind(pseudoOpNamesTbl, pseudoOpNamesTbl +
-                    sizeof(pseudoOpNamesTbl)/sizeof(char*), firstName.c_str()+1,
-                   CStringLess()) - pseudoOpNamesTbl;
+    AsmStatsTimer timer(statsEnabled, stats.pseudoOpTime);
+    const AsmPseudoOpEntry* entry = AsmPseudoOps::findPseudoOp(firstName);
+    const size_t pseudoOp = (entry != nullptr) ? entry->mainOp : ASMPOP_NONE;
+    
+    if (!isReplayablePseudoOp(pseudoOp))
+        markIncludeSideEffect();
     
     switch(pseudoOp)
     {
@@ -2683,6 +2989,9 @@ void Assembler::parsePseudoOps(const CString& firstName,
         case ASMOP_INCLUDE:
             AsmPseudoOps::includeFile(*this, stmtPlace, linePtr);
             break;
+        case ASMOP_INCLUDELIB:
+            AsmPseudoOps::includeMacroLibrary(*this, stmtPlace, linePtr);
+            break;
         case ASMOP_IRP:
             AsmPseudoOps::doIRP(*this, stmtPlace, linePtr, false);
             break;
@@ -2834,10 +3143,14 @@ void Assembler::parsePseudoOps(const CString& firstName,
             break;
         default:
         {
-            bool isGalliumPseudoOp = AsmGalliumPseudoOps::checkPseudoOpName(firstName);
-            bool isAmdPseudoOp = AsmAmdPseudoOps::checkPseudoOpName(firstName);
-            bool isAmdCL2PseudoOp = AsmAmdCL2PseudoOps::checkPseudoOpName(firstName);
-            bool isROCmPseudoOp = AsmROCmPseudoOps::checkPseudoOpName(firstName);
+            bool isGalliumPseudoOp = entry != nullptr &&
+                    entry->formatOps[ASMPOPFMT_GALLIUM] != ASMPOP_NONE;
+            bool isAmdPseudoOp = entry != nullptr &&
+                    entry->formatOps[ASMPOPFMT_AMD] != ASMPOP_NONE;
+            bool isAmdCL2PseudoOp = entry != nullptr &&
+                    entry->formatOps[ASMPOPFMT_AMDCL2] != ASMPOP_NONE;
+            bool isROCmPseudoOp = entry != nullptr &&
+                    entry->formatOps[ASMPOPFMT_ROCM] != ASMPOP_NONE;
             if (isGalliumPseudoOp || isAmdPseudoOp || isAmdCL2PseudoOp || isROCmPseudoOp)
             {
                 // initialize only if gallium pseudo-op or AMD pseudo-op
@@ -3116,6 +3429,8 @@ bool Assembler::putMacroContent(RefPtr<AsmMacro> macro)
                   currentInputFilter->getSource(),
                   currentInputFilter->getColTranslations(), lineSize, line);
     }
+    if (good)
+        macro->compile();
     return good;
 }
 
@@ -33,8 +33,11 @@
 
 using namespace CLRX;
 
+namespace CLRX
+{
+
 // all ROCm pseudo-op names (sorted)
-static const char* rocmPseudoOpNamesTbl[] =
+const char* rocmPseudoOpNamesTbl[] =
 {
     "arch_minor", "arch_stepping", "arg",
     "call_convention", "codeversion", "config",
@@ -73,6 +76,10 @@ static const char* rocmPseudoOpNamesTbl[] =
     "workitem_vgpr_count"
 };
 
+const size_t rocmPseudoOpNamesNum = sizeof(rocmPseudoOpNamesTbl)/sizeof(char*);
+
+}
+
 // all enums for ROCm pseudo-ops
 enum
 {
@@ -364,16 +371,6 @@ void AsmROCmHandler::Kernel::initializeKernelConfig()
 namespace CLRX
 {
 
-bool AsmROCmPseudoOps::checkPseudoOpName(const CString& string)
-{
-    if (string.empty() || string[0] != '.')
-        return false;
-    const size_t pseudoOp = binaryFind(rocmPseudoOpNamesTbl, rocmPseudoOpNamesTbl +
-                sizeof(rocmPseudoOpNamesTbl)/sizeof(char*), string.c_str()+1,
-               CStringLess()) - rocmPseudoOpNamesTbl;
-    return pseudoOp < sizeof(rocmPseudoOpNamesTbl)/sizeof(char*);
-}
-
 void AsmROCmPseudoOps::setArchMinor(AsmROCmHandler& handler, const char* linePtr)
 {
     Assembler& asmr = handler.assembler;
@@ -1837,9 +1834,10 @@ void AsmROCmPseudoOps::addGotSymbol(AsmROCmHandler& handler,
     if (entry==nullptr)
     {
         // create unresolved symbol if not found
-        std::pair<AsmSymbolMap::iterator, bool> res = outScope->symbolMap.insert(
-                        std::make_pair(sameSymName, AsmSymbol()));
-        entry = &*res.first;
+        entry = insertInNameIndexedMap(outScope->symbolMap, outScope->symbolIndex,
+                    asmr.namePool, asmr.namePool.intern(sameSymName.c_str(),
+                        sameSymName.size()), AsmSymbol()).first;
+        asmr.stats.symbolsNum++;
     }
     // add GOT symbol
     size_t gotSymbolIndex = handler.gotSymbols.size();
@@ -2014,9 +2012,9 @@ void AsmROCmPseudoOps::doKCodeEnd(AsmROCmHandler& handler, const char* pseudoOpP
 bool AsmROCmHandler::parsePseudoOp(const CString& firstName, const char* stmtPlace,
                const char* linePtr)
 {
-    const size_t pseudoOp = binaryFind(rocmPseudoOpNamesTbl, rocmPseudoOpNamesTbl +
-                    sizeof(rocmPseudoOpNamesTbl)/sizeof(char*), firstName.c_str()+1,
-                   CStringLess()) - rocmPseudoOpNamesTbl;
+    const AsmPseudoOpEntry* entry = AsmPseudoOps::findPseudoOp(firstName);
+    const size_t pseudoOp = (entry != nullptr) ?
+                entry->formatOps[ASMPOPFMT_ROCM] : ASMPOP_NONE;
     
     switch(pseudoOp)
     {
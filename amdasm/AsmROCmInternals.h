@@ -96,9 +96,13 @@ enum ROCmConfigValueTarget
     ROCMCVAL_MAX_FLAT_WORK_GROUP_SIZE
 };
 
+/// all ROCm pseudo-op names (sorted)
+extern CLRX_INTERNAL const char* rocmPseudoOpNamesTbl[];
+/// number of ROCm pseudo-op names
+extern CLRX_INTERNAL const size_t rocmPseudoOpNamesNum;
+
 struct CLRX_INTERNAL AsmROCmPseudoOps: AsmPseudoOps
 {
-    static bool checkPseudoOpName(const CString& string);
     
     // .arch_minor
     static void setArchMinor(AsmROCmHandler& handler, const char* linePtr);
@@ -24,7 +24,6 @@
 #include <vector>
 #include <utility>
 #include <unordered_set>
-#include <map>
 #include <set>
 #include <unordered_map>
 #include <algorithm>
@@ -49,7 +48,8 @@ std::ostream& operator<<(std::ostream& os, const CLRX::BlockIndex& v)
 ISAUsageHandler::ISAUsageHandler(const std::vector<cxbyte>& _content) :
             content(_content), lastOffset(0), readOffset(0), instrStructPos(0),
             regUsagesPos(0), regUsages2Pos(0), regVarUsagesPos(0),
-            pushedArgs(0), argPos(0), argFlags(0), isNext(false), useRegMode(false)
+            pushedArgs(0), argPos(0), argFlags(0), isNext(false), useRegMode(false),
+            recording(false)
 { }
 
 ISAUsageHandler::~ISAUsageHandler()
@@ -118,6 +118,8 @@ void ISAUsageHandler::pushUsage(const AsmRegVarUsage& rvu)
         regUsages.push_back({ rvu.regField,cxbyte(rvu.rwFlags |
                     getRwFlags(rvu.regField, rvu.rstart, rvu.rend)) });
     pushedArgs++;
+    if (recording)
+        recordedUsages.push_back(rvu);
 }
 
 void ISAUsageHandler::pushUseRegUsage(const AsmRegVarUsage& rvu)
@@ -257,8 +259,308 @@ AsmRegVarUsage ISAUsageHandler::nextUsage()
     return rvu;
 }
 
-AsmRegAllocator::AsmRegAllocator(Assembler& _assembler) : assembler(_assembler)
-{ }
+const size_t AsmInterGraph::maxDenseNodesNum;
+
+void AsmInterGraph::clear()
+{
+    nodesNum = 0;
+    dense = true;
+    matrix.clear();
+    edges.clear();
+    adjOffsets.clear();
+    adjNodes.clear();
+    degrees.clear();
+}
+
+void AsmInterGraph::reset(size_t _nodesNum)
+{
+    clear();
+    nodesNum = _nodesNum;
+    dense = (nodesNum <= maxDenseNodesNum);
+    if (dense)
+        matrix.assign((((nodesNum*(nodesNum-1))>>1) + 63)>>6, uint64_t(0));
+}
+
+void AsmInterGraph::finish()
+{
+    degrees.assign(nodesNum, 0);
+    if (dense)
+    {
+        // count degrees from bits of matrix
+        for (size_t a = 1; a < nodesNum; a++)
+            forEachNeighbour(a, [this, a](size_t b)
+            {
+                if (b < a)
+                {
+                    degrees[a]++;
+                    degrees[b]++;
+                }
+            });
+        return;
+    }
+    // build sorted adjacency lists from unique edges
+    std::sort(edges.begin(), edges.end());
+    edges.resize(std::unique(edges.begin(), edges.end()) - edges.begin());
+    for (const std::pair<size_t, size_t>& edge: edges)
+    {
+        degrees[edge.first]++;
+        degrees[edge.second]++;
+    }
+    adjOffsets.resize(nodesNum+1);
+    adjOffsets[0] = 0;
+    for (size_t i = 0; i < nodesNum; i++)
+        adjOffsets[i+1] = adjOffsets[i] + degrees[i];
+    adjNodes.resize(adjOffsets[nodesNum]);
+    std::vector<size_t> adjPos(adjOffsets.begin(), adjOffsets.end()-1);
+    // edges are sorted, hence adjacency lists will be sorted
+    for (const std::pair<size_t, size_t>& edge: edges)
+        adjNodes[adjPos[edge.second]++] = edge.first;
+    for (const std::pair<size_t, size_t>& edge: edges)
+        adjNodes[adjPos[edge.first]++] = edge.second;
+    edges.clear();
+    edges.shrink_to_fit();
+}
+
+void AsmInterGraph::build(size_t nodesNum, std::vector<AsmLiveInterval>& intervals)
+{
+    reset(nodesNum);
+    // remove empty intervals and sort by start
+    intervals.resize(std::remove_if(intervals.begin(), intervals.end(),
+            [](const AsmLiveInterval& iv) { return iv.start >= iv.end; }) -
+            intervals.begin());
+    std::sort(intervals.begin(), intervals.end(),
+            [](const AsmLiveInterval& a, const AsmLiveInterval& b)
+            { return a.start < b.start; });
+    // ends of intervals: end and interval index
+    std::vector<std::pair<size_t, size_t> > ends(intervals.size());
+    for (size_t i = 0; i < intervals.size(); i++)
+        ends[i] = std::make_pair(intervals[i].end, i);
+    std::sort(ends.begin(), ends.end());
+    
+    // active intervals and their positions in active list
+    std::vector<size_t> active;
+    std::vector<size_t> activePos(intervals.size());
+    auto endIt = ends.begin();
+    for (size_t i = 0; i < intervals.size(); i++)
+    {
+        const AsmLiveInterval& iv = intervals[i];
+        // remove intervals finished before start of this interval
+        for (; endIt != ends.end() && endIt->first <= iv.start; ++endIt)
+        {
+            const size_t pos = activePos[endIt->second];
+            activePos[active.back()] = pos;
+            active[pos] = active.back();
+            active.pop_back();
+        }
+        for (size_t other: active)
+            addEdge(iv.vidx, intervals[other].vidx);
+        activePos[i] = active.size();
+        active.push_back(i);
+    }
+    finish();
+}
+
+bool AsmInterGraph::isAdjacent(size_t a, size_t b) const
+{
+    if (a == b)
+        return false;
+    if (dense)
+    {
+        const size_t bit = bitIndex(a, b);
+        return (matrix[bit>>6] & (1ULL<<(bit&63))) != 0;
+    }
+    return std::binary_search(adjNodes.begin() + adjOffsets[a],
+                adjNodes.begin() + adjOffsets[a+1], b);
+}
+
+void AsmLinearScan::reset(size_t _nodesNum)
+{
+    nodesNum = _nodesNum;
+    intervals.clear();
+    equalParents.resize(nodesNum);
+    for (size_t i = 0; i < nodesNum; i++)
+        equalParents[i] = i;
+    nextNodes.assign(nodesNum, SIZE_MAX);
+    aligns.assign(nodesNum, 0);
+    fixedRegs.assign(nodesNum, UINT_MAX);
+}
+
+size_t AsmLinearScan::findEqual(size_t node)
+{
+    while (equalParents[node] != node)
+    {
+        // path halving
+        equalParents[node] = equalParents[equalParents[node]];
+        node = equalParents[node];
+    }
+    return node;
+}
+
+void AsmLinearScan::addEqual(size_t a, size_t b)
+{
+    a = findEqual(a);
+    b = findEqual(b);
+    // smallest variable is root of equal set
+    if (a < b)
+        equalParents[b] = a;
+    else if (b < a)
+        equalParents[a] = b;
+}
+
+// consecutive registers allocated for linear chain of equal sets (classes)
+struct CLRX_INTERNAL LinearScanUnit
+{
+    size_t start, end;  // range of all variables of unit
+    size_t first;   // first class in unitClasses
+    cxuint width;   // number of classes (registers)
+    cxuint reg;     // first register (UINT_MAX if not allocated)
+};
+
+cxuint AsmLinearScan::allocate(cxuint maxRegsNum, Array<cxuint>& regMap)
+{
+    // range of equal set (class), class is indexed by its root
+    std::vector<std::pair<size_t, size_t> > ranges(nodesNum,
+                std::make_pair(SIZE_MAX, size_t(0)));
+    for (const AsmLiveInterval& iv: intervals)
+        if (iv.start < iv.end)
+        {
+            std::pair<size_t, size_t>& range = ranges[findEqual(iv.vidx)];
+            range.first = std::min(range.first, iv.start);
+            range.second = std::max(range.second, iv.end);
+        }
+    
+    std::vector<size_t> nextClasses(nodesNum, SIZE_MAX);
+    std::vector<size_t> prevClasses(nodesNum, SIZE_MAX);
+    std::vector<cxuint> classRegs(nodesNum, UINT_MAX);
+    std::vector<cxbyte> classAligns(nodesNum, 0);
+    for (size_t node = 0; node < nodesNum; node++)
+    {
+        const size_t c = findEqual(node);
+        if (nextNodes[node] != SIZE_MAX)
+        {
+            const size_t n = findEqual(nextNodes[node]);
+            // class can have only one next and one previous class
+            if (n != c && nextClasses[c] == SIZE_MAX && prevClasses[n] == SIZE_MAX)
+            {
+                nextClasses[c] = n;
+                prevClasses[n] = c;
+            }
+        }
+        if (fixedRegs[node] != UINT_MAX)
+            classRegs[c] = fixedRegs[node];
+        classAligns[c] = std::max(classAligns[c], aligns[node]);
+    }
+    
+    // create units from linear chains
+    std::vector<LinearScanUnit> units;
+    std::vector<size_t> unitClasses;
+    std::vector<bool> inUnit(nodesNum, false);
+    auto addUnit = [&](size_t c)
+    {
+        LinearScanUnit unit{ SIZE_MAX, 0, unitClasses.size(), 0, UINT_MAX };
+        for (; c != SIZE_MAX && !inUnit[c]; c = nextClasses[c], unit.width++)
+        {
+            inUnit[c] = true;
+            unitClasses.push_back(c);
+            unit.start = std::min(unit.start, ranges[c].first);
+            unit.end = std::max(unit.end, ranges[c].second);
+            if (classRegs[c] != UINT_MAX && unit.reg == UINT_MAX)
+            {
+                if (classRegs[c] < unit.width)
+                    throw AsmException("Linear dependencies of registers "
+                            "can not be satisfied");
+                unit.reg = classRegs[c] - unit.width;
+            }
+        }
+        units.push_back(unit);
+    };
+    for (size_t c = 0; c < nodesNum; c++)
+        if (findEqual(c) == c && prevClasses[c] == SIZE_MAX)
+            addUnit(c);
+    // remaining classes are in cycles of linear chains
+    for (size_t c = 0; c < nodesNum; c++)
+        if (findEqual(c) == c && !inUnit[c])
+            addUnit(c);
+    
+    // reserve fixed registers (real registers)
+    cxuint regsNum = 0;
+    std::vector<std::vector<std::pair<size_t, size_t> > > fixedRanges(maxRegsNum);
+    std::vector<size_t> order;
+    for (size_t u = 0; u < units.size(); u++)
+    {
+        const LinearScanUnit& unit = units[u];
+        if (unit.reg == UINT_MAX)
+        {
+            order.push_back(u);
+            continue;
+        }
+        if (unit.reg + unit.width > maxRegsNum)
+            throw AsmException("Too many register is needed");
+        for (cxuint i = 0; i < unit.width; i++)
+        {
+            const size_t c = unitClasses[unit.first+i];
+            if (ranges[c].first < ranges[c].second)
+                fixedRanges[unit.reg+i].push_back(ranges[c]);
+        }
+        regsNum = std::max(regsNum, unit.reg + unit.width);
+    }
+    
+    // scan units in order of their starts
+    std::sort(order.begin(), order.end(), [&units](size_t a, size_t b)
+            { return units[a].start < units[b].start ||
+                (units[a].start == units[b].start && a < b); });
+    // end of range of last unit allocated in register
+    Array<size_t> regEnds(maxRegsNum);
+    std::fill(regEnds.begin(), regEnds.end(), size_t(0));
+    for (size_t u: order)
+    {
+        LinearScanUnit& unit = units[u];
+        const bool live = unit.start < unit.end;
+        auto isFree = [&](cxuint reg, size_t c)
+        {
+            if (classAligns[c] > 1 && (reg % classAligns[c]) != 0)
+                return false;
+            if (!live)
+                return true; // never live, any register is good
+            if (regEnds[reg] > unit.start)
+                return false;
+            for (const std::pair<size_t, size_t>& range: fixedRanges[reg])
+                if (range.first < unit.end && unit.start < range.second)
+                    return false;
+            return true;
+        };
+        // find lowest free registers
+        cxuint reg = 0;
+        for (; reg + unit.width <= maxRegsNum; reg++)
+        {
+            cxuint i = 0;
+            while (i < unit.width && isFree(reg+i, unitClasses[unit.first+i])) i++;
+            if (i == unit.width)
+                break;
+        }
+        if (reg + unit.width > maxRegsNum)
+            throw AsmException("Too many register is needed");
+        unit.reg = reg;
+        if (live)
+            std::fill(regEnds.begin()+reg, regEnds.begin()+reg+unit.width, unit.end);
+        regsNum = std::max(regsNum, reg + unit.width);
+    }
+    
+    for (const LinearScanUnit& unit: units)
+        for (cxuint i = 0; i < unit.width; i++)
+            classRegs[unitClasses[unit.first+i]] = unit.reg + i;
+    regMap.resize(nodesNum);
+    for (size_t node = 0; node < nodesNum; node++)
+        regMap[node] = classRegs[findEqual(node)];
+    return regsNum;
+}
+
+AsmRegAllocator::AsmRegAllocator(Assembler& _assembler) : assembler(_assembler),
+            mode(AsmRegAllocMode::GRAPH_COLORING), regTypesNum(0)
+{
+    std::fill(graphVregsCounts, graphVregsCounts+MAX_REGTYPES_NUM, 0);
+    std::fill(regsNums, regsNums+MAX_REGTYPES_NUM, 0);
+}
 
 static inline bool codeBlockStartLess(const AsmRegAllocator::CodeBlock& c1,
                   const AsmRegAllocator::CodeBlock& c2)
@@ -484,7 +786,7 @@ void AsmRegAllocator::applySSAReplaces()
                 MinSSAGraphNode& node = ssaGraphNodes[it->first];
                 node.minSSAId = std::min(node.minSSAId, it->second);
                 for (auto it2 = it; it2 != itEnd; ++it2)
-                    node.nexts.insert(it->second);
+                    node.nexts.insert(it2->second);
             }
             it = itEnd;
         }
@@ -493,7 +795,8 @@ void AsmRegAllocator::applySSAReplaces()
         for (auto ssaGraphNodeIt = ssaGraphNodes.begin();
                  ssaGraphNodeIt!=ssaGraphNodes.end(); )
         {
-            minSSAStack.push({ ssaGraphNodeIt, ssaGraphNodeIt->second.nexts.begin() });
+            minSSAStack.push({ ssaGraphNodeIt, ssaGraphNodeIt->second.nexts.begin(),
+                        ssaGraphNodeIt->second.minSSAId });
             // traverse with minimalize SSA id
             while (!minSSAStack.empty())
             {
@@ -529,7 +832,7 @@ void AsmRegAllocator::applySSAReplaces()
                 }
             }
             // skip visited nodes
-            while (ssaGraphNodeIt != ssaGraphNodes.end())
+            for (; ssaGraphNodeIt != ssaGraphNodes.end(); ++ssaGraphNodeIt)
                 if (!ssaGraphNodeIt->second.visited)
                     break;
         }
@@ -557,14 +860,14 @@ void AsmRegAllocator::applySSAReplaces()
                 if (rit != replaces.end())
                     sinfo.ssaIdBefore = rit->second; // replace
             }
-            if (sinfo.ssaIdFirst != SIZE_MAX)
+            if (sinfo.ssaIdFirst != UINT32_MAX)
             {
                 auto rit = binaryMapFind(replaces.begin(), replaces.end(),
                                  ssaEntry.second.ssaIdFirst);
                 if (rit != replaces.end())
                     sinfo.ssaIdFirst = rit->second; // replace
             }
-            if (sinfo.ssaIdLast != SIZE_MAX)
+            if (sinfo.ssaIdLast != UINT32_MAX)
             {
                 auto rit = binaryMapFind(replaces.begin(), replaces.end(),
                                  ssaEntry.second.ssaIdLast);
@@ -574,63 +877,77 @@ void AsmRegAllocator::applySSAReplaces()
         }
 }
 
-struct Liveness
+/* liveness of variable: sorted vector of disjoint intervals [start,end).
+ * Regions are appended in increasing order while walking through code (expand,
+ * newRegion). Intervals from other blocks (insert) are collected unsorted
+ * and merged by sorting and single linear sweep before next use */
+struct CLRX_INTERNAL Liveness
 {
-    std::map<size_t, size_t> l;
+    std::vector<std::pair<size_t, size_t> > l;
+    std::vector<std::pair<size_t, size_t> > pending;
     
     Liveness() { }
     
     void clear()
-    { l.clear(); }
+    {
+        l.clear();
+        pending.clear();
+    }
+    
+    void normalize()
+    {
+        if (pending.empty())
+            return;
+        l.insert(l.end(), pending.begin(), pending.end());
+        pending.clear();
+        std::sort(l.begin(), l.end());
+        // merge overlapping and touching intervals
+        size_t j = 0;
+        for (size_t i = 1; i < l.size(); i++)
+            if (l[i].first <= l[j].second)
+                l[j].second = std::max(l[j].second, l[i].second);
+            else
+                l[++j] = l[i];
+        l.resize(j+1);
+    }
+    
+    bool empty()
+    {
+        normalize();
+        return l.empty();
+    }
+    
+    size_t lastStart()
+    {
+        normalize();
+        return l.back().first;
+    }
     
     void expand(size_t k)
     {
+        normalize();
         if (l.empty())
-            l.insert(std::make_pair(k, k+1));
+            l.push_back(std::make_pair(k, k+1));
         else
-        {
-            auto it = l.end();
-            --it;
-            it->second = k+1;
-        }
+            l.back().second = k+1;
     }
     void newRegion(size_t k)
     {
-        if (l.empty())
-            l.insert(std::make_pair(k, k));
-        else
-        {
-            auto it = l.end();
-            --it;
-            if (it->first != k && it->second != k)
-                l.insert(std::make_pair(k, k));
-        }
+        normalize();
+        if (l.empty() || (l.back().first != k && l.back().second != k))
+            l.push_back(std::make_pair(k, k));
     }
     
     void insert(size_t k, size_t k2)
-    {
-        auto it1 = l.lower_bound(k);
-        if (it1!=l.begin() && (it1==l.end() || it1->first>k))
-            --it1;
-        if (it1->second < k)
-            ++it1;
-        auto it2 = l.lower_bound(k2);
-        if (it1!=it2)
-        {
-            k = std::min(k, it1->first);
-            k2 = std::max(k2, (--it2)->second);
-            l.erase(it1, it2);
-        }
-        l.insert(std::make_pair(k, k2));
-    }
+    { pending.push_back(std::make_pair(k, k2)); }
     
+    // following routines require normalized liveness
     bool contain(size_t t) const
     {
-        auto it = l.lower_bound(t);
-        if (it==l.begin() && it->first>t)
+        auto it = std::upper_bound(l.begin(), l.end(), std::make_pair(t, SIZE_MAX));
+        if (it == l.begin())
             return false;
-        if (it==l.end() || it->first>t)
-            --it;
+        --it;
         return it->first<=t && t<it->second;
     }
     
@@ -747,7 +1064,8 @@ static void putCrossBlockLivenesses(const std::deque<FlowStackEntry3>& flowStack
             // insert live time to last seen position
             const CodeBlock& lastBlk = codeBlocks[flit->blockIndex];
             size_t toLiveCvt = codeBlockLiveTimes[flit->blockIndex] - lastBlk.start;
-            lv.insert(lastBlk.ssaInfoMap.find(entry.first)->second.lastPos + toLiveCvt,
+            lv.insert(binaryMapFind(lastBlk.ssaInfoMap.begin(), lastBlk.ssaInfoMap.end(),
+                    entry.first)->second.lastPos + toLiveCvt,
                     toLiveCvt + lastBlk.end);
             for (++flit; flit != flitEnd; ++flit)
             {
@@ -831,12 +1149,14 @@ static void putCrossBlockForLoop(const std::deque<FlowStackEntry3>& flowStack,
             const CodeBlock& firstBlk = codeBlocks[flit2->blockIndex];
             size_t toLiveCvt = codeBlockLiveTimes[flit2->blockIndex] - firstBlk.start;
             lv.insert(codeBlockLiveTimes[flit2->blockIndex],
-                    firstBlk.ssaInfoMap.find(entry.first)->second.firstPos + toLiveCvt);
+                    binaryMapFind(firstBlk.ssaInfoMap.begin(), firstBlk.ssaInfoMap.end(),
+                    entry.first)->second.firstPos + toLiveCvt);
             // insert liveness for first block in loop of last SSAId
             flit2 = flitStart + (varMapIt->second.second+1);
             const CodeBlock& lastBlk = codeBlocks[flit2->blockIndex];
             toLiveCvt = codeBlockLiveTimes[flit2->blockIndex] - lastBlk.start;
-            lv.insert(lastBlk.ssaInfoMap.find(entry.first)->second.lastPos + toLiveCvt,
+            lv.insert(binaryMapFind(lastBlk.ssaInfoMap.begin(), lastBlk.ssaInfoMap.end(),
+                    entry.first)->second.lastPos + toLiveCvt,
                     toLiveCvt + lastBlk.end);
             // fill up loop end
             for (++flit2; flit2 != flitEnd; ++flit2)
@@ -849,20 +1169,6 @@ static void putCrossBlockForLoop(const std::deque<FlowStackEntry3>& flowStack,
     }
 }
 
-struct LiveBlock
-{
-    size_t start;
-    size_t end;
-    size_t vidx;
-    
-    bool operator==(const LiveBlock& b) const
-    { return start==b.start && end==b.end && vidx==b.vidx; }
-    
-    bool operator<(const LiveBlock& b) const
-    { return start<b.start || (start==b.start &&
-            (end<b.end || (end==b.end && vidx<b.vidx))); }
-};
-
 typedef AsmRegAllocator::LinearDep LinearDep;
 typedef AsmRegAllocator::EqualToDep EqualToDep;
 typedef std::unordered_map<size_t, LinearDep> LinearDepMap;
@@ -976,8 +1282,7 @@ struct EqualStackEntry
 void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
 {
     // construct var index maps
-    size_t graphVregsCounts[MAX_REGTYPES_NUM];
-    std::fill(graphVregsCounts, graphVregsCounts+regTypesNum, 0);
+    std::fill(graphVregsCounts, graphVregsCounts+MAX_REGTYPES_NUM, 0);
     cxuint regRanges[MAX_REGTYPES_NUM*2];
     size_t regTypesNum;
     assembler.isaAssembler->getRegisterRanges(regTypesNum, regRanges);
@@ -995,8 +1300,8 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
                 ssaIdCount = sinfo.ssaIdBefore+1;
             if (sinfo.ssaIdChange!=0)
             {
-                ssaIdCount = std::max(ssaIdCount, sinfo.ssaIdLast+1);
-                ssaIdCount = std::max(ssaIdCount, sinfo.ssaIdFirst+1);
+                ssaIdCount = std::max(ssaIdCount, size_t(sinfo.ssaIdLast)+1);
+                ssaIdCount = std::max(ssaIdCount, size_t(sinfo.ssaIdFirst)+1);
             }
             if (ssaIdIndices.size() < ssaIdCount)
                 ssaIdIndices.resize(ssaIdCount, SIZE_MAX);
@@ -1104,9 +1409,10 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
                         for (AsmSingleVReg svreg: readSVRegs)
                         {
                             Liveness& lv = getLiveness(svreg, ssaIdIdxMap[svreg],
-                                    cblock.ssaInfoMap.find(svreg)->second,
+                                    binaryMapFind(cblock.ssaInfoMap.begin(),
+                                        cblock.ssaInfoMap.end(), svreg)->second,
                                     livenesses, vregIndexMaps, regTypesNum, regRanges);
-                            if (!lv.l.empty() && (--lv.l.end())->first < curLiveTime)
+                            if (!lv.empty() && lv.lastStart() < curLiveTime)
                                 lv.newRegion(curLiveTime); // begin region from this block
                             lv.expand(liveTime);
                         }
@@ -1114,7 +1420,8 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
                         {
                             size_t& ssaIdIdx = ssaIdIdxMap[svreg];
                             ssaIdIdx++;
-                            SSAInfo& sinfo = cblock.ssaInfoMap.find(svreg)->second;
+                            SSAInfo& sinfo = binaryMapFind(cblock.ssaInfoMap.begin(),
+                                    cblock.ssaInfoMap.end(), svreg)->second;
                             Liveness& lv = getLiveness(svreg, ssaIdIdx, sinfo,
                                     livenesses, vregIndexMaps, regTypesNum, regRanges);
                             if (liveTimeNext != curBlockLiveEnd)
@@ -1194,59 +1501,24 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
         }
     }
     
-    /// construct liveBlockMaps
-    std::set<LiveBlock> liveBlockMaps[MAX_REGTYPES_NUM];
+    // create interference graphs from live intervals
     for (size_t regType = 0; regType < regTypesNum; regType++)
     {
-        std::set<LiveBlock>& liveBlockMap = liveBlockMaps[regType];
         std::vector<Liveness>& liveness = livenesses[regType];
+        std::vector<AsmLiveInterval>& intervals = liveIntervals[regType];
+        intervals.clear();
         for (size_t li = 0; li < liveness.size(); li++)
         {
             Liveness& lv = liveness[li];
+            lv.normalize();
             for (const std::pair<size_t, size_t>& blk: lv.l)
-                if (blk.first != blk.second)
-                    liveBlockMap.insert({ blk.first, blk.second, li });
+                intervals.push_back({ blk.first, blk.second, li });
             lv.clear();
         }
         liveness.clear();
-    }
-    
-    // create interference graphs
-    for (size_t regType = 0; regType < regTypesNum; regType++)
-    {
-        InterGraph& interGraph = interGraphs[regType];
-        interGraph.resize(graphVregsCounts[regType]);
-        std::set<LiveBlock>& liveBlockMap = liveBlockMaps[regType];
-        
-        auto lit = liveBlockMap.begin();
-        size_t rangeStart = 0;
-        if (lit != liveBlockMap.end())
-            rangeStart = lit->start;
-        while (lit != liveBlockMap.end())
-        {
-            const size_t blkStart = lit->start;
-            const size_t blkEnd = lit->end;
-            size_t rangeEnd = blkEnd;
-            auto liStart = liveBlockMap.lower_bound({ rangeStart, 0, 0 });
-            auto liEnd = liveBlockMap.lower_bound({ rangeEnd, 0, 0 });
-            // collect from this range, variable indices
-            std::set<size_t> varIndices;
-            for (auto lit2 = liStart; lit2 != liEnd; ++lit2)
-                varIndices.insert(lit2->vidx);
-            // push to intergraph as full subgGraph
-            for (auto vit = varIndices.begin(); vit != varIndices.end(); ++vit)
-                for (auto vit2 = varIndices.begin(); vit2 != varIndices.end(); ++vit2)
-                    if (vit != vit2)
-                        interGraph[*vit].insert(*vit2);
-            // go to next live blocks
-            rangeStart = rangeEnd;
-            for (; lit != liveBlockMap.end(); ++lit)
-                if (lit->start != blkStart && lit->end != blkEnd)
-                    break;
-            if (lit == liveBlockMap.end())
-                break; // 
-            rangeStart = std::max(rangeStart, lit->start);
-        }
+        // linear scan doesn't need interference graph
+        if (mode == AsmRegAllocMode::GRAPH_COLORING)
+            interGraphs[regType].build(graphVregsCounts[regType], intervals);
     }
     
     /*
@@ -1254,8 +1526,7 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
      */
     for (cxuint regType = 0; regType < regTypesNum; regType++)
     {
-        InterGraph& interGraph = interGraphs[regType];
-        const size_t nodesNum = interGraph.size();
+        const size_t nodesNum = graphVregsCounts[regType];
         const std::unordered_map<size_t, EqualToDep>& etoDepMap = equalToDepMaps[regType];
         std::vector<bool> visited(nodesNum, false);
         std::vector<std::vector<size_t> >& equalSetList = equalSetLists[regType];
@@ -1263,7 +1534,7 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
         for (size_t v = 0; v < nodesNum;)
         {
             auto it = etoDepMap.find(v);
-            if (it == etoDepMap.end())
+            if (it == etoDepMap.end() || visited[v])
             {
                 // is not regvar in equalTo dependencies
                 v++;
@@ -1289,6 +1560,7 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
                     if (!visited[vidx])
                     {
                         // push to this equalSet
+                        visited[vidx] = true;
                         equalSetMap.insert({ vidx, equalSetIndex });
                         equalSet.push_back(vidx);
                     }
@@ -1317,8 +1589,8 @@ void AsmRegAllocator::createInterferenceGraph(ISAUsageHandler& usageHandler)
                     etoStack.pop();
             }
             
-            // to first already added node (var)
-            while (v < nodesNum && !visited[v]) v++;
+            // to first not visited node (var)
+            while (v < nodesNum && visited[v]) v++;
         }
     }
 }
@@ -1334,11 +1606,16 @@ struct CLRX_INTERNAL SDOLDOCompare
         : interGraph(_interGraph), sdoCounts(_sdoCounts)
     { }
     
+    // greatest saturation degree, next greatest degree, next smallest index
     bool operator()(size_t a, size_t b) const
     {
-        if (sdoCounts[a] > sdoCounts[b])
-            return true;
-        return interGraph[a].size() > interGraph[b].size();
+        if (sdoCounts[a] != sdoCounts[b])
+            return sdoCounts[a] > sdoCounts[b];
+        const size_t degA = interGraph.getDegree(a);
+        const size_t degB = interGraph.getDegree(b);
+        if (degA != degB)
+            return degA > degB;
+        return a < b;
     }
 };
 
@@ -1355,11 +1632,14 @@ void AsmRegAllocator::colorInterferenceGraph()
 {
     const GPUArchitecture arch = getGPUArchitectureFromDeviceType(
                     assembler.deviceType);
+    cxuint regRanges[MAX_REGTYPES_NUM*2];
+    size_t regTypesNum;
+    assembler.isaAssembler->getRegisterRanges(regTypesNum, regRanges);
     
     for (size_t regType = 0; regType < regTypesNum; regType++)
     {
         const size_t maxColorsNum = getGPUMaxRegistersNum(arch, regType);
-        InterGraph& interGraph = interGraphs[regType];
+        const InterGraph& interGraph = interGraphs[regType];
         const VarIndexMap& vregIndexMap = vregIndexMaps[regType];
         Array<cxuint>& gcMap = graphColorMaps[regType];
         const std::vector<std::vector<size_t> >& equalSetList = equalSetLists[regType];
@@ -1370,90 +1650,120 @@ void AsmRegAllocator::colorInterferenceGraph()
         std::fill(gcMap.begin(), gcMap.end(), cxuint(UINT_MAX));
         Array<size_t> sdoCounts(nodesNum);
         std::fill(sdoCounts.begin(), sdoCounts.end(), 0);
+        // bitsets of colors of neighbours for every node
+        const size_t colorWordsNum = (std::max<size_t>(maxColorsNum,
+                regRanges[(regType<<1)+1] - regRanges[regType<<1]) + 63)>>6;
+        Array<uint64_t> nbColorMasks(nodesNum*colorWordsNum);
+        std::fill(nbColorMasks.begin(), nbColorMasks.end(), uint64_t(0));
         
         SDOLDOCompare compare(interGraph, sdoCounts);
         std::set<size_t, SDOLDOCompare> nodeSet(compare);
-        for (size_t i = 0; i < nodesNum; i++)
-            nodeSet.insert(i);
         
-        cxuint colorsNum = 0;
-        // firstly, allocate real registers
+        // mark color of node in neighbours and update their saturation degrees
+        auto applyColor = [&](size_t node, cxuint color)
+        {
+            gcMap[node] = color;
+            interGraph.forEachNeighbour(node, [&](size_t nb)
+            {
+                uint64_t& mask = nbColorMasks[nb*colorWordsNum + (color>>6)];
+                if ((mask & (1ULL<<(color&63))) != 0)
+                    return; // color already is in neighbours
+                const bool inSet = (gcMap[nb] == UINT_MAX);
+                if (inSet)
+                    nodeSet.erase(nb);  // before update we erase from nodeSet
+                mask |= 1ULL<<(color&63);
+                sdoCounts[nb]++;
+                if (inSet)
+                    nodeSet.insert(nb); // after update, insert again
+            });
+        };
+        
+        // firstly, allocate real registers (color is register number)
         for (const auto& entry: vregIndexMap)
             if (entry.first.regVar == nullptr)
-                gcMap[entry.second[0]] = colorsNum++;
+                for (size_t vidx: entry.second)
+                    if (vidx != SIZE_MAX)
+                        gcMap[vidx] = entry.first.index - regRanges[regType<<1];
+        for (size_t i = 0; i < nodesNum; i++)
+            if (gcMap[i] == UINT_MAX)
+                nodeSet.insert(i);
+        for (size_t i = 0; i < nodesNum; i++)
+            if (gcMap[i] != UINT_MAX)
+                applyColor(i, gcMap[i]);
         
-        for (size_t colored = 0; colored < nodesNum; colored++)
+        std::vector<size_t> equalNodes;
+        Array<uint64_t> usedColors(colorWordsNum);
+        while (!nodeSet.empty())
         {
-            size_t node = *nodeSet.begin();
-            if (gcMap[node] != UINT_MAX)
-                continue; // already colored
-            size_t color = 0;
-            std::vector<size_t> equalNodes;
-            equalNodes.push_back(node); // only one node, if equalSet not found
+            const size_t node = *nodeSet.begin();
+            equalNodes.assign(1, node); // only one node, if equalSet not found
             auto equalSetMapIt = equalSetMap.find(node);
             if (equalSetMapIt != equalSetMap.end())
                 // found, get equal set from equalSetList
                 equalNodes = equalSetList[equalSetMapIt->second];
             
-            for (color = 0; color <= colorsNum; color++)
-            {
-                // find first usable color
-                bool thisSame = false;
-                for (size_t nb: interGraph[node])
-                    if (gcMap[nb] == color)
-                    {
-                        thisSame = true;
-                        break;
-                    }
-                if (!thisSame)
-                    break;
-            }
-            if (color==colorsNum) // add new color if needed
-            {
-                if (colorsNum >= maxColorsNum)
-                    throw AsmException("Too many register is needed");
-                colorsNum++;
-            }
-            
-            for (size_t nextNode: equalNodes)
-                gcMap[nextNode] = color;
-            // update SDO for node
-            bool colorExists = false;
-            for (size_t node: equalNodes)
-            {
-                for (size_t nb: interGraph[node])
-                    if (gcMap[nb] == color)
-                    {
-                        colorExists = true;
-                        break;
-                    }
-                if (!colorExists)
-                    sdoCounts[node]++;
-            }
-            // update SDO for neighbors
-            for (size_t node: equalNodes)
-                for (size_t nb: interGraph[node])
+            // colors used by neighbours of all equal nodes
+            std::fill(usedColors.begin(), usedColors.end(), uint64_t(0));
+            for (size_t eqNode: equalNodes)
+                for (size_t k = 0; k < colorWordsNum; k++)
+                    usedColors[k] |= nbColorMasks[eqNode*colorWordsNum + k];
+            // find first usable color
+            cxuint color = UINT_MAX;
+            for (size_t k = 0; k < colorWordsNum; k++)
+                if (usedColors[k] != UINT64_MAX)
                 {
-                    colorExists = false;
-                    for (size_t nb2: interGraph[nb])
-                        if (gcMap[nb2] == color)
-                        {
-                            colorExists = true;
-                            break;
-                        }
-                    if (!colorExists)
-                    {
-                        if (gcMap[nb] == UINT_MAX)
-                            nodeSet.erase(nb);  // before update we erase from nodeSet
-                        sdoCounts[nb]++;
-                        if (gcMap[nb] == UINT_MAX)
-                            nodeSet.insert(nb); // after update, insert again
-                    }
+                    color = (k<<6) + CTZ64(~usedColors[k]);
+                    break;
                 }
+            if (color >= maxColorsNum)
+                throw AsmException("Too many register is needed");
             
-            for (size_t nextNode: equalNodes)
-                gcMap[nextNode] = color;
+            for (size_t eqNode: equalNodes)
+                nodeSet.erase(eqNode);
+            for (size_t eqNode: equalNodes)
+                applyColor(eqNode, color);
         }
+        
+        cxuint& regsNum = regsNums[regType];
+        regsNum = 0;
+        for (cxuint color: gcMap)
+            regsNum = std::max(regsNum, color+1);
+    }
+}
+
+void AsmRegAllocator::linearScanRegisters()
+{
+    const GPUArchitecture arch = getGPUArchitectureFromDeviceType(
+                    assembler.deviceType);
+    cxuint regRanges[MAX_REGTYPES_NUM*2];
+    size_t regTypesNum;
+    assembler.isaAssembler->getRegisterRanges(regTypesNum, regRanges);
+    
+    AsmLinearScan linearScan;
+    for (size_t regType = 0; regType < regTypesNum; regType++)
+    {
+        linearScan.reset(graphVregsCounts[regType]);
+        for (const AsmLiveInterval& interval: liveIntervals[regType])
+            linearScan.addInterval(interval);
+        for (const auto& entry: linearDepMaps[regType])
+        {
+            linearScan.setAlignment(entry.first, entry.second.align);
+            for (size_t next: entry.second.nextVidxes)
+                linearScan.addLinear(entry.first, next);
+        }
+        for (const std::vector<size_t>& equalSet: equalSetLists[regType])
+            for (size_t i = 1; i < equalSet.size(); i++)
+                linearScan.addEqual(equalSet[0], equalSet[i]);
+        // real registers have fixed registers
+        for (const auto& entry: vregIndexMaps[regType])
+            if (entry.first.regVar == nullptr)
+                for (size_t vidx: entry.second)
+                    if (vidx != SIZE_MAX)
+                        linearScan.setFixedRegister(vidx,
+                                entry.first.index - regRanges[regType<<1]);
+        
+        regsNums[regType] = linearScan.allocate(
+                getGPUMaxRegistersNum(arch, regType), graphColorMaps[regType]);
     }
 }
 
@@ -1468,6 +1778,8 @@ void AsmRegAllocator::allocateRegisters(cxuint sectionId)
         linearDepMaps[i].clear();
         equalToDepMaps[i].clear();
         graphColorMaps[i].clear();
+        liveIntervals[i].clear();
+        regsNums[i] = 0;
         equalSetMaps[i].clear();
         equalSetLists[i].clear();
     }
@@ -1481,5 +1793,8 @@ void AsmRegAllocator::allocateRegisters(cxuint sectionId)
     createSSAData(*section.usageHandler);
     applySSAReplaces();
     createInterferenceGraph(*section.usageHandler);
-    colorInterferenceGraph();
+    if (mode == AsmRegAllocMode::LINEAR_SCAN)
+        linearScanRegisters();
+    else
+        colorInterferenceGraph();
 }
@@ -42,7 +42,7 @@ namespace CLRX
 typedef AsmRegAllocator::CodeBlock CodeBlock;
 typedef AsmRegAllocator::NextBlock NextBlock;
 typedef AsmRegAllocator::SSAInfo SSAInfo;
-typedef std::pair<const AsmSingleVReg, SSAInfo> SSAEntry;
+typedef std::pair<AsmSingleVReg, SSAInfo> SSAEntry;
 
 //  BlockIndex
 
@@ -732,7 +732,7 @@ static bool reduceSSAIds(std::unordered_map<AsmSingleVReg, size_t>& curSSAIdMap,
     {
         auto& ssaIds = ssaIdsIt->second.ssaIds;
         
-        if (sinfo.ssaId != SIZE_MAX)
+        if (sinfo.ssaId != UINT32_MAX)
         {
             VectorSet<size_t> outSSAIds = ssaIds;
             outSSAIds.insertValue(ssaId-1); // ???
@@ -1331,7 +1331,7 @@ static void createRoutineData(const std::vector<CodeBlock>& codeBlocks,
                 if (ssaEntry.first.regVar == nullptr)
                     continue;
                 size_t curSSAId = ssaEntry.second.ssaIdBefore+1;
-                size_t nextSSAId = (ssaEntry.second.ssaIdLast != SIZE_MAX) ?
+                size_t nextSSAId = (ssaEntry.second.ssaIdLast != UINT32_MAX) ?
                     ssaEntry.second.ssaIdLast+1 : curSSAId;
                 curSSAIdMap[ssaEntry.first] = curSSAId;
                 
@@ -1386,6 +1386,9 @@ void AsmRegAllocator::createSSAData(ISAUsageHandler& usageHandler)
 {
     if (codeBlocks.empty())
         return;
+    // positions in SSA infos are 32-bit
+    if (codeBlocks.back().end > UINT32_MAX)
+        throw AsmException("Code is too big for register allocation");
     usageHandler.rewind();
     auto cbit = codeBlocks.begin();
     AsmRegVarUsage rvu;
@@ -1399,6 +1402,8 @@ void AsmRegAllocator::createSSAData(ISAUsageHandler& usageHandler)
     size_t regTypesNum;
     assembler.isaAssembler->getRegisterRanges(regTypesNum, regRanges);
     
+    // indices of SSA infos in current block (sorted after filling block)
+    std::unordered_map<AsmSingleVReg, size_t> ssaInfoIndices;
     while (true)
     {
         while (cbit != codeBlocks.end() && cbit->end <= rvu.offset)
@@ -1415,16 +1420,19 @@ void AsmRegAllocator::createSSAData(ISAUsageHandler& usageHandler)
             break;
         
         cbit->usagePos = usageHandler.getReadPos();
+        ssaInfoIndices.clear();
         while (rvu.offset < cbit->end)
         {
             // process rvu
             // only if regVar
             for (uint16_t rindex = rvu.rstart; rindex < rvu.rend; rindex++)
             {
-                auto res = cbit->ssaInfoMap.insert(
-                        { AsmSingleVReg{ rvu.regVar, rindex }, SSAInfo() });
+                auto res = ssaInfoIndices.insert({ AsmSingleVReg{ rvu.regVar, rindex },
+                            cbit->ssaInfoMap.size() });
+                if (res.second)
+                    cbit->ssaInfoMap.push_back({ res.first->first, SSAInfo() });
                 
-                SSAInfo& sinfo = res.first->second;
+                SSAInfo& sinfo = cbit->ssaInfoMap[res.first->second].second;
                 if (res.second)
                     sinfo.firstPos = rvu.offset;
                 if ((rvu.rwFlags & ASMRVU_READ) != 0 && (sinfo.ssaIdChange == 0 ||
@@ -1444,6 +1452,7 @@ void AsmRegAllocator::createSSAData(ISAUsageHandler& usageHandler)
                 break;
             rvu = usageHandler.nextUsage();
         }
+        mapSort(cbit->ssaInfoMap.begin(), cbit->ssaInfoMap.end());
         ++cbit;
     }
     
@@ -1511,7 +1520,7 @@ void AsmRegAllocator::createSSAData(ISAUsageHandler& usageHandler)
                         continue; // no change for registers
                     }
                     
-                    if (sinfo.ssaId != SIZE_MAX)
+                    if (sinfo.ssaId != UINT32_MAX)
                     {
                         // already initialized
                         reduceSSAIds(curSSAIdMap, retSSAIdMap,
@@ -1541,11 +1550,14 @@ void AsmRegAllocator::createSSAData(ISAUsageHandler& usageHandler)
                     }
                     
                     sinfo.ssaId = totalSSACount;
-                    sinfo.ssaIdFirst = sinfo.ssaIdChange!=0 ? totalSSACount : SIZE_MAX;
+                    sinfo.ssaIdFirst = sinfo.ssaIdChange!=0 ? totalSSACount : UINT32_MAX;
                     sinfo.ssaIdBefore = ssaId-1;
                     
                     totalSSACount += sinfo.ssaIdChange;
-                    sinfo.ssaIdLast = sinfo.ssaIdChange!=0 ? totalSSACount-1 : SIZE_MAX;
+                    // SSA ids are 32-bit and UINT32_MAX means no SSA id
+                    if (totalSSACount >= UINT32_MAX)
+                        throw AsmException("Too many SSA ids of register variable");
+                    sinfo.ssaIdLast = sinfo.ssaIdChange!=0 ? totalSSACount-1 : UINT32_MAX;
                     //totalSSACount = std::max(totalSSACount, ssaId);
                     if (!reducedSSAId || sinfo.ssaIdChange!=0)
                         ssaId = totalSSACount;
@@ -23,6 +23,7 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <cstring>
 #include <CLRX/utils/Utilities.h>
 #include <CLRX/amdasm/Assembler.h>
 #include "AsmInternals.h"
@@ -46,6 +47,83 @@ AsmMacroSource::~AsmMacroSource()
 AsmRepeatSource::~AsmRepeatSource()
 { }
 
+/*
+ * AsmSourceRebaser
+ */
+
+AsmSourceRebaser::AsmSourceRebaser(RefPtr<const AsmSource> _oldSource,
+            RefPtr<const AsmSource> _newSource)
+        : oldSource(_oldSource), newSource(_newSource)
+{ }
+
+RefPtr<const AsmSource> AsmSourceRebaser::rebase(const RefPtr<const AsmSource>& source)
+{
+    if (!source)
+        return source;
+    if (source == oldSource)
+        return newSource;
+    auto it = sourceMap.find(source.get());
+    if (it != sourceMap.end())
+        return it->second;
+    
+    RefPtr<const AsmSource> result = source;
+    switch(source->type)
+    {
+        case AsmSourceType::FILE:
+        {
+            const AsmFile* file = static_cast<const AsmFile*>(source.get());
+            RefPtr<const AsmSource> parent = rebase(file->parent);
+            if (parent != file->parent)
+                result = RefPtr<const AsmSource>(new AsmFile(parent, file->lineNo,
+                            file->colNo, file->file));
+            break;
+        }
+        case AsmSourceType::MACRO:
+        {
+            const AsmMacroSource* macroSource =
+                    static_cast<const AsmMacroSource*>(source.get());
+            RefPtr<const AsmMacroSubst> macro = rebase(macroSource->macro);
+            RefPtr<const AsmSource> content = rebase(macroSource->source);
+            if (macro != macroSource->macro || content != macroSource->source)
+                result = RefPtr<const AsmSource>(new AsmMacroSource(macro, content));
+            break;
+        }
+        case AsmSourceType::REPT:
+        {
+            const AsmRepeatSource* repeatSource =
+                    static_cast<const AsmRepeatSource*>(source.get());
+            RefPtr<const AsmSource> content = rebase(repeatSource->source);
+            if (content != repeatSource->source)
+                result = RefPtr<const AsmSource>(new AsmRepeatSource(content,
+                            repeatSource->repeatCount, repeatSource->repeatsNum));
+            break;
+        }
+        default:
+            break;
+    }
+    sourceMap.insert(std::make_pair(source.get(), result));
+    return result;
+}
+
+RefPtr<const AsmMacroSubst> AsmSourceRebaser::rebase(
+            const RefPtr<const AsmMacroSubst>& macroSubst)
+{
+    if (!macroSubst)
+        return macroSubst;
+    auto it = macroSubstMap.find(macroSubst.get());
+    if (it != macroSubstMap.end())
+        return it->second;
+    
+    RefPtr<const AsmMacroSubst> result = macroSubst;
+    RefPtr<const AsmMacroSubst> parent = rebase(macroSubst->parent);
+    RefPtr<const AsmSource> source = rebase(macroSubst->source);
+    if (parent != macroSubst->parent || source != macroSubst->source)
+        result = RefPtr<const AsmMacroSubst>(new AsmMacroSubst(parent, source,
+                    macroSubst->lineNo, macroSubst->colNo));
+    macroSubstMap.insert(std::make_pair(macroSubst.get(), result));
+    return result;
+}
+
 /* Asm Macro */
 AsmMacro::AsmMacro(const AsmSourcePos& _pos, const Array<AsmMacroArg>& _args)
         : contentLineNo(0), sourcePos(_pos), args(_args)
@@ -55,6 +133,19 @@ AsmMacro::AsmMacro(const AsmSourcePos& _pos, Array<AsmMacroArg>&& _args)
         : contentLineNo(0), sourcePos(_pos), args(std::move(_args))
 { }
 
+AsmMacro::AsmMacro(const RefPtr<const AsmMacro>& macro, AsmSourceRebaser& rebaser)
+        : contentLineNo(macro->contentLineNo), sourcePos(macro->sourcePos),
+          args(macro->args), content(macro->content),
+          sourceTranslations(macro->sourceTranslations),
+          colTranslations(macro->colTranslations), ops(macro->ops), lines(macro->lines),
+          origin(macro->origin ? macro->origin : macro)
+{
+    sourcePos.macro = rebaser.rebase(sourcePos.macro);
+    sourcePos.source = rebaser.rebase(sourcePos.source);
+    for (SourceTrans& sourceTrans: sourceTranslations)
+        sourceTrans.source = rebaser.rebase(sourceTrans.source);
+}
+
 void AsmMacro::addLine(RefPtr<const AsmMacroSubst> macro, RefPtr<const AsmSource> source,
            const std::vector<LineTrans>& colTrans, size_t lineSize, const char* line)
 {
@@ -91,9 +182,142 @@ void AsmMacro::addLine(RefPtr<const AsmMacroSubst> macro, RefPtr<const AsmSource
     contentLineNo++;
 }
 
+// put text operation, join with previous text operation if contiguous
+static void putMacroTextOp(std::vector<AsmMacro::Op>& ops, size_t opsStart,
+            size_t start, size_t size)
+{
+    if (size == 0)
+        return;
+    if (ops.size() > opsStart && ops.back().type == AsmMacro::OpType::TEXT &&
+        ops.back().start + ops.back().size == start)
+        ops.back().size += size;
+    else
+        ops.push_back({ AsmMacro::OpType::TEXT, false, 0, start, size });
+}
+
+/* compile content of macro. It follows AsmMacroInputFilter::readLine
+ * in non-altmacro mode: an every backslash substitution and column translation
+ * is resolved once, and substitution just executes operations */
+void AsmMacro::compile()
+{
+    ops.clear();
+    lines.clear();
+    // arguments in sorted order (likewise in argument map of macro substitution)
+    Array<std::pair<CString, size_t> > sortedArgs(args.size());
+    for (size_t i = 0; i < args.size(); i++)
+        sortedArgs[i] = std::make_pair(args[i].name, i);
+    mapSort(sortedArgs.begin(), sortedArgs.end());
+    
+    const char* cont = content.data();
+    const size_t contentSize = content.size();
+    const LineTrans* curColTrans = colTranslations.data();
+    const LineTrans* colTransEnd = curColTrans + colTranslations.size();
+    size_t pos = 0;
+    while (pos < contentSize)
+    {
+        Line line;
+        line.opsStart = ops.size();
+        line.firstLineNo = curColTrans->lineNo;
+        
+        size_t nextLinePos = pos;
+        while (nextLinePos < contentSize && cont[nextLinePos] != '\n')
+            nextLinePos++;
+        const size_t linePos = pos;
+        size_t toCopyPos = pos;
+        size_t colTransThreshold = (curColTrans+1 != colTransEnd) ?
+                (curColTrans[1].position>0 ? curColTrans[1].position + linePos :
+                        nextLinePos) : SIZE_MAX;
+        
+        while (pos < contentSize && cont[pos] != '\n')
+        {
+            if (pos >= colTransThreshold)
+            {
+                // put column translation
+                putMacroTextOp(ops, line.opsStart, toCopyPos, pos-toCopyPos);
+                toCopyPos = pos;
+                curColTrans++;
+                ops.push_back({ OpType::COLTRANS, curColTrans->position >= 0,
+                            curColTrans->lineNo, 0, 0 });
+                colTransThreshold = (curColTrans+1 != colTransEnd) ?
+                        (curColTrans[1].position>0 ? curColTrans[1].position + linePos :
+                                nextLinePos) : SIZE_MAX;
+            }
+            if (cont[pos] != '\\')
+            {
+                pos++;
+                continue;
+            }
+            // backslash
+            putMacroTextOp(ops, line.opsStart, toCopyPos, pos-toCopyPos);
+            pos++;
+            bool skipColTransBetweenMacroArg = true;
+            if (pos < contentSize)
+            {
+                if (cont[pos] == '(' && pos+1 < contentSize && cont[pos+1]==')')
+                    pos += 2;   // skip this separator
+                else
+                {
+                    // extract argName
+                    const char* thisPos = cont + pos;
+                    const CString symName = extractSymName(
+                                thisPos, cont+contentSize, false);
+                    auto it = sortedArgs.end();
+                    if (!symName.empty()) // find only if not empty symName
+                        it = binaryMapFind(sortedArgs.begin(), sortedArgs.end(), symName);
+                    if (it != sortedArgs.end())
+                    {
+                        ops.push_back({ OpType::ARG, false, 0,
+                                size_t(it-sortedArgs.begin()), 0 });
+                        pos = thisPos-cont;
+                    }
+                    else if (cont[pos] == '@')
+                    {
+                        ops.push_back({ OpType::COUNT, false, 0, 0, 0 });
+                        pos++;
+                    }
+                    else
+                    {
+                        // keep backslash, no substitution
+                        putMacroTextOp(ops, line.opsStart, pos-1, 1);
+                        // do not skip column translation, because no substitution!
+                        skipColTransBetweenMacroArg = false;
+                    }
+                }
+            }
+            toCopyPos = pos;
+            // skip colTrans between macroarg or separator
+            if (skipColTransBetweenMacroArg)
+                while (pos > colTransThreshold)
+                {
+                    curColTrans++;
+                    ops.push_back({ OpType::SKIPTRANS, curColTrans->position >= 0,
+                                curColTrans->lineNo, 0, 0 });
+                    colTransThreshold = (curColTrans+1 != colTransEnd) ?
+                            curColTrans[1].position : SIZE_MAX;
+                }
+        }
+        // rest of line
+        putMacroTextOp(ops, line.opsStart, toCopyPos, pos-toCopyPos);
+        line.opsEnd = ops.size();
+        line.endTrans = 0;
+        if (pos < contentSize)
+        {
+            if (curColTrans+1 != colTransEnd)
+            {
+                curColTrans++;
+                line.endTrans = (curColTrans->position >= 0) ? 1 : 2;
+            }
+            pos++; // skip newline
+        }
+        line.lineNo = curColTrans->lineNo;
+        line.nextPos = pos;
+        lines.push_back(line);
+    }
+}
+
 /* Asm Repeat */
 AsmRepeat::AsmRepeat(const AsmSourcePos& _pos, uint64_t _repeatsNum)
-        : contentLineNo(0), sourcePos(_pos), repeatsNum(_repeatsNum)
+        : contentLineNo(0), sourcePos(_pos), repeatsNum(_repeatsNum), replicable(false)
 { }
 
 AsmRepeat::~AsmRepeat()
@@ -114,6 +338,96 @@ void AsmRepeat::addLine(RefPtr<const AsmMacroSubst> macro, RefPtr<const AsmSourc
     contentLineNo++;
 }
 
+// pseudo-ops that put only data (values of expressions or strings)
+static const char* replicableDataPseudoOpNamesTbl[] =
+{
+    "ascii", "asciz", "byte", "double", "float", "half", "hword", "int",
+    "long", "octa", "quad", "short", "single", "string", "string16",
+    "string32", "string64", "word"
+};
+
+void AsmRepeat::analyzeContent()
+{
+    replicable = false;
+    operandNames.clear();
+    const char* contentEnd = content.data() + content.size();
+    for (const char* linePtr = content.data(); linePtr != contentEnd; )
+    {
+        const char* end = std::find(linePtr, contentEnd, '\n');
+        const char* nextLinePtr = (end != contentEnd) ? end+1 : end;
+        skipSpacesToEnd(linePtr, end);
+        if (linePtr == end)
+        {
+            // empty line
+            linePtr = nextLinePtr;
+            continue;
+        }
+        CString name = extractSymName(linePtr, end, false);
+        if (name.empty())
+            return;
+        skipSpacesToEnd(linePtr, end);
+        if (linePtr != end && (*linePtr == ':' || *linePtr == '='))
+            return; // label or assignment
+        bool dataPseudoOp = false;
+        if (name[0] == '.')
+        {
+            toLowerString(name);
+            const size_t tblSize = sizeof(replicableDataPseudoOpNamesTbl)/sizeof(char*);
+            if (binaryFind(replicableDataPseudoOpNamesTbl,
+                    replicableDataPseudoOpNamesTbl + tblSize, name.c_str()+1,
+                    CStringLess()) == replicableDataPseudoOpNamesTbl + tblSize)
+                return; // other pseudo-op
+            dataPseudoOp = true;
+        }
+        // check operands
+        while (linePtr != end)
+        {
+            const char c = *linePtr;
+            if (c == '"' || c == '\'')
+            {
+                // skip string or character literal
+                for (linePtr++; linePtr != end && *linePtr != c; linePtr++)
+                    if (*linePtr == '\\' && linePtr+1 != end)
+                        linePtr++;
+                if (linePtr != end)
+                    linePtr++;
+            }
+            else if (isDigit(c))
+            {
+                // skip number, but local label ('1b', '2f') depends on position
+                const char* numStart = linePtr;
+                while (linePtr != end && (isAlnum(*linePtr) || *linePtr == '.' ||
+                            *linePtr == '_'))
+                    linePtr++;
+                const char last = linePtr[-1];
+                if ((last == 'b' || last == 'B' || last == 'f' || last == 'F') &&
+                    std::find_if(numStart, linePtr-1, [](char x)
+                            { return !isDigit(x); }) == linePtr-1)
+                    return;
+            }
+            else if (isAlpha(c) || c == '_' || c == '$' || c == '.')
+            {
+                // symbol in data or current position: data can depend on
+                // iteration (for example '.for' iterator), no replication
+                if (dataPseudoOp || c == '.')
+                    return;
+                operandNames.push_back(extractScopedSymName(linePtr, end, false));
+                if (operandNames.back().empty())
+                    return;
+            }
+            else if (c == '\\')
+                return;
+            else
+                linePtr++;
+        }
+        linePtr = nextLinePtr;
+    }
+    std::sort(operandNames.begin(), operandNames.end());
+    operandNames.resize(std::unique(operandNames.begin(), operandNames.end()) -
+                operandNames.begin());
+    replicable = true;
+}
+
 AsmFor::AsmFor(const AsmSourcePos& _pos, void* _iterSymEntry,
                 AsmExpression* _condExpr, AsmExpression* _nextExpr)
         : AsmRepeat(_pos, 0), iterSymEntry(_iterSymEntry), condExpr(_condExpr),
@@ -165,28 +479,17 @@ static const size_t AsmParserLineMaxSize = 200;
 
 AsmStreamInputFilter::AsmStreamInputFilter(const CString& filename)
     : AsmInputFilter(AsmInputFilterType::STREAM), managed(true),
-        stream(nullptr), mode(LineMode::NORMAL), stmtPos(0)
+        stream(nullptr), mode(LineMode::NORMAL), stmtPos(0),
+        mappedData(nullptr), mappedSize(0), mappedPos(0)
 {
-    try
-    {
-        source = RefPtr<const AsmSource>(new AsmFile(filename));
-        stream = new std::ifstream(filename.c_str(), std::ios::binary);
-        if (!*stream)
-            throw AsmException(std::string("Can't open source file '")+
-                    filename.c_str()+"'");
-        stream->exceptions(std::ios::badbit);
-        buffer.reserve(AsmParserLineMaxSize);
-    }
-    catch(...)
-    {
-        delete stream;
-        throw;
-    }
+    source = RefPtr<const AsmSource>(new AsmFile(filename));
+    openFile(filename);
 }
 
 AsmStreamInputFilter::AsmStreamInputFilter(std::istream& is, const CString& filename)
     : AsmInputFilter(AsmInputFilterType::STREAM),
-      managed(false), stream(&is), mode(LineMode::NORMAL), stmtPos(0)
+      managed(false), stream(&is), mode(LineMode::NORMAL), stmtPos(0),
+      mappedData(nullptr), mappedSize(0), mappedPos(0)
 {
     source = RefPtr<const AsmSource>(new AsmFile(filename));
     stream->exceptions(std::ios::badbit);
@@ -196,36 +499,23 @@ AsmStreamInputFilter::AsmStreamInputFilter(std::istream& is, const CString& file
 AsmStreamInputFilter::AsmStreamInputFilter(const AsmSourcePos& pos,
            const CString& filename)
     : AsmInputFilter(AsmInputFilterType::STREAM),
-      managed(true), stream(nullptr), mode(LineMode::NORMAL), stmtPos(0)
+      managed(true), stream(nullptr), mode(LineMode::NORMAL), stmtPos(0),
+      mappedData(nullptr), mappedSize(0), mappedPos(0)
 {
-    try
-    {
-        if (!pos.macro)
-            source = RefPtr<const AsmSource>(new AsmFile(pos.source, pos.lineNo,
-                             pos.colNo, filename));
-        else // if inside macro
-            source = RefPtr<const AsmSource>(new AsmFile(
-                RefPtr<const AsmSource>(new AsmMacroSource(pos.macro, pos.source)),
-                     pos.lineNo, pos.colNo, filename));
-        
-        // open file
-        stream = new std::ifstream(filename.c_str(), std::ios::binary);
-        if (!*stream)
-            throw AsmException(std::string("Can't open source file '")+
-                        filename.c_str()+"'");
-        stream->exceptions(std::ios::badbit);
-        buffer.reserve(AsmParserLineMaxSize);
-    }
-    catch(...)
-    {
-        delete stream;
-        throw;
-    }
+    if (!pos.macro)
+        source = RefPtr<const AsmSource>(new AsmFile(pos.source, pos.lineNo,
+                         pos.colNo, filename));
+    else // if inside macro
+        source = RefPtr<const AsmSource>(new AsmFile(
+            RefPtr<const AsmSource>(new AsmMacroSource(pos.macro, pos.source)),
+                 pos.lineNo, pos.colNo, filename));
+    openFile(filename);
 }
 
 AsmStreamInputFilter::AsmStreamInputFilter(const AsmSourcePos& pos, std::istream& is,
         const CString& filename) : AsmInputFilter(AsmInputFilterType::STREAM),
-        managed(false), stream(&is), mode(LineMode::NORMAL), stmtPos(0)
+        managed(false), stream(&is), mode(LineMode::NORMAL), stmtPos(0),
+        mappedData(nullptr), mappedSize(0), mappedPos(0)
 {
     if (!pos.macro)
         source = RefPtr<const AsmSource>(new AsmFile(pos.source, pos.lineNo,
@@ -244,9 +534,252 @@ AsmStreamInputFilter::~AsmStreamInputFilter()
         delete stream;
 }
 
+void AsmStreamInputFilter::openFile(const CString& filename)
+{
+    buffer.reserve(AsmParserLineMaxSize);
+    try
+    {
+        // regular file: map it to memory
+        mappedFile.reset(new MemoryMappedFile(filename.c_str()));
+        mappedData = reinterpret_cast<const char*>(mappedFile->getData());
+        mappedSize = mappedFile->getSize();
+        return;
+    }
+    catch(const Exception& ex)
+    { mappedFile.reset(); }
+    
+    // otherwise (pipe, device) open stream
+    try
+    {
+        stream = new std::ifstream(filename.c_str(), std::ios::binary);
+        if (!*stream)
+            throw AsmException(std::string("Can't open source file '")+
+                    filename.c_str()+"'");
+        stream->exceptions(std::ios::badbit);
+    }
+    catch(...)
+    {
+        delete stream;
+        stream = nullptr;
+        throw;
+    }
+}
+
+size_t AsmStreamInputFilter::readInput(size_t destPos)
+{
+    if (!mappedFile)
+    {
+        if (destPos == buffer.size())
+            buffer.resize(std::max(AsmParserLineMaxSize, (destPos>>1)+destPos));
+        stream->read(buffer.data()+destPos, buffer.size()-destPos);
+        const size_t readed = stream->gcount();
+        buffer.resize(destPos+readed);
+        return readed;
+    }
+    /* copy from mapped file whole current line (to first newline not preceded by
+     * backslash), because next line can be returned directly from mapped file.
+     * line is not split between reads, hence result does not depend on buffer size */
+    const char* start = mappedData + mappedPos;
+    const char* end = mappedData + mappedSize;
+    const char* lineEnd = start;
+    while (lineEnd != end)
+    {
+        const char* nl = (const char*)::memchr(lineEnd, '\n', end-lineEnd);
+        if (nl == nullptr)
+        {
+            lineEnd = end;
+            break;
+        }
+        lineEnd = nl+1;
+        if (nl == mappedData || nl[-1] != '\\')
+            break;
+    }
+    const size_t toRead = lineEnd-start;
+    buffer.resize(destPos+toRead);
+    ::memcpy(buffer.data()+destPos, start, toRead);
+    mappedPos += toRead;
+    return toRead;
+}
+
+/*
+ * line scanner - finds first character that requires handling by line filter
+ */
+
+/* table of characters that requires filtering by readLine:
+ * comments, strings, statement separators, backslashes and spaces other than ' '.
+ * '\n' finishes line, '*' and '\\' requires checking neighbours.
+ * bit 0 - special character, bit 1 - space ' ' */
+static const cxbyte asmLineSpecialCharTable[256] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0
+    /* rest of characters are not special */
+};
+
+static const char* findLineSpecialCharScalar(const char* s, const char* end,
+                bool withSpace)
+{
+    const cxbyte mask = withSpace ? 3 : 1;
+    for (; s != end; s++)
+        if ((asmLineSpecialCharTable[cxbyte(*s)] & mask) != 0)
+            break;
+    return s;
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+#  define ASM_LINESCAN_SSE2 1
+#endif
+#if defined(__GNUC__) && defined(HAVE_ARCH_INTEL) && !defined(__AVX2__)
+// choose AVX2 scanner at runtime
+#  define ASM_LINESCAN_AVX2_DISPATCH 1
+#endif
+
+#if defined(ASM_LINESCAN_SSE2)
+#include <emmintrin.h>
+
+static const char* findLineSpecialCharSSE2(const char* s, const char* end,
+                bool withSpace)
+{
+    // if not withSpace, then compare with newline again
+    const __m128i extraChar = _mm_set1_epi8(withSpace ? ' ' : '\n');
+    const __m128i spaceStart = _mm_set1_epi8(9);
+    const __m128i spaceRange = _mm_set1_epi8(4);
+    for (; end-s >= 16; s += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)s);
+        // spaces between '\t' and '\r'
+        const __m128i t = _mm_sub_epi8(v, spaceStart);
+        __m128i m = _mm_cmpeq_epi8(_mm_min_epu8(t, spaceRange), t);
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, extraChar));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('#')));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('*')));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(';')));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+        const uint32_t bits = _mm_movemask_epi8(m);
+        if (bits != 0)
+            return s + CTZ32(bits);
+    }
+    return findLineSpecialCharScalar(s, end, withSpace);
+}
+#endif
+
+#if defined(__AVX2__) || defined(ASM_LINESCAN_AVX2_DISPATCH)
+#include <immintrin.h>
+
+#ifdef ASM_LINESCAN_AVX2_DISPATCH
+__attribute__((target("avx2")))
+#endif
+static const char* findLineSpecialCharAVX2(const char* s, const char* end,
+                bool withSpace)
+{
+    // if not withSpace, then compare with newline again
+    const __m256i extraChar = _mm256_set1_epi8(withSpace ? ' ' : '\n');
+    const __m256i spaceStart = _mm256_set1_epi8(9);
+    const __m256i spaceRange = _mm256_set1_epi8(4);
+    for (; end-s >= 32; s += 32)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)s);
+        // spaces between '\t' and '\r'
+        const __m256i t = _mm256_sub_epi8(v, spaceStart);
+        __m256i m = _mm256_cmpeq_epi8(_mm256_min_epu8(t, spaceRange), t);
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, extraChar));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('#')));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\'')));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('*')));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(';')));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')));
+        const uint32_t bits = _mm256_movemask_epi8(m);
+        if (bits != 0)
+            return s + CTZ32(bits);
+    }
+    return findLineSpecialCharScalar(s, end, withSpace);
+}
+#endif
+
+typedef const char* (*LineSpecialCharFinder)(const char* s, const char* end,
+                bool withSpace);
+
+static LineSpecialCharFinder chooseLineSpecialCharFinder()
+{
+#if defined(__AVX2__)
+    return findLineSpecialCharAVX2;
+#else
+#  ifdef ASM_LINESCAN_AVX2_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return findLineSpecialCharAVX2;
+#  endif
+#  ifdef ASM_LINESCAN_SSE2
+    return findLineSpecialCharSSE2;
+#  else
+    return findLineSpecialCharScalar;
+#  endif
+#endif
+}
+
+static const LineSpecialCharFinder findLineSpecialChar = chooseLineSpecialCharFinder();
+
+/* find end of line (newline or end of data) if line does not require filtering,
+ * otherwise returns null */
+static const char* findPlainLineEnd(const char* lineStart, const char* end)
+{
+    for (const char* s = lineStart; ; s++)
+    {
+        s = findLineSpecialChar(s, end, false);
+        if (s == end)
+            break;
+        if (*s == '\n')
+            return s;
+        if (*s == '*')
+        {
+            // only '/*' begins comment
+            if (s != lineStart && s[-1] == '/')
+                return nullptr;
+            continue;
+        }
+        if (*s == '\\')
+        {
+            // only backslash at end of line joins lines
+            if (s+1 == end || s[1] == '\n')
+                return nullptr;
+            continue;
+        }
+        return nullptr;
+    }
+    return end;
+}
+
 const char* AsmStreamInputFilter::readLine(Assembler& assembler, size_t& lineSize)
 {
     colTranslations.clear();
+    if (mappedPos < mappedSize && pos == buffer.size() && mode == LineMode::NORMAL)
+    {
+        // try to return line directly from mapped file
+        const char* lineStart = mappedData + mappedPos;
+        const char* end = mappedData + mappedSize;
+        const char* lineEnd = findPlainLineEnd(lineStart, end);
+        if (lineEnd != nullptr)
+        {
+            colTranslations.push_back({ssize_t(-stmtPos), lineNo});
+            lineSize = lineEnd-lineStart;
+            mappedPos += lineSize;
+            if (lineEnd != end)
+            {
+                // skip newline
+                mappedPos++;
+                lineNo++;
+                stmtPos = 0;
+            }
+            return lineStart;
+        }
+    }
     bool endOfLine = false;
     size_t lineStart = pos;
     size_t joinStart = pos; // join Start - physical line start
@@ -265,6 +798,20 @@ const char* AsmStreamInputFilter::readLine(Assembler& assembler, size_t& lineSiz
                 {
                     // putting regular string (no spaces)
                     do {
+                        // copy run of plain characters at once
+                        const char* runEnd = findLineSpecialChar(buffer.data()+pos,
+                                    buffer.data()+buffer.size(), true);
+                        const size_t runSize = runEnd - (buffer.data()+pos);
+                        if (runSize != 0)
+                        {
+                            ::memmove(buffer.data()+destPos, buffer.data()+pos, runSize);
+                            destPos += runSize;
+                            pos += runSize;
+                            backslash = false;
+                            if (pos == buffer.size() || isSpace(buffer[pos]) ||
+                                buffer[pos] == ';')
+                                break;
+                        }
                         backslash = (buffer[pos] == '\\');
                         if (buffer[pos] == '*' &&
                             destPos > 0 && buffer[destPos-1] == '/')
@@ -356,12 +903,17 @@ const char* AsmStreamInputFilter::readLine(Assembler& assembler, size_t& lineSiz
             }
             case LineMode::LINE_COMMENT:
             {
-                while (pos < buffer.size() && buffer[pos] != '\n')
+                // skipping bytes until newline or buffer end
+                const char* nl = (const char*)::memchr(buffer.data()+pos, '\n',
+                            buffer.size()-pos);
+                const size_t skipSize = (nl != nullptr) ?
+                            nl - (buffer.data()+pos) : buffer.size()-pos;
+                if (skipSize != 0)
                 {
-                    // skipping bytes until newline or buffer end
-                    backslash = (buffer[pos] == '\\');
-                    pos++;
-                    buffer[destPos++] = ' ';
+                    backslash = (buffer[pos+skipSize-1] == '\\');
+                    ::memset(buffer.data()+destPos, ' ', skipSize);
+                    pos += skipSize;
+                    destPos += skipSize;
                 }
                 if (pos < buffer.size())
                 {
@@ -496,16 +1048,11 @@ const char* AsmStreamInputFilter::readLine(Assembler& assembler, size_t& lineSiz
                 pos = destPos;
                 lineStart = 0;
             }
-            if (pos == buffer.size())
-                buffer.resize(std::max(AsmParserLineMaxSize, (pos>>1)+pos));
-            
-            stream->read(buffer.data()+pos, buffer.size()-pos);
-            const size_t readed = stream->gcount();
-            buffer.resize(pos+readed);
+            const size_t readed = readInput(pos);
             if (readed == 0)
             {
-                // end of file. check comments
-                if (mode == LineMode::LONG_COMMENT && lineStart!=pos)
+                // end of file. check comments (if line is not empty)
+                if (mode == LineMode::LONG_COMMENT && destPos!=lineStart)
                     assembler.printError({lineNo, pos-joinStart+stmtPos+1},
                            "Unterminated multi-line comment");
                 if (destPos-lineStart == 0)
@@ -573,6 +1120,61 @@ const char* AsmMacroInputFilter::readLine(Assembler& assembler, size_t& lineSize
     
     const char* content = macro->getContent().data();
     
+    if (!alternateMacro)
+    {
+        // fast path: execute compiled operations of line
+        const AsmMacro::Line& line = macro->getLine(contentLineNo);
+        const AsmMacro::Op* ops = macro->getOps().data();
+        size_t destLineStart = 0;
+        colTranslations.push_back({ ssize_t(-realLinePos), line.firstLineNo });
+        for (size_t i = line.opsStart; i < line.opsEnd; i++)
+        {
+            const AsmMacro::Op& op = ops[i];
+            switch(op.type)
+            {
+                case AsmMacro::OpType::TEXT:
+                    buffer.insert(buffer.end(), content + op.start,
+                                  content + op.start + op.size);
+                    break;
+                case AsmMacro::OpType::ARG:
+                {
+                    const CString& value = argMap[op.start].second;
+                    buffer.insert(buffer.end(), value.c_str(),
+                                  value.c_str() + value.size());
+                    break;
+                }
+                case AsmMacro::OpType::COUNT:
+                {
+                    char numBuf[32];
+                    const size_t numLen = itocstrCStyle(macroCount, numBuf, 32);
+                    buffer.insert(buffer.end(), numBuf, numBuf+numLen);
+                    break;
+                }
+                case AsmMacro::OpType::COLTRANS:
+                case AsmMacro::OpType::SKIPTRANS:
+                    if (op.type == AsmMacro::OpType::COLTRANS)
+                        colTranslations.push_back({ ssize_t(buffer.size()), op.lineNo });
+                    if (op.newLine)
+                    {
+                        /// real new line, reset real line position
+                        realLinePos = 0;
+                        destLineStart = buffer.size();
+                    }
+                    break;
+            }
+        }
+        lineSize = buffer.size();
+        if (line.endTrans == 1) /// real new line, reset real line position
+            realLinePos = 0;
+        else if (line.endTrans == 2) // determine position in destination source
+            realLinePos += lineSize - destLineStart+1;
+        pos = line.nextPos;
+        lineNo = line.lineNo;
+        nextSourceTrans();
+        contentLineNo++;
+        return (!buffer.empty()) ? buffer.data() : "";
+    }
+    
     size_t nextLinePos = pos;
     while (nextLinePos < contentSize && content[nextLinePos] != '\n')
         nextLinePos++;
@@ -854,16 +1456,7 @@ const char* AsmMacroInputFilter::readLine(Assembler& assembler, size_t& lineSize
         pos++; // skip newline
     }
     lineNo = curColTrans->lineNo;
-    // move to next source translation
-    if (sourceTransIndex+1 < macro->getSourceTransSize())
-    {
-        const AsmMacro::SourceTrans& fpos = macro->getSourceTrans(sourceTransIndex+1);
-        if (fpos.lineNo == contentLineNo)
-        {
-            source = fpos.source;
-            sourceTransIndex++;
-        }
-    }
+    nextSourceTrans();
     contentLineNo++;
     if (localStmtStart!=nullptr)
     {
@@ -880,6 +1473,20 @@ const char* AsmMacroInputFilter::readLine(Assembler& assembler, size_t& lineSize
     return (!buffer.empty()) ? buffer.data() : "";
 }
 
+void AsmMacroInputFilter::nextSourceTrans()
+{
+    // move to next source translation
+    if (sourceTransIndex+1 < macro->getSourceTransSize())
+    {
+        const AsmMacro::SourceTrans& fpos = macro->getSourceTrans(sourceTransIndex+1);
+        if (fpos.lineNo == contentLineNo)
+        {
+            source = fpos.source;
+            sourceTransIndex++;
+        }
+    }
+}
+
 bool AsmMacroInputFilter::addLocal(const CString& name, uint64_t localNo)
 {
     if (binaryMapFind(argMap.begin(), argMap.end(), name) != argMap.end())
@@ -893,7 +1500,7 @@ bool AsmMacroInputFilter::addLocal(const CString& name, uint64_t localNo)
 
 AsmRepeatInputFilter::AsmRepeatInputFilter(const AsmRepeat* _repeat) :
           AsmInputFilter(AsmInputFilterType::REPEAT), repeat(_repeat),
-          repeatCount(0), contentLineNo(0), sourceTransIndex(0)
+          repeatCount(0), contentLineNo(0), sourceTransIndex(0), replicationTrial(false)
 {
     if (_repeat->getSourceTransSize()!=0)
     {
@@ -908,6 +1515,98 @@ AsmRepeatInputFilter::AsmRepeatInputFilter(const AsmRepeat* _repeat) :
     lineNo = !_repeat->getColTranslations().empty() ? curColTrans[0].lineNo : 0;
 }
 
+void AsmRepeatInputFilter::startReplication(Assembler& assembler)
+{
+    const cxuint sectionId = assembler.currentSection;
+    if (!repeat->isReplicable() || sectionId >= assembler.sections.size() ||
+        !assembler.isWriteableSection())
+        return;
+    AsmSection& section = assembler.sections[sectionId];
+    if (assembler.currentOutPos != section.content.size())
+        return;
+    // record register usages of instructions from iteration
+    // (only sections with instructions have usage handler)
+    const bool usagesRecorded = (section.usageHandler != nullptr);
+    if (usagesRecorded)
+        section.usageHandler->startRecording();
+    replState = { sectionId, assembler.currentKernel, assembler.currentScope,
+        assembler.sections.size(), section.content.size(), section.codeFlow.size(),
+        assembler.relocations.size(), assembler.unevalExpressions.size(),
+        assembler.currentScope->symbolMap.size(),
+        assembler.globalScope.symbolMap.size(), assembler.messagesNum,
+        assembler.macroCount, 0, usagesRecorded };
+    replicationTrial = true;
+}
+
+bool AsmRepeatInputFilter::checkReplication(Assembler& assembler,
+                const void* iterSymEntry)
+{
+    replicationTrial = false;
+    const cxuint sectionId = replState.sectionId;
+    if (replState.usagesRecorded)
+        assembler.sections[sectionId].usageHandler->stopRecording();
+    // iteration must only put data or instructions to this same section
+    if (assembler.currentSection != sectionId ||
+        assembler.currentKernel != replState.kernelId ||
+        assembler.currentScope != replState.scope ||
+        assembler.sections.size() != replState.sectionsNum ||
+        assembler.relocations.size() != replState.relocationsNum ||
+        assembler.unevalExpressions.size() != replState.unevalExprsNum ||
+        assembler.currentScope->symbolMap.size() != replState.symbolsNum ||
+        assembler.globalScope.symbolMap.size() != replState.globalSymbolsNum ||
+        assembler.messagesNum != replState.messagesNum ||
+        assembler.macroCount != replState.macroCount)
+        return false;
+    const AsmSection& section = assembler.sections[sectionId];
+    if (section.codeFlow.size() != replState.codeFlowSize ||
+        assembler.currentOutPos != section.content.size() ||
+        section.content.size() < replState.contentStart)
+        return false;
+    // usage handler created by iteration: its register usages are not recorded
+    if (!replState.usagesRecorded && section.usageHandler != nullptr)
+        return false;
+    // names in operands must not be symbols whose value can be changed
+    for (const CString& name: repeat->getOperandNames())
+    {
+        const AsmSymbolEntry* symEntry = assembler.findExistingSymbol(name);
+        if (symEntry != nullptr && (symEntry == iterSymEntry ||
+            !symEntry->second.hasValue || symEntry->second.base ||
+            symEntry->second.sectionId != ASMSECT_ABS))
+            return false;
+    }
+    replState.contentSize = section.content.size() - replState.contentStart;
+    return true;
+}
+
+void AsmRepeatInputFilter::replicateOutput(Assembler& assembler, uint64_t count)
+{
+    AsmSection& section = assembler.sections[replState.sectionId];
+    std::vector<cxbyte>& content = section.content;
+    const size_t start = replState.contentStart;
+    const size_t size = replState.contentSize;
+    // size of output is known, hence reserve it at once
+    if (size != 0 && count <= (content.max_size()-content.size()) / size)
+        content.reserve(content.size() + size*count);
+    const std::vector<AsmRegVarUsage> noUsages;
+    const std::vector<AsmRegVarUsage>& usages = replState.usagesRecorded ?
+                section.usageHandler->getRecordedUsages() : noUsages;
+    if (size != 0)
+        for (uint64_t i = 0; i < count; i++)
+        {
+            const size_t destPos = content.size();
+            content.resize(destPos + size);
+            std::copy(content.begin() + start, content.begin() + start + size,
+                      content.begin() + destPos);
+            // put register usages of copied instructions
+            for (AsmRegVarUsage rvu: usages)
+            {
+                rvu.offset = rvu.offset - start + destPos;
+                section.usageHandler->pushUsage(rvu);
+            }
+        }
+    assembler.currentOutPos = content.size();
+}
+
 const char* AsmRepeatInputFilter::readLine(Assembler& assembler, size_t& lineSize)
 {
     colTranslations.clear();
@@ -917,6 +1616,12 @@ const char* AsmRepeatInputFilter::readLine(Assembler& assembler, size_t& lineSiz
     if (pos == contentSize)
     {
         repeatCount++;
+        if (replicationTrial && checkReplication(assembler, nullptr))
+        {
+            // put output of remaining iterations
+            replicateOutput(assembler, repeat->getRepeatsNum() - repeatCount);
+            repeatCount = repeat->getRepeatsNum();
+        }
         if (repeatCount == repeat->getRepeatsNum() || contentSize==0)
         {
             lineSize = 0;
@@ -929,6 +1634,9 @@ const char* AsmRepeatInputFilter::readLine(Assembler& assembler, size_t& lineSiz
         source = RefPtr<const AsmSource>(new AsmRepeatSource(
             repeat->getSourceTrans(0).source, repeatCount, repeat->getRepeatsNum()));
     }
+    if (repeatCount <= 1 && contentLineNo == 0 && repeatCount+1 < repeat->getRepeatsNum())
+        // first or second iteration: try to replicate its output later
+        startReplication(assembler);
     const char* content = repeat->getContent().data();
     size_t oldPos = pos;
     while (pos < contentSize && content[pos] != '\n')
@@ -971,7 +1679,10 @@ const char* AsmForInputFilter::readLine(Assembler& assembler, size_t& lineSize)
     const AsmFor* asmFor = static_cast<const AsmFor*>(repeat.get());
     const LineTrans* colTransEnd = repeatColTrans.data()+ repeatColTrans.size();
     const size_t contentSize = repeat->getContent().size();
-    if (pos == contentSize)
+    // if true, then output of next iterations will be replicated
+    const bool replicate = (pos == contentSize && replicationTrial &&
+                checkReplication(assembler, asmFor->getIterSymEntry()));
+    while (pos == contentSize)
     {
         repeatCount++;
         uint64_t value = 0;
@@ -1015,6 +1726,12 @@ const char* AsmForInputFilter::readLine(Assembler& assembler, size_t& lineSize)
             lineSize = 0;
             return nullptr;
         }
+        if (replicate)
+        {
+            // put output of iteration and evaluate condition again
+            replicateOutput(assembler, 1);
+            continue;
+        }
         
         sourceTransIndex = 0;
         curColTrans = repeat->getColTranslations().data();
@@ -1023,6 +1740,9 @@ const char* AsmForInputFilter::readLine(Assembler& assembler, size_t& lineSize)
         source = RefPtr<const AsmSource>(new AsmRepeatSource(
             repeat->getSourceTrans(0).source, repeatCount, repeat->getRepeatsNum()));
     }
+    if (repeatCount <= 1 && contentLineNo == 0)
+        // first or second iteration: try to replicate its output later
+        startReplication(assembler);
     const char* content = repeat->getContent().data();
     size_t oldPos = pos;
     while (pos < contentSize && content[pos] != '\n')
@@ -20,15 +20,20 @@
 #include <CLRX/Config.h>
 #include <string>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <vector>
 #include <stack>
 #include <deque>
 #include <utility>
+#include <iterator>
 #include <algorithm>
 #include <CLRX/utils/Utilities.h>
 #include <CLRX/utils/MemAccess.h>
 #include <CLRX/utils/GPUId.h>
+#include <CLRX/utils/InputOutput.h>
+#include <CLRX/amdbin/AmdBinGen.h>
+#include <CLRX/amdbin/GalliumBinaries.h>
 #include <CLRX/amdasm/Assembler.h>
 #include "AsmInternals.h"
 
@@ -87,6 +92,33 @@ AsmSection& AsmSection::operator=(const AsmSection& section)
     return *this;
 }
 
+// move constructor - content is not copied while table of sections grows
+AsmSection::AsmSection(AsmSection&& section) noexcept
+        : name(section.name), kernelId(section.kernelId), type(section.type),
+          flags(section.flags), alignment(section.alignment), size(section.size),
+          relSpace(section.relSpace), relAddress(section.relAddress),
+          content(std::move(section.content)),
+          usageHandler(std::move(section.usageHandler)),
+          codeFlow(std::move(section.codeFlow))
+{ }
+
+// move assignment
+AsmSection& AsmSection::operator=(AsmSection&& section) noexcept
+{
+    name = section.name;
+    kernelId = section.kernelId;
+    type = section.type;
+    flags = section.flags;
+    alignment = section.alignment;
+    size = section.size;
+    content = std::move(section.content);
+    relSpace = section.relSpace;
+    relAddress = section.relAddress;
+    usageHandler = std::move(section.usageHandler);
+    codeFlow = std::move(section.codeFlow);
+    return *this;
+}
+
 // open code region - add new code region if needed
 // called when kernel label encountered or region for this kernel begins
 void AsmKernel::openCodeRegion(size_t offset)
@@ -172,7 +204,7 @@ const cxbyte CLRX::tokenCharTable[96] =
     return CString(startString, string);
 }
 
-CString CLRX::extractScopedSymName(const char*& string, const char* end,
+const char* CLRX::skipScopedSymName(const char*& string, const char* end,
            bool localLabelSymName)
 {
     const char* startString = string;
@@ -186,7 +218,7 @@ CString CLRX::extractScopedSymName(const char*& string, const char* end,
         // if not part of binary number or illegal bin number
         if (startString != string && (string!=end && (isAlnum(*string))))
             string = startString;
-        return CString(startString, string);
+        return string;
     }
     while (string != end)
     {
@@ -206,7 +238,15 @@ CString CLRX::extractScopedSymName(const char*& string, const char* end,
             break;
         lastString = string;
     }
-    return CString(startString, lastString);
+    return lastString;
+}
+
+CString CLRX::extractScopedSymName(const char*& string, const char* end,
+           bool localLabelSymName)
+{
+    const char* startString = string;
+    const char* nameEnd = skipScopedSymName(string, end, localLabelSymName);
+    return CString(startString, nameEnd);
 }
 
 // skip spaces, labels and '\@' and \(): move to statement skipping all labels
@@ -569,8 +609,9 @@ void AsmParseUtils::setSymbolValue(Assembler& asmr, const char* linePtr,
     if (!checkGarbagesAtEnd(asmr, linePtr))
         return;
     
+    AsmScope* symScope;
     std::pair<AsmSymbolEntry*, bool> res = asmr.insertSymbolInScope(symName,
-                AsmSymbol(sectionId, value));
+                AsmSymbol(sectionId, value), &symScope);
     if (!res.second)
     {
         // if symbol found
@@ -582,6 +623,8 @@ void AsmParseUtils::setSymbolValue(Assembler& asmr, const char* linePtr,
     }
     else // set hasValue (by isResolvableSection
         res.first->second.hasValue = asmr.isResolvableSection(sectionId);
+    if (!res.first->second.hasValue) // resolved at end of assembly
+        asmr.addPendingSymbol(symScope, *res.first);
 }
 
 
@@ -594,30 +637,38 @@ ISAAssembler::~ISAAssembler()
 void AsmSymbol::removeOccurrenceInExpr(AsmExpression* expr, size_t argIndex,
                size_t opIndex)
 {
-    auto it = std::remove(occurrencesInExprs.begin(), occurrencesInExprs.end(),
+    // recently added occurrences are removed mostly, hence search from end
+    auto it = std::find(occurrencesInExprs.rbegin(), occurrencesInExprs.rend(),
             AsmExprSymbolOccurrence{expr, argIndex, opIndex});
-    occurrencesInExprs.resize(it-occurrencesInExprs.begin());
+    if (it == occurrencesInExprs.rend())
+        return;
+    auto endIt = std::remove(std::next(it).base(), occurrencesInExprs.end(),
+            AsmExprSymbolOccurrence{expr, argIndex, opIndex});
+    occurrencesInExprs.resize(endIt-occurrencesInExprs.begin());
 }
 
 void AsmSymbol::clearOccurrencesInExpr()
 {
-    /* iteration with index and occurrencesInExprs.size() is required for checking size
-     * after expression deletion that removes occurrences in exprs in this symbol */
-    for (size_t i = 0; i < occurrencesInExprs.size(); i++)
+    /* detach occurrences and delete expressions after traversal, hence
+     * deleted expression do not search its occurrences in this symbol
+     * (it was quadratic for many occurrences) */
+    std::vector<AsmExprSymbolOccurrence> occurrences;
+    occurrences.swap(occurrencesInExprs);
+    std::vector<AsmExpression*> exprsToDelete;
+    for (const AsmExprSymbolOccurrence& occur: occurrences)
     {
-        auto& occur = occurrencesInExprs[i];
-        if (occur.expression!=nullptr && !occur.expression->unrefSymOccursNum())
-        {
-            // delete and move back iteration by number of removed elements
-            const size_t oldSize = occurrencesInExprs.size();
-            AsmExpression* occurExpr = occur.expression;
-            occur.expression = nullptr;
-            delete occurExpr;
-            // subtract number of removed elements from counter
-            i -= oldSize-occurrencesInExprs.size();
-        }
+        if (occur.expression==nullptr)
+            continue;
+        if (!occur.expression->unrefSymOccursNum())
+            exprsToDelete.push_back(occur.expression);
+        else
+            /* expression still waits for other symbols, hence detach it from
+             * this symbol (it can be deleted before expression). expression will
+             * fail while evaluating, because this symbol stays unresolved */
+            occur.expression->detachOccurrence(occur);
     }
-    occurrencesInExprs.clear();
+    for (AsmExpression* expr: exprsToDelete)
+        delete expr;
 }
 
 void AsmSymbol::undefine()
@@ -628,7 +679,9 @@ void AsmSymbol::undefine()
         delete expression;
         expression = nullptr;
     }
+    const bool oldPending = pending;
     *this = AsmSymbol();
+    pending = oldPending; // symbol is still in pending symbols of scope
 }
 
 void Assembler::undefineSymbol(AsmSymbolEntry& symEntry)
@@ -637,6 +690,86 @@ void Assembler::undefineSymbol(AsmSymbolEntry& symEntry)
     symEntry.second.undefine();
 }
 
+const AsmNameId AsmNamePool::NONE;
+
+AsmNamePool::AsmNamePool() : chunkPtr(nullptr), chunkFree(0)
+{ }
+
+size_t AsmNamePool::hashName(const char* name, size_t length)
+{
+    // FNV-1a hash
+    size_t hash = size_t(14695981039346656037ULL);
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ cxbyte(name[i])) * size_t(1099511628211ULL);
+    return hash;
+}
+
+size_t AsmNamePool::findSlot(const char* name, size_t length, size_t hash) const
+{
+    const size_t mask = table.size()-1;
+    size_t i = hash & mask;
+    for (; table[i] != NONE; i = (i+1) & mask)
+    {
+        const Entry& entry = entries[table[i]];
+        if (entry.hash == hash && entry.length == length &&
+            ::memcmp(entry.name, name, length) == 0)
+            break;
+    }
+    return i;
+}
+
+const char* AsmNamePool::allocName(const char* name, size_t length)
+{
+    if (length+1 > chunkFree)
+    {
+        // allocate new chunk (big names gets own chunk)
+        const size_t chunkSize = std::max(length+1, size_t(16384));
+        chunks.push_back(std::unique_ptr<char[]>(new char[chunkSize]));
+        chunkPtr = chunks.back().get();
+        chunkFree = chunkSize;
+    }
+    char* out = chunkPtr;
+    ::memcpy(out, name, length);
+    out[length] = 0;
+    chunkPtr += length+1;
+    chunkFree -= length+1;
+    return out;
+}
+
+void AsmNamePool::rehash(size_t newSize)
+{
+    table.assign(newSize, NONE);
+    const size_t mask = newSize-1;
+    for (AsmNameId id = 0; id < entries.size(); id++)
+    {
+        size_t i = entries[id].hash & mask;
+        while (table[i] != NONE)
+            i = (i+1) & mask;
+        table[i] = id;
+    }
+}
+
+AsmNameId AsmNamePool::find(const char* name, size_t length) const
+{
+    if (table.empty())
+        return NONE;
+    return table[findSlot(name, length, hashName(name, length))];
+}
+
+AsmNameId AsmNamePool::intern(const char* name, size_t length)
+{
+    if ((entries.size()+1)*2 > table.size())
+        rehash(table.empty() ? 256 : table.size()<<1);
+    const size_t hash = hashName(name, length);
+    const size_t slot = findSlot(name, length, hash);
+    if (table[slot] != NONE)
+        return table[slot];
+    const AsmNameId id = entries.size();
+    entries.push_back(Entry{ allocName(name, length), length, hash });
+    table[slot] = id;
+    return id;
+}
+
 struct CLRX_INTERNAL ScopeStackElem0
 {
     AsmScope* scope;
@@ -660,10 +793,13 @@ AsmScope::~AsmScope()
         }
         else
         {
+            entry.scope->scopeIndex.clear();
             entry.scope->scopeMap.clear();
+            entry.scope->pendingSymbols.clear();
             /// remove expressions before symbol map deletion
             for (auto& symEntry: entry.scope->symbolMap)
                 symEntry.second.clearOccurrencesInExpr();
+            entry.scope->symbolIndex.clear();
             entry.scope->symbolMap.clear();
             if (scopeStack.size() > 1)
                 delete entry.scope;
@@ -682,8 +818,12 @@ void AsmScope::deleteSymbolsRecursively()
     {
         ScopeStackElem0& entry = scopeStack.top();
         if (entry.it == entry.scope->scopeMap.begin())
+        {
             // first touch - clear symbol map
+            entry.scope->pendingSymbols.clear();
+            entry.scope->symbolIndex.clear();
             entry.scope->symbolMap.clear();
+        }
         
         if (entry.it != entry.scope->scopeMap.end())
         {
@@ -720,6 +860,23 @@ void AsmScope::stopUsingScope(AsmScope* scope)
  * Assembler
  */
 
+// get size of rest of input stream (zero if stream is not seekable)
+static size_t getStreamRemainingSize(std::istream& is)
+{
+    const std::istream::pos_type pos = is.tellg();
+    if (pos == std::istream::pos_type(-1))
+        return 0; // not seekable (pipe or terminal)
+    is.seekg(0, std::ios::end);
+    const std::istream::pos_type endPos = is.tellg();
+    is.seekg(pos);
+    if (!is)
+    {
+        is.clear();
+        return 0;
+    }
+    return (endPos > pos) ? size_t(endPos - pos) : 0;
+}
+
 Assembler::Assembler(const CString& filename, std::istream& input, Flags _flags,
         BinaryFormat _format, GPUDeviceType _deviceType, std::ostream& msgStream,
         std::ostream& _printStream)
@@ -732,14 +889,22 @@ Assembler::Assembler(const CString& filename, std::istream& input, Flags _flags,
           globalScope({nullptr,{std::make_pair(".", AsmSymbol(0, uint64_t(0)))}}),
           currentScope(&globalScope),
           flags(_flags), 
-          lineSize(0), line(nullptr),
+          lineSize(0), line(nullptr), contentSizeHint(0),
           endOfAssembly(false),
           messageStream(msgStream),
           printStream(_printStream),
+          cache(nullptr), cacheRecording(false), cacheable(false),
+          cacheHit(false), useCachedBinary(false),
+          inputStream(nullptr), includeCache(nullptr), includeSideEffects(0),
+          includeDirCache(&AsmIncludeDirCache::getProcessCache()),
+          includeSearchStats{ 0, 0, 0 }, statsEnabled(false),
+          stats{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+          regAllocMode(AsmRegAllocMode::GRAPH_COLORING), regAllocThreadsNum(1),
           // value reference and section reference from first symbol: '.'
           currentSection(globalScope.symbolMap.begin()->second.sectionId),
           currentOutPos(globalScope.symbolMap.begin()->second.value)
 {
+    globalScope.symbolIndex.insert(namePool.intern("."), &*globalScope.symbolMap.begin());
     filenameIndex = 0;
     alternateMacro = (flags & ASM_ALTMACRO)!=0;
     buggyFPLit = (flags & ASM_BUGGYFPLIT)!=0;
@@ -749,9 +914,13 @@ Assembler::Assembler(const CString& filename, std::istream& input, Flags _flags,
     macroSubstLevel = repetitionLevel = 0;
     lineAlreadyRead = false;
     good = true;
+    messagesNum = 0;
     resolvingRelocs = false;
     formatHandler = nullptr;
+    inputStream = &input;
+    inputStreamName = filename;
     input.exceptions(std::ios::badbit);
+    contentSizeHint = getStreamRemainingSize(input)>>2;
     std::unique_ptr<AsmInputFilter> thatInputFilter(
                     new AsmStreamInputFilter(input, filename));
     asmInputFilters.push(thatInputFilter.get());
@@ -770,14 +939,22 @@ Assembler::Assembler(const Array<CString>& _filenames, Flags _flags,
           globalScope({nullptr,{std::make_pair(".", AsmSymbol(0, uint64_t(0)))}}),
           currentScope(&globalScope),
           flags(_flags), 
-          lineSize(0), line(nullptr),
+          lineSize(0), line(nullptr), contentSizeHint(0),
           endOfAssembly(false),
           messageStream(msgStream),
           printStream(_printStream),
+          cache(nullptr), cacheRecording(false), cacheable(false),
+          cacheHit(false), useCachedBinary(false),
+          inputStream(nullptr), includeCache(nullptr), includeSideEffects(0),
+          includeDirCache(&AsmIncludeDirCache::getProcessCache()),
+          includeSearchStats{ 0, 0, 0 }, statsEnabled(false),
+          stats{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+          regAllocMode(AsmRegAllocMode::GRAPH_COLORING), regAllocThreadsNum(1),
           // value reference and section reference from first symbol: '.'
           currentSection(globalScope.symbolMap.begin()->second.sectionId),
           currentOutPos(globalScope.symbolMap.begin()->second.value)
 {
+    globalScope.symbolIndex.insert(namePool.intern("."), &*globalScope.symbolMap.begin());
     filenameIndex = 0;
     filenames = _filenames;
     alternateMacro = (flags & ASM_ALTMACRO)!=0;
@@ -788,10 +965,14 @@ Assembler::Assembler(const Array<CString>& _filenames, Flags _flags,
     macroSubstLevel = repetitionLevel = 0;
     lineAlreadyRead = false;
     good = true;
+    messagesNum = 0;
     resolvingRelocs = false;
     formatHandler = nullptr;
-    std::unique_ptr<AsmInputFilter> thatInputFilter(
+    std::unique_ptr<AsmStreamInputFilter> thatInputFilter(
                 new AsmStreamInputFilter(filenames[filenameIndex++]));
+    /* estimate size of output from size of source file: instructions and data
+     * take in source several times more bytes than in output */
+    contentSizeHint = thatInputFilter->getInputSize()>>2;
     asmInputFilters.push(thatInputFilter.get());
     currentInputFilter = thatInputFilter.release();
 }
@@ -814,6 +995,7 @@ Assembler::~Assembler()
         delete entry.second;
     for (AsmScope* entry: abandonedScopes)
         delete entry;
+    globalScope.scopeIndex.clear();
     globalScope.scopeMap.clear();
     /// remove expressions before symbol snapshots
     for (auto& entry: symbolSnapshots)
@@ -1198,8 +1380,9 @@ Assembler::ParseState Assembler::parseSymbol(const char*& linePtr,
                 AsmSymbolEntry*& entry, bool localLabel, bool dontCreateSymbol)
 {
     const char* startPlace = linePtr;
-    const CString symName = extractScopedSymName(linePtr, line+lineSize, localLabel);
-    if (symName.empty())
+    // name is not copied, it is interned directly from line
+    const char* symNameEnd = skipScopedSymName(linePtr, line+lineSize, localLabel);
+    if (symNameEnd == startPlace)
     {
         // this is not symbol or a missing symbol
         while (linePtr != line+lineSize && !isSpace(*linePtr) && *linePtr != ',')
@@ -1207,23 +1390,26 @@ Assembler::ParseState Assembler::parseSymbol(const char*& linePtr,
         entry = nullptr;
         return Assembler::ParseState::MISSING;
     }
-    if (symName == ".") // any usage of '.' causes format initialization
+    if (symNameEnd-startPlace == 1 && *startPlace == '.')
     {
         // special case ('.' - always global)
-        initializeOutputFormat();
+        initializeOutputFormat(); // any usage of '.' causes format initialization
+        markIncludeSideEffect();
         entry = &*globalScope.symbolMap.find(".");
         return Assembler::ParseState::PARSED;
     }
     
     Assembler::ParseState state = Assembler::ParseState::PARSED;
     bool symHasValue;
-    if (!isDigit(symName.front()))
+    if (!isDigit(*startPlace))
     {
         // regular symbol name (not local label)
         AsmScope* outScope;
-        CString sameSymName;
-        entry = findSymbolInScope(symName, outScope, sameSymName);
-        if (sameSymName == ".")
+        AsmScope* symScope;
+        AsmNameId symNameId;
+        entry = findSymbolInScope(startPlace, symNameEnd, outScope, symNameId,
+                    false, &symScope);
+        if (::strcmp(namePool.getName(symNameId), ".") == 0)
         {
             // illegal name of symbol (must be in global)
             printError(startPlace, "Symbol '.' can be only in global scope");
@@ -1232,39 +1418,46 @@ Assembler::ParseState Assembler::parseSymbol(const char*& linePtr,
         if (!dontCreateSymbol && entry==nullptr)
         {
             // create unresolved symbol if not found
-            std::pair<AsmSymbolMap::iterator, bool> res =
-                    outScope->symbolMap.insert(std::make_pair(sameSymName, AsmSymbol()));
-            entry = &*res.first;
-            symHasValue = res.first->second.hasValue;
+            entry = insertInNameIndexedMap(outScope->symbolMap, outScope->symbolIndex,
+                        namePool, symNameId, AsmSymbol()).first;
+            stats.symbolsNum++;
+            symHasValue = entry->second.hasValue;
+            symScope = outScope;
         }
         else // only find symbol and set isDefined and entry
             symHasValue = (entry != nullptr && entry->second.hasValue);
+        if (entry != nullptr && !symHasValue)
+            // unresolved symbol will be held by expression
+            addPendingSymbol(symScope, *entry);
     }
     else
     {
         // local labels is in global scope
+        markIncludeSideEffect();
+        const AsmNameId symNameId = namePool.intern(startPlace, symNameEnd-startPlace);
         if (!dontCreateSymbol)
         {
             // create symbol if not found
-            std::pair<AsmSymbolMap::iterator, bool> res =
-                    globalScope.symbolMap.insert(std::make_pair(symName, AsmSymbol()));
-            entry = &*res.first;
-            symHasValue = res.first->second.hasValue;
+            std::pair<AsmSymbolEntry*, bool> res = insertInNameIndexedMap(
+                        globalScope.symbolMap, globalScope.symbolIndex,
+                        namePool, symNameId, AsmSymbol());
+            entry = res.first;
+            stats.symbolsNum += res.second;
         }
         else
-        {
             // only find symbol and set isDefined and entry
-            AsmSymbolMap::iterator it = globalScope.symbolMap.find(symName);
-            entry = (it != globalScope.symbolMap.end()) ? &*it : nullptr;
-            symHasValue = (it != globalScope.symbolMap.end() && it->second.hasValue);
-        }
+            entry = findInNameIndexedMap(globalScope.symbolMap, globalScope.symbolIndex,
+                        namePool, symNameId);
+        symHasValue = (entry != nullptr && entry->second.hasValue);
+        if (entry != nullptr && !symHasValue)
+            addPendingSymbol(&globalScope, *entry);
     }
     
-    if (isDigit(symName.front()) && symName[linePtr-startPlace-1] == 'b' && !symHasValue)
+    if (isDigit(*startPlace) && symNameEnd[-1] == 'b' && !symHasValue)
     {
         // failed at finding
         std::string error = "Undefined previous local label '";
-        error.append(symName.begin(), linePtr-startPlace);
+        error.append(startPlace, symNameEnd);
         error += "'";
         printError(startPlace, error.c_str());
         state = Assembler::ParseState::FAILED;
@@ -1500,6 +1693,7 @@ bool Assembler::setSymbol(AsmSymbolEntry& symEntry, uint64_t value, cxuint secti
     symEntry.second.withUnevalExpr = false;
     if (!symEntry.second.hasValue) // if not resolved we just return
         return true; // no error
+    AsmStatsTimer timer(statsEnabled, stats.symbolResolvingTime);
     bool good = true;
     
     // resolve value of pending symbols
@@ -1534,8 +1728,10 @@ bool Assembler::setSymbol(AsmSymbolEntry& symEntry, uint64_t value, cxuint secti
                                         withSectionDiffs());
                     if (evalStatus == AsmTryStatus::FAILED)
                     {
-                        // if failed
-                        delete occurrence.expression; // delete expression
+                        // if failed, delete expression unless target symbol holds it
+                        if (target.type!=ASMXTGT_SYMBOL ||
+                            target.symbol->second.expression!=expr)
+                            delete occurrence.expression; // delete expression
                         good = false;
                         continue;
                     }
@@ -1551,7 +1747,7 @@ bool Assembler::setSymbol(AsmSymbolEntry& symEntry, uint64_t value, cxuint secti
                     }
                 }
                 // resolve expression if at resolving symbol phase
-                else if (formatHandler==nullptr ||
+                else if (expr->hasDetachedSymOccurs() || formatHandler==nullptr ||
                         !formatHandler->resolveRelocation(expr, value, sectionId))
                 {
                     // if failed
@@ -1728,7 +1924,9 @@ bool Assembler::assignSymbol(const CString& symbolName, const char* symbolPlace,
             THIS_FAIL_BY_ERROR(symbolPlace, "Symbol '.' requires a resolved expression")
     }
     
-    std::pair<AsmSymbolEntry*, bool> res = insertSymbolInScope(symbolName, AsmSymbol());
+    AsmScope* symScope;
+    std::pair<AsmSymbolEntry*, bool> res = insertSymbolInScope(symbolName,
+                AsmSymbol(), &symScope);
     if (!res.second && ((res.first->second.onceDefined || !reassign) &&
         res.first->second.isDefined()))
     {
@@ -1791,6 +1989,10 @@ bool Assembler::assignSymbol(const CString& symbolName, const char* symbolPlace,
             if (!AsmExpression::makeSymbolSnapshot(*this, symEntry, tempSymEntry,
                     &symEntry.second.occurrencesInExprs[0].expression->getSourcePos()))
                 return false;
+            // expressions must refer to the snapshot that holds their occurrences
+            for (const AsmExprSymbolOccurrence& occur:
+                        symEntry.second.occurrencesInExprs)
+                occur.expression->replaceOccurrenceSymbol(occur, tempSymEntry);
             tempSymEntry->second.occurrencesInExprs =
                         symEntry.second.occurrencesInExprs;
             // clear occurrences after copy
@@ -1800,6 +2002,9 @@ bool Assembler::assignSymbol(const CString& symbolName, const char* symbolPlace,
                           tempSymEntry->second.sectionId);
         }
     }
+    if (!symEntry.second.hasValue)
+        // expression or section of symbol can be resolved later
+        addPendingSymbol(symScope, symEntry);
     return true;
 }
 
@@ -1862,6 +2067,22 @@ void Assembler::printWarning(const AsmSourcePos& pos, const char* message)
 {
     if ((flags & ASM_WARNINGS) == 0)
         return; // do nothing
+    messagesNum++;
+    if (cacheRecording)
+    {
+        // keep warning to print it again when binary will be loaded from cache
+        std::string warning;
+        {
+            StringOStream warnStream(warning);
+            pos.print(warnStream);
+        }
+        warning.append(": Warning: ");
+        warning.append(message);
+        warning.push_back('\n');
+        messageStream.write(warning.c_str(), warning.size());
+        cacheEntry.messages.append(warning);
+        return;
+    }
     pos.print(messageStream);
     messageStream.write(": Warning: ", 11);
     messageStream.write(message, ::strlen(message));
@@ -1871,6 +2092,7 @@ void Assembler::printWarning(const AsmSourcePos& pos, const char* message)
 void Assembler::printError(const AsmSourcePos& pos, const char* message)
 {
     good = false;
+    messagesNum++;
     pos.print(messageStream);
     messageStream.write(": Error: ", 9);
     messageStream.write(message, ::strlen(message));
@@ -2020,12 +2242,16 @@ Assembler::ParseState Assembler::makeMacroSubstitution(const char* linePtr)
         return ParseState::MISSING;
     if (macroCase)
         toLowerString(macroName);
-    AsmMacroMap::const_iterator it = macroMap.find(macroName);
-    if (it == macroMap.end())
+    const AsmMacroMap::value_type* macroEntry = findMacro(macroStartPlace, macroName,
+                namePool.intern(macroName.c_str(), macroName.size()));
+    if (!includeFrames.empty())
+        recordIncludeMacro(macroName, macroEntry);
+    if (macroEntry == nullptr)
         return ParseState::MISSING; // macro not found
+    AsmStatsTimer timer(statsEnabled, stats.macroExpansionTime);
     
     /* parse arguments */
-    RefPtr<const AsmMacro> macro = it->second;
+    RefPtr<const AsmMacro> macro = macroEntry->second;
     const size_t macroArgsNum = macro->getArgsNum();
     bool good = true;
     AsmMacroInputFilter::MacroArgMap argMap(macroArgsNum);
@@ -2117,6 +2343,7 @@ Assembler::ParseState Assembler::makeMacroSubstitution(const char* linePtr)
     asmInputFilters.push(macroFilter.release());
     currentInputFilter = asmInputFilters.top();
     macroSubstLevel++;
+    stats.macroExpansionsNum++;
     return ParseState::PARSED;
 }
 
@@ -2127,9 +2354,16 @@ struct ScopeUsingStackElem
 };
 
 // routine to find scope in scope (only traversing by '.using's)
-AsmScope* Assembler::findScopeInScope(AsmScope* scope, const CString& scopeName,
+AsmScope* Assembler::findScopeInScope(AsmScope* scope, AsmNameId scopeNameId,
                   std::unordered_set<AsmScope*>& scopeSet)
 {
+    if (scope->usedScopes.empty())
+    {
+        // fast path: no used scopes
+        AsmScopeMap::value_type* entry = findInNameIndexedMap(scope->scopeMap,
+                    scope->scopeIndex, namePool, scopeNameId);
+        return (entry != nullptr) ? entry->second : nullptr;
+    }
     if (!scopeSet.insert(scope).second)
         return nullptr;
     std::stack<ScopeUsingStackElem> usingStack;
@@ -2141,9 +2375,10 @@ AsmScope* Assembler::findScopeInScope(AsmScope* scope, const CString& scopeName,
         if (current.usingIt == curScope->usedScopes.begin())
         {
             // first we found in this scope
-            auto it = curScope->scopeMap.find(scopeName);
-            if (it != curScope->scopeMap.end())
-                return it->second;
+            AsmScopeMap::value_type* entry = findInNameIndexedMap(curScope->scopeMap,
+                    curScope->scopeIndex, namePool, scopeNameId);
+            if (entry != nullptr)
+                return entry->second;
         }
         // next we find in used children
         if (current.usingIt != curScope->usedScopes.end())
@@ -2159,28 +2394,29 @@ AsmScope* Assembler::findScopeInScope(AsmScope* scope, const CString& scopeName,
     return nullptr;
 }
 
-AsmScope* Assembler::getRecurScope(const CString& scopePlace, bool ignoreLast,
-                    const char** lastStep)
+AsmScope* Assembler::getRecurScope(const char* scopePlace, const char* scopePlaceEnd,
+                    bool ignoreLast, const char** lastStep, bool createScopes)
 {
     AsmScope* scope = currentScope;
-    const char* str = scopePlace.c_str();
-    if (*str==':' && str[1]==':')
+    const char* str = scopePlace;
+    const char* end = scopePlaceEnd;
+    if (end-str >= 2 && *str==':' && str[1]==':')
     {
         // choose global scope
         scope = &globalScope;
         str += 2;
     }
     
-    std::vector<CString> scopeTrack;
+    std::vector<AsmNameId> scopeTrack;
     const char* lastStepCur = str;
-    while (*str != 0)
+    while (str != end)
     {
         const char* scopeNameStr = str;
-        while (*str!=':' && *str!=0) str++;
-        if (*str==0 && ignoreLast) // ignore last
+        while (str!=end && *str!=':') str++;
+        if (str==end && ignoreLast) // ignore last
             break;
-        scopeTrack.push_back(CString(scopeNameStr, str));
-        if (*str==':' && str[1]==':')
+        scopeTrack.push_back(namePool.intern(scopeNameStr, str-scopeNameStr));
+        if (end-str >= 2 && *str==':' && str[1]==':')
             str += 2;
         lastStepCur = str;
     }
@@ -2200,16 +2436,34 @@ AsmScope* Assembler::getRecurScope(const CString& scopePlace, bool ignoreLast,
         }
     }
     
+    if (!createScopes)
+    {
+        // only follow existing scopes
+        for (AsmNameId nameId: scopeTrack)
+        {
+            scopeSet.clear();
+            scope = findScopeInScope(scope, nameId, scopeSet);
+            if (scope == nullptr)
+                return nullptr;
+        }
+        return scope;
+    }
     // otherwise create in current/global scope
-    for (const CString& name: scopeTrack)
-        getScope(scope, name, scope);
+    for (AsmNameId nameId: scopeTrack)
+        getScope(scope, nameId, scope);
     return scope;
 }
 
 // internal routine to find symbol in scope (only traversing by '.using's)
 AsmSymbolEntry* Assembler::findSymbolInScopeInt(AsmScope* scope,
-                    const CString& symName, std::unordered_set<AsmScope*>& scopeSet)
+            AsmNameId symNameId, std::unordered_set<AsmScope*>& scopeSet,
+            AsmScope*& symScope)
 {
+    symScope = scope;
+    if (scope->usedScopes.empty())
+        // fast path: no used scopes
+        return findInNameIndexedMap(scope->symbolMap, scope->symbolIndex,
+                    namePool, symNameId);
     if (!scopeSet.insert(scope).second)
         return nullptr;
     std::stack<ScopeUsingStackElem> usingStack;
@@ -2221,9 +2475,13 @@ AsmSymbolEntry* Assembler::findSymbolInScopeInt(AsmScope* scope,
         if (current.usingIt == curScope->usedScopes.begin())
         {
             // first we found in this scope
-            AsmSymbolMap::iterator it = curScope->symbolMap.find(symName);
-            if (it != curScope->symbolMap.end())
-                return &*it;
+            AsmSymbolEntry* entry = findInNameIndexedMap(curScope->symbolMap,
+                    curScope->symbolIndex, namePool, symNameId);
+            if (entry != nullptr)
+            {
+                symScope = curScope;
+                return entry;
+            }
         }
         // next we find in used children
         if (current.usingIt != curScope->usedScopes.end())
@@ -2240,50 +2498,94 @@ AsmSymbolEntry* Assembler::findSymbolInScopeInt(AsmScope* scope,
 }
 
 // real routine to find symbol in scope (traverse by all visible scopes)
-AsmSymbolEntry* Assembler::findSymbolInScope(const CString& symName, AsmScope*& scope,
-            CString& sameSymName, bool insertMode)
+AsmSymbolEntry* Assembler::findSymbolInScope(const char* symName, const char* symNameEnd,
+            AsmScope*& scope, AsmNameId& symNameId, bool insertMode, AsmScope** symScope)
 {
     const char* lastStep = nullptr;
-    scope = getRecurScope(symName, true, &lastStep);
+    scope = getRecurScope(symName, symNameEnd, true, &lastStep);
+    symNameId = namePool.intern(lastStep, symNameEnd-lastStep);
     std::unordered_set<AsmScope*> scopeSet;
-    AsmSymbolEntry* foundSym = findSymbolInScopeInt(scope, lastStep, scopeSet);
-    sameSymName = lastStep;
-    if (foundSym != nullptr)
-        return foundSym;
-    if (lastStep != symName)
-        return nullptr;
-    // otherwise is symName is not normal symName
-    scope = currentScope;
-    if (insertMode)
-        return nullptr;
-    
-    for (AsmScope* scope2 = scope; scope2 != nullptr; scope2 = scope2->parent)
-    {  // find this scope
-        foundSym = findSymbolInScopeInt(scope2, lastStep, scopeSet);
-        if (foundSym != nullptr)
-            return foundSym;
+    AsmScope* foundScope;
+    AsmSymbolEntry* foundSym = findSymbolInScopeInt(scope, symNameId, scopeSet,
+                foundScope);
+    if (foundSym == nullptr && lastStep == symName)
+    {
+        // otherwise is symName is not normal symName
+        scope = currentScope;
+        if (!insertMode)
+            // current scope already visited
+            for (AsmScope* scope2 = scope->parent; scope2 != nullptr &&
+                        foundSym == nullptr; scope2 = scope2->parent)
+                // find this scope
+                foundSym = findSymbolInScopeInt(scope2, symNameId, scopeSet,
+                            foundScope);
     }
-    return nullptr;
+    if (!includeFrames.empty())
+        recordIncludeSymbol(symName, symNameEnd, lastStep != symName, foundSym);
+    if (symScope != nullptr)
+        *symScope = foundScope;
+    return foundSym;
+}
+
+AsmSymbolEntry* Assembler::findSymbolInScope(const CString& symName, AsmScope*& scope,
+            CString& sameSymName, bool insertMode, AsmScope** symScope)
+{
+    AsmNameId symNameId;
+    AsmSymbolEntry* foundSym = findSymbolInScope(symName.c_str(),
+                symName.c_str()+symName.size(), scope, symNameId, insertMode, symScope);
+    sameSymName = namePool.getName(symNameId);
+    return foundSym;
+}
+
+const AsmSymbolEntry* Assembler::findExistingSymbol(const CString& symName)
+{
+    const char* symNameStr = symName.c_str();
+    const char* symNameEnd = symNameStr + symName.size();
+    const char* lastStep = nullptr;
+    AsmScope* scope = getRecurScope(symNameStr, symNameEnd, true, &lastStep, false);
+    if (scope == nullptr)
+        return nullptr;
+    const AsmNameId symNameId = namePool.find(lastStep, symNameEnd-lastStep);
+    if (symNameId == AsmNamePool::NONE)
+        return nullptr; // name never used, no such symbol
+    std::unordered_set<AsmScope*> scopeSet;
+    AsmScope* foundScope;
+    AsmSymbolEntry* foundSym = findSymbolInScopeInt(scope, symNameId, scopeSet,
+                foundScope);
+    if (foundSym == nullptr && lastStep == symNameStr)
+        // current scope already visited
+        for (AsmScope* scope2 = scope->parent; scope2 != nullptr &&
+                    foundSym == nullptr; scope2 = scope2->parent)
+            foundSym = findSymbolInScopeInt(scope2, symNameId, scopeSet, foundScope);
+    return foundSym;
 }
 
 std::pair<AsmSymbolEntry*, bool> Assembler::insertSymbolInScope(const CString& symName,
-                 const AsmSymbol& symbol)
+                 const AsmSymbol& symbol, AsmScope** symScope)
 {
     AsmScope* outScope;
-    CString sameSymName;
-    AsmSymbolEntry* symEntry = findSymbolInScope(symName, outScope, sameSymName, true);
+    AsmNameId symNameId;
+    AsmSymbolEntry* symEntry = findSymbolInScope(symName.c_str(),
+                symName.c_str()+symName.size(), outScope, symNameId, true, symScope);
     if (symEntry==nullptr)
     {
-        auto res = outScope->symbolMap.insert({ sameSymName, symbol });
-        return std::make_pair(&*res.first, res.second);
+        if (symScope != nullptr)
+            *symScope = outScope;
+        stats.symbolsNum++;
+        return insertInNameIndexedMap(outScope->symbolMap, outScope->symbolIndex,
+                    namePool, symNameId, symbol);
     }
     return std::make_pair(symEntry, false);
 }
 
 // internal routine to find regvar in scope (only traversing by '.using's)
-AsmRegVarEntry* Assembler::findRegVarInScopeInt(AsmScope* scope, const CString& rvName,
+AsmRegVarEntry* Assembler::findRegVarInScopeInt(AsmScope* scope, AsmNameId rvNameId,
                 std::unordered_set<AsmScope*>& scopeSet)
 {
+    if (scope->usedScopes.empty())
+        // fast path: no used scopes
+        return findInNameIndexedMap(scope->regVarMap, scope->regVarIndex,
+                    namePool, rvNameId);
     if (!scopeSet.insert(scope).second)
         return nullptr;
     std::stack<ScopeUsingStackElem> usingStack;
@@ -2295,9 +2597,10 @@ AsmRegVarEntry* Assembler::findRegVarInScopeInt(AsmScope* scope, const CString&
         if (current.usingIt == curScope->usedScopes.begin())
         {
             // first we found in this scope
-            AsmRegVarMap::iterator it = curScope->regVarMap.find(rvName);
-            if (it != curScope->regVarMap.end())
-                return &*it;
+            AsmRegVarEntry* entry = findInNameIndexedMap(curScope->regVarMap,
+                    curScope->regVarIndex, namePool, rvNameId);
+            if (entry != nullptr)
+                return entry;
         }
         // next we find in used children
         if (current.usingIt != curScope->usedScopes.end())
@@ -2314,14 +2617,14 @@ AsmRegVarEntry* Assembler::findRegVarInScopeInt(AsmScope* scope, const CString&
 }
 
 // real routine to find regvar in scope (traverse by all visible scopes)
-AsmRegVarEntry* Assembler::findRegVarInScope(const CString& rvName, AsmScope*& scope,
-                      CString& sameRvName, bool insertMode)
+AsmRegVarEntry* Assembler::findRegVarInScope(const char* rvName, const char* rvNameEnd,
+            AsmScope*& scope, AsmNameId& rvNameId, bool insertMode)
 {
     const char* lastStep = nullptr;
-    scope = getRecurScope(rvName, true, &lastStep);
+    scope = getRecurScope(rvName, rvNameEnd, true, &lastStep);
+    rvNameId = namePool.intern(lastStep, rvNameEnd-lastStep);
     std::unordered_set<AsmScope*> scopeSet;
-    AsmRegVarEntry* foundRv = findRegVarInScopeInt(scope, lastStep, scopeSet);
-    sameRvName = lastStep;
+    AsmRegVarEntry* foundRv = findRegVarInScopeInt(scope, rvNameId, scopeSet);
     if (foundRv != nullptr)
         return foundRv;
     if (lastStep != rvName)
@@ -2331,40 +2634,51 @@ AsmRegVarEntry* Assembler::findRegVarInScope(const CString& rvName, AsmScope*& s
     if (insertMode)
         return nullptr;
     
-    for (AsmScope* scope2 = scope; scope2 != nullptr; scope2 = scope2->parent)
+    // current scope already visited
+    for (AsmScope* scope2 = scope->parent; scope2 != nullptr; scope2 = scope2->parent)
     {  // find this scope
-        foundRv = findRegVarInScopeInt(scope2, lastStep, scopeSet);
+        foundRv = findRegVarInScopeInt(scope2, rvNameId, scopeSet);
         if (foundRv != nullptr)
             return foundRv;
     }
     return nullptr;
 }
 
+AsmRegVarEntry* Assembler::findRegVarInScope(const CString& rvName, AsmScope*& scope,
+                      CString& sameRvName, bool insertMode)
+{
+    AsmNameId rvNameId;
+    AsmRegVarEntry* foundRv = findRegVarInScope(rvName.c_str(),
+                rvName.c_str()+rvName.size(), scope, rvNameId, insertMode);
+    sameRvName = namePool.getName(rvNameId);
+    return foundRv;
+}
+
 std::pair<AsmRegVarEntry*, bool> Assembler::insertRegVarInScope(const CString& rvName,
                  const AsmRegVar& regVar)
 {
     AsmScope* outScope;
-    CString sameRvName;
-    AsmRegVarEntry* rvEntry = findRegVarInScope(rvName, outScope, sameRvName, true);
+    AsmNameId rvNameId;
+    AsmRegVarEntry* rvEntry = findRegVarInScope(rvName.c_str(),
+                rvName.c_str()+rvName.size(), outScope, rvNameId, true);
     if (rvEntry==nullptr)
-    {
-        auto res = outScope->regVarMap.insert({ sameRvName, regVar });
-        return std::make_pair(&*res.first, res.second);
-    }
+        return insertInNameIndexedMap(outScope->regVarMap, outScope->regVarIndex,
+                    namePool, rvNameId, regVar);
     return std::make_pair(rvEntry, false);
 }
 
-bool Assembler::getScope(AsmScope* parent, const CString& scopeName, AsmScope*& scope)
+bool Assembler::getScope(AsmScope* parent, AsmNameId scopeNameId, AsmScope*& scope)
 {
     std::unordered_set<AsmScope*> scopeSet;
-    AsmScope* foundScope = findScopeInScope(parent, scopeName, scopeSet);
+    AsmScope* foundScope = findScopeInScope(parent, scopeNameId, scopeSet);
     if (foundScope != nullptr)
     {
         scope = foundScope;
         return false;
     }
     std::unique_ptr<AsmScope> newScope(new AsmScope(parent));
-    auto res = parent->scopeMap.insert(std::make_pair(scopeName, newScope.get()));
+    auto res = insertInNameIndexedMap(parent->scopeMap, parent->scopeIndex,
+                namePool, scopeNameId, newScope.get());
     scope = newScope.release();
     return res.second;
 }
@@ -2375,7 +2689,8 @@ bool Assembler::pushScope(const CString& scopeName)
     {
         // temporary scope
         std::unique_ptr<AsmScope> newScope(new AsmScope(currentScope, true));
-        currentScope->scopeMap.insert(std::make_pair("", newScope.get()));
+        insertInNameIndexedMap(currentScope->scopeMap, currentScope->scopeIndex,
+                    namePool, namePool.intern(""), newScope.get());
         currentScope = newScope.release();
     }
     else
@@ -2391,7 +2706,8 @@ bool Assembler::popScope()
     if (currentScope->temporary)
     {
         // delete scope
-        currentScope->parent->scopeMap.erase("");
+        eraseFromNameIndexedMap(currentScope->parent->scopeMap,
+                    currentScope->parent->scopeIndex, namePool, namePool.intern(""));
         const bool oldResolvingRelocs = resolvingRelocs;
         resolvingRelocs = true; // allow to resolve relocations
         tryToResolveSymbols(currentScope);
@@ -2405,20 +2721,186 @@ bool Assembler::popScope()
     return true;
 }
 
+const AsmMacroMap::value_type* Assembler::findMacro(const char* macroPlace,
+            const CString& macroName, AsmNameId macroNameId)
+{
+    const AsmMacroMap::value_type* macroEntry = findInNameIndexedMap(macroMap,
+                macroIndex, namePool, macroNameId);
+    if (macroEntry != nullptr || lazyMacros.empty())
+        return macroEntry;
+    auto it = lazyMacros.find(macroName);
+    if (it == lazyMacros.end())
+        return nullptr;
+    // first use of macro from library: load it and put to macro map
+    RefPtr<const AsmMacro> macro;
+    try
+    { macro = macroLibraries[it->second.first]->loadMacro(it->second.second); }
+    catch(const Exception& ex)
+    {
+        printError(macroPlace, (std::string("Can't load macro '") + macroName.c_str() +
+                "' from library: " + ex.what()).c_str());
+    }
+    lazyMacros.erase(it);
+    if (!macro)
+        return nullptr;
+    return insertInNameIndexedMap(macroMap, macroIndex, namePool, macroNameId,
+                macro).first;
+}
+
+bool Assembler::putMacroLibrary(const char* pseudoOpPlace,
+            std::unique_ptr<AsmMacroLibrary>&& library)
+{
+    bool libGood = true;
+    auto printLibError = [this, pseudoOpPlace, &libGood](const std::string& message)
+    {
+        libGood = false;
+        if (pseudoOpPlace != nullptr)
+        {
+            printError(pseudoOpPlace, message.c_str());
+            return;
+        }
+        good = false;
+        messagesNum++;
+        messageStream << "<command-line>: Error: " << message << std::endl;
+    };
+    // symbols are set immediately
+    for (size_t i = 0; i < library->getSymbolsNum(); i++)
+    {
+        const AsmMacroLibrary::Symbol& symbol = library->getSymbol(i);
+        if (symbol.name == ".")
+            continue; // ignore output counter
+        AsmSymbolEntry& symEntry = *insertInNameIndexedMap(globalScope.symbolMap,
+                globalScope.symbolIndex, namePool, namePool.intern(
+                    symbol.name.c_str(), symbol.name.size()), AsmSymbol()).first;
+        if (symEntry.second.onceDefined && symEntry.second.isDefined())
+        {
+            printLibError(std::string("Symbol '") + symbol.name.c_str() +
+                    "' is already defined");
+            continue;
+        }
+        setSymbol(symEntry, symbol.value, ASMSECT_ABS);
+        symEntry.second.onceDefined = symbol.onceDefined;
+    }
+    // macros will be loaded while first use
+    const size_t libIndex = macroLibraries.size();
+    for (size_t i = 0; i < library->getMacrosNum(); i++)
+    {
+        const CString& macroName = library->getMacroName(i);
+        if (macroMap.find(macroName) != macroMap.end() ||
+            !lazyMacros.insert(std::make_pair(macroName,
+                        std::make_pair(libIndex, i))).second)
+            printLibError(std::string("Macro '") + macroName.c_str() +
+                    "' is already defined");
+    }
+    macroLibraries.push_back(std::move(library));
+    return libGood;
+}
+
+bool Assembler::includeMacroLibrary(const char* pseudoOpPlace,
+            const std::string& filename)
+{
+    addCacheDependency(filename, true);
+    std::unique_ptr<AsmMacroLibrary> library;
+    try
+    { library.reset(new AsmMacroLibrary(getSourcePos(pseudoOpPlace), filename)); }
+    catch(const Exception& ex)
+    {
+        printError(pseudoOpPlace, (std::string("Can't load macro library '") +
+                filename + "': " + ex.what()).c_str());
+        return false;
+    }
+    return putMacroLibrary(pseudoOpPlace, std::move(library));
+}
+
+size_t Assembler::getLoadedLibraryMacrosNum() const
+{
+    size_t loadedMacrosNum = 0;
+    for (const std::unique_ptr<AsmMacroLibrary>& library: macroLibraries)
+        loadedMacrosNum += library->getLoadedMacrosNum();
+    return loadedMacrosNum;
+}
+
+void Assembler::writeMacroLibrary(const CString& filename)
+{
+    if (cacheHit)
+        throw Exception("Macro library can't be written from cached binary");
+    std::vector<AsmMacroLibrary::Macro> macros(macroMap.begin(), macroMap.end());
+    for (const auto& entry: lazyMacros)
+        macros.push_back(std::make_pair(entry.first,
+                macroLibraries[entry.second.first]->loadMacro(entry.second.second)));
+    std::sort(macros.begin(), macros.end(),
+            [](const AsmMacroLibrary::Macro& a, const AsmMacroLibrary::Macro& b)
+            { return a.first < b.first; });
+    
+    std::vector<AsmMacroLibrary::Symbol> symbols;
+    for (const AsmSymbolEntry& symEntry: globalScope.symbolMap)
+    {
+        const AsmSymbol& symbol = symEntry.second;
+        // skip output counter, local labels and non-absolute symbols
+        if (symEntry.first == "." || (symEntry.first[0] >= '0' &&
+                symEntry.first[0] <= '9') || !symbol.hasValue ||
+            symbol.sectionId != ASMSECT_ABS || symbol.regRange || symbol.base)
+            continue;
+        symbols.push_back({ symEntry.first, symbol.value, symbol.onceDefined!=0 });
+    }
+    std::sort(symbols.begin(), symbols.end(),
+            [](const AsmMacroLibrary::Symbol& a, const AsmMacroLibrary::Symbol& b)
+            { return a.name < b.name; });
+    AsmMacroLibrary::write(filename, macros, symbols);
+}
+
+bool Assembler::probeIncludeDir(const std::string& incDirPath,
+            const std::string& filename)
+{
+    if (includeDirCache != nullptr)
+    {
+        // every directory is checked against changes once per assembling
+        const bool revalidate = validatedIncludeDirs.insert(incDirPath).second;
+        bool listed;
+        const bool mayContain = includeDirCache->mayContain(incDirPath, filename,
+                    revalidate, listed);
+        if (listed)
+            includeSearchStats.listingsNum++;
+        if (!mayContain)
+        {
+            includeSearchStats.skippedProbesNum++;
+            return false;
+        }
+    }
+    includeSearchStats.probesNum++;
+    return true;
+}
+
 bool Assembler::includeFile(const char* pseudoOpPlace, const std::string& filename)
 {
     if (inclusionLevel == 500)
         THIS_FAIL_BY_ERROR(pseudoOpPlace, "Inclusion level is greater than 500")
-    std::unique_ptr<AsmInputFilter> newInputFilter(new AsmStreamInputFilter(
+    if (includeCache != nullptr && replayIncludeSnapshot(pseudoOpPlace, filename))
+        return true;
+    std::unique_ptr<AsmInputFilter> newInputFilter;
+    try
+    {
+        newInputFilter.reset(new AsmStreamInputFilter(
                 getSourcePos(pseudoOpPlace), filename));
+    }
+    catch(const Exception& ex)
+    {
+        // failed probe: binary is valid only if this file still doesn't exist
+        addCacheDependency(filename, false);
+        throw;
+    }
+    addCacheDependency(filename, true);
     asmInputFilters.push(newInputFilter.release());
     currentInputFilter = asmInputFilters.top();
     inclusionLevel++;
+    if (includeCache != nullptr)
+        beginIncludeFrame(filename);
     return true;
 }
 
 bool Assembler::readLine()
 {
+    AsmStatsTimer timer(statsEnabled, stats.lineReadingTime);
     line = currentInputFilter->readLine(*this, lineSize);
     while (line == nullptr)
     {
@@ -2429,7 +2911,13 @@ bool Assembler::readLine()
             if (currentInputFilter->getType() == AsmInputFilterType::MACROSUBST)
                 macroSubstLevel--;
             else if (currentInputFilter->getType() == AsmInputFilterType::STREAM)
+            {
                 inclusionLevel--;
+                if (!includeFrames.empty() &&
+                    includeFrames.back().filter == currentInputFilter)
+                    // end of recorded included file
+                    finishIncludeFrame();
+            }
             else if (currentInputFilter->getType() == AsmInputFilterType::REPEAT)
                 repetitionLevel--;
             delete asmInputFilters.top();
@@ -2445,11 +2933,13 @@ bool Assembler::readLine()
                 /// create new input filter
                 std::unique_ptr<AsmStreamInputFilter> thatFilter(
                     new AsmStreamInputFilter(filenames[filenameIndex++]));
+                addCacheDependency(filenames[filenameIndex-1].c_str(), true);
                 asmInputFilters.push(thatFilter.get());
                 currentInputFilter = thatFilter.release();
                 line = currentInputFilter->readLine(*this, lineSize);
             } while (line==nullptr && filenameIndex<filenames.size());
             
+            stats.linesNum += (line!=nullptr);
             return (line!=nullptr);
         }
         else
@@ -2457,9 +2947,18 @@ bool Assembler::readLine()
         currentInputFilter = asmInputFilters.top();
         line = currentInputFilter->readLine(*this, lineSize);
     }
+    stats.linesNum++;
     return true;
 }
 
+/* reserve content of first code section by hint, hence content of main code section
+ * is not reallocated many times while growing */
+void Assembler::applyContentSizeHint(AsmSection& section)
+{
+    section.content.reserve(section.content.size() + contentSizeHint);
+    contentSizeHint = 0;
+}
+
 // reserve data in current section and fill values (used by '.skip' or position movement)
 cxbyte* Assembler::reserveData(size_t size, cxbyte fillValue)
 {
@@ -2734,6 +3233,26 @@ void Assembler::tryToResolveSymbol(AsmSymbolEntry& symEntry)
     }
 }
 
+void Assembler::compactPendingSymbols(AsmScope* scope)
+{
+    std::vector<AsmSymbolEntry*>& pendingSymbols = scope->pendingSymbols;
+    auto newEnd = std::remove_if(pendingSymbols.begin(), pendingSymbols.end(),
+        [this](AsmSymbolEntry* symEntry)
+        {
+            const AsmSymbol& symbol = symEntry->second;
+            // symbol with value, not held by expressions, nothing to resolve
+            if (!symbol.hasValue || !symbol.occurrencesInExprs.empty() ||
+                (symEntry->first!="." && !isResolvableSection(symbol.sectionId)))
+                return false;
+            symEntry->second.pending = false;
+            return true;
+        });
+    pendingSymbols.erase(newEnd, pendingSymbols.end());
+    // next compaction after adding at least as many symbols as remain in list
+    if (pendingSymbols.size() >= (pendingSymbols.capacity()>>1))
+        pendingSymbols.reserve(std::max(pendingSymbols.size()<<1, size_t(16)));
+}
+
 // try to resolve symbols in scope (after closing temporary scope or
 // ending assembly for global scope)
 void Assembler::tryToResolveSymbols(AsmScope* thisScope)
@@ -2747,10 +3266,11 @@ void Assembler::tryToResolveSymbols(AsmScope* thisScope)
         ScopeStackElem& elem = scopeStack.back();
         if (elem.childIt == elem.scope.second->scopeMap.begin())
         {
-            // first we check symbol of current scope
+            // first we check pending symbols of current scope
             AsmScope* curScope = elem.scope.second;
-            for (AsmSymbolEntry& symEntry: curScope->symbolMap)
-                tryToResolveSymbol(symEntry);
+            compactPendingSymbols(curScope);
+            for (size_t i = 0; i < curScope->pendingSymbols.size(); i++)
+                tryToResolveSymbol(*curScope->pendingSymbols[i]);
         }
         // next, we travere on children
         if (elem.childIt != elem.scope.second->scopeMap.end())
@@ -2780,26 +3300,31 @@ void Assembler::printUnresolvedSymbols(AsmScope* thisScope)
         ScopeStackElem& elem = scopeStack.back();
         if (elem.childIt == elem.scope.second->scopeMap.begin())
         {
-            // first we check symbol of current scope
+            // first we check pending symbols of current scope
             AsmScope* curScope = elem.scope.second;
-            for (AsmSymbolEntry& symEntry: curScope->symbolMap)
-                if (!symEntry.second.occurrencesInExprs.empty())
-                    for (AsmExprSymbolOccurrence occur:
-                            symEntry.second.occurrencesInExprs)
+            std::string scopePath;
+            bool scopePathGenerated = false;
+            for (const AsmSymbolEntry* symEntry: curScope->pendingSymbols)
+            {
+                if (symEntry->second.occurrencesInExprs.empty())
+                    continue; // resolved
+                if (!scopePathGenerated)
+                {
+                    auto it = scopeStack.begin(); // skip global scope
+                    for (++it; it != scopeStack.end(); ++it)
                     {
-                        std::string scopePath;
-                        auto it = scopeStack.begin(); // skip global scope
-                        for (++it; it != scopeStack.end(); ++it)
-                        {
-                            // generate scope path
-                            scopePath += it->scope.first.c_str();
-                            scopePath += "::";
-                        }
-                        // print error, if symbol is unresolved
-                        printError(occur.expression->getSourcePos(),(std::string(
-                            "Unresolved symbol '")+scopePath+
-                            symEntry.first.c_str()+"'").c_str());
+                        // generate scope path
+                        scopePath += it->scope.first.c_str();
+                        scopePath += "::";
                     }
+                    scopePathGenerated = true;
+                }
+                const std::string errorMsg = std::string("Unresolved symbol '")+
+                        scopePath+symEntry->first.c_str()+"'";
+                for (AsmExprSymbolOccurrence occur: symEntry->second.occurrencesInExprs)
+                    // print error, if symbol is unresolved
+                    printError(occur.expression->getSourcePos(), errorMsg.c_str());
+            }
         }
         // next, we travere on children
         if (elem.childIt != elem.scope.second->scopeMap.end())
@@ -2813,6 +3338,395 @@ void Assembler::printUnresolvedSymbols(AsmScope* thisScope)
     }
 }
 
+/* compute key of cache entry from input and options. content of included files
+ * is not known before assembling, hence these files are verified by entry's dependencies */
+AsmCacheHash Assembler::computeCacheKey()
+{
+    AsmCacheHasher hasher;
+    hasher.update(CString(CLRX_VERSION));
+    hasher.updateValue(cxuint(format));
+    hasher.updateValue(cxuint(deviceType));
+    hasher.updateValue(driverVersion);
+    hasher.updateValue(llvmVersion);
+    hasher.updateValue(flags);
+    hasher.updateValue(_64bit);
+    hasher.updateValue(newROCmBinFormat);
+    // format handlers use detected versions if versions are not given
+    if (driverVersion == 0)
+    {
+        if (format == BinaryFormat::AMD || format == BinaryFormat::AMDCL2)
+            hasher.updateValue(detectAmdDriverVersion());
+        else if (format == BinaryFormat::GALLIUM)
+            hasher.updateValue(detectMesaDriverVersion());
+    }
+    if (llvmVersion == 0 && format == BinaryFormat::GALLIUM)
+        hasher.updateValue(detectLLVMCompilerVersion());
+    
+    hasher.updateValue(defSyms.size());
+    for (const DefSym& defSym: defSyms)
+    {
+        hasher.update(defSym.first);
+        hasher.updateValue(defSym.second);
+    }
+    hasher.updateValue(includeDirs.size());
+    for (const CString& incDir: includeDirs)
+        hasher.update(incDir);
+    hasher.updateValue(filenames.size());
+    for (const CString& filename: filenames)
+        hasher.update(filename);
+    hasher.updateValue(macroLibraryFiles.size());
+    for (const CString& libFile: macroLibraryFiles)
+        hasher.update(libFile);
+    
+    if (inputStream != nullptr)
+    {
+        // read whole input stream and assemble from read content
+        char buf[4096];
+        do {
+            inputStream->read(buf, sizeof(buf));
+            inputContent.append(buf, inputStream->gcount());
+        } while (*inputStream);
+        hasher.update(inputStreamName);
+        hasher.updateValue(inputContent.size());
+        hasher.update(inputContent.size(), inputContent.data());
+        
+        inputContentStream.reset(new ArrayIStream(inputContent.size(),
+                    inputContent.data()));
+        delete asmInputFilters.top();
+        asmInputFilters.pop();
+        std::unique_ptr<AsmInputFilter> thatInputFilter(
+                    new AsmStreamInputFilter(*inputContentStream, inputStreamName));
+        asmInputFilters.push(thatInputFilter.get());
+        currentInputFilter = thatInputFilter.release();
+    }
+    return hasher.finish();
+}
+
+// record file read (or only probed) by assembler
+void Assembler::addCacheDependency(const std::string& path, bool exists)
+{
+    if (!cacheRecording && includeFrames.empty())
+        return;
+    AsmCacheDependency dep{ path, exists, { 0, 0 } };
+    if (exists)
+    {
+        bool hashed = false;
+        if (includeCache != nullptr)
+            hashed = includeCache->getFileHash(path, dep.hash);
+        else
+            try
+            {
+                MemoryMappedFile mappedFile(path.c_str());
+                dep.hash = AsmCacheHasher::hash(mappedFile.getSize(),
+                            mappedFile.getData());
+                hashed = true;
+            }
+            catch(const Exception& ex)
+            { }
+        if (!hashed)
+        {
+            // content of pipes and devices can't be verified later
+            cacheable = false;
+            markIncludeSideEffect();
+            return;
+        }
+    }
+    addCacheDependency(dep);
+}
+
+void Assembler::addCacheDependency(const AsmCacheDependency& dep)
+{
+    if (cacheRecording)
+        cacheEntry.dependencies.push_back(dep);
+    if (!includeFrames.empty())
+        includeDeps.push_back(dep);
+}
+
+/*
+ * snapshots of included files
+ */
+
+static AsmIncludeSymbolState getIncludeSymbolState(const AsmSymbolEntry* symEntry)
+{
+    if (symEntry == nullptr)
+        return { false, false, false, false, false, 0, 0, ASMSECT_ABS, 0, 0 };
+    const AsmSymbol& sym = symEntry->second;
+    return { true, sym.hasValue!=0, sym.expression!=nullptr || sym.base || sym.regRange ||
+            sym.snapshot, !sym.occurrencesInExprs.empty(), sym.onceDefined!=0,
+            sym.info, sym.other, sym.sectionId, sym.value, sym.size };
+}
+
+// get origin of macro (macro replayed from snapshot is copy of original macro)
+static RefPtr<const AsmMacro> getMacroOrigin(const RefPtr<const AsmMacro>& macro)
+{
+    const AsmMacro* origin = macro->getOrigin();
+    if (origin == macro.get())
+        return macro;
+    origin->reference();
+    return RefPtr<const AsmMacro>(origin);
+}
+
+void Assembler::recordIncludeSymbol(const char* symName, const char* symNameEnd,
+            bool scoped, const AsmSymbolEntry* symEntry)
+{
+    if (scoped)
+    {
+        // scoped names can create scopes
+        markIncludeSideEffect();
+        return;
+    }
+    includeSymbolReads.push_back(std::make_pair(CString(symName, symNameEnd),
+                getIncludeSymbolState(symEntry)));
+}
+
+void Assembler::recordIncludeMacro(const CString& macroName,
+            const AsmMacroMap::value_type* macroEntry)
+{
+    includeMacroReads.push_back(std::make_pair(macroName, macroEntry != nullptr ?
+                getMacroOrigin(macroEntry->second) : RefPtr<const AsmMacro>()));
+}
+
+AsmIncludeSettings Assembler::getIncludeSettings() const
+{
+    return { format, deviceType, _64bit, flags, alternateMacro, buggyFPLit,
+            macroCase, oldModParam };
+}
+
+// returns true if snapshot has been replayed instead of assembling included file
+bool Assembler::replayIncludeSnapshot(const char* pseudoOpPlace,
+            const std::string& filename)
+{
+    // snapshots hold only changes in global scope
+    if (currentScope != &globalScope || !globalScope.usedScopes.empty())
+        return false;
+    AsmCacheHash hash;
+    if (!includeCache->getFileHash(filename, hash))
+        return false;
+    const std::vector<AsmIncludeSnapshot>* snapshots =
+                includeCache->getSnapshots(filename);
+    if (snapshots == nullptr)
+        return false;
+    
+    const AsmIncludeSettings settings = getIncludeSettings();
+    const AsmIncludeSnapshot* snapshot = nullptr;
+    // try newest snapshots first
+    for (auto it = snapshots->rbegin(); it != snapshots->rend() && snapshot == nullptr;
+                ++it)
+    {
+        const AsmIncludeSnapshot& cand = *it;
+        if (cand.hash != hash || !(cand.settings == settings) ||
+            cand.includeDirs != includeDirs ||
+            (cand.withCounters && (cand.macroCount != macroCount ||
+                    cand.localCount != localCount)))
+            continue;
+        bool same = true;
+        for (const AsmIncludeSnapshot::Symbol& symbol: cand.symbolReads)
+        {
+            auto symIt = globalScope.symbolMap.find(symbol.first);
+            if (getIncludeSymbolState(symIt != globalScope.symbolMap.end() ?
+                        &*symIt : nullptr) != symbol.second)
+            {
+                same = false;
+                break;
+            }
+        }
+        for (auto mit = cand.macroReads.begin(); same && mit != cand.macroReads.end();
+                    ++mit)
+        {
+            auto macroIt = macroMap.find(mit->first);
+            same = (macroIt != macroMap.end()) ?
+                    (macroIt->second->getOrigin() == mit->second.get()) : !mit->second;
+        }
+        for (auto dit = cand.dependencies.begin(); same && dit != cand.dependencies.end();
+                    ++dit)
+            same = includeCache->isUpToDate(*dit);
+        if (same)
+            snapshot = &cand;
+    }
+    if (snapshot == nullptr)
+        return false;
+    
+    // file is read by assembler (from view of cache of binaries and outer snapshots)
+    addCacheDependency(AsmCacheDependency{ filename.c_str(), true, hash });
+    for (const AsmCacheDependency& dep: snapshot->dependencies)
+        addCacheDependency(dep);
+    if (!includeFrames.empty())
+    {
+        includeSymbolReads.insert(includeSymbolReads.end(),
+                    snapshot->symbolReads.begin(), snapshot->symbolReads.end());
+        includeMacroReads.insert(includeMacroReads.end(),
+                    snapshot->macroReads.begin(), snapshot->macroReads.end());
+    }
+    
+    // apply changes
+    for (const AsmIncludeSnapshot::Symbol& symbol: snapshot->symbols)
+    {
+        AsmSymbolEntry& symEntry = *insertInNameIndexedMap(globalScope.symbolMap,
+                globalScope.symbolIndex, namePool, namePool.intern(
+                    symbol.first.c_str(), symbol.first.size()), AsmSymbol()).first;
+        setSymbol(symEntry, symbol.second.value, symbol.second.sectionId);
+        symEntry.second.onceDefined = symbol.second.onceDefined;
+        if (!symEntry.second.hasValue)
+            addPendingSymbol(&globalScope, symEntry);
+    }
+    if (!snapshot->macros.empty())
+    {
+        // macros must point to this inclusion of file
+        const AsmSourcePos pos = getSourcePos(pseudoOpPlace);
+        RefPtr<const AsmSource> source(new AsmFile(!pos.macro ? pos.source :
+                RefPtr<const AsmSource>(new AsmMacroSource(pos.macro, pos.source)),
+                pos.lineNo, pos.colNo, filename));
+        AsmSourceRebaser rebaser(snapshot->source, source);
+        for (const AsmIncludeSnapshot::Macro& macro: snapshot->macros)
+        {
+            RefPtr<const AsmMacro> newMacro(new AsmMacro(macro.second, rebaser));
+            AsmMacroMap::value_type* macroEntry = insertInNameIndexedMap(macroMap,
+                    macroIndex, namePool, namePool.intern(macro.first.c_str(),
+                        macro.first.size()), newMacro).first;
+            macroEntry->second = newMacro;
+        }
+    }
+    alternateMacro = snapshot->newSettings.alternateMacro;
+    buggyFPLit = snapshot->newSettings.buggyFPLit;
+    macroCase = snapshot->newSettings.macroCase;
+    oldModParam = snapshot->newSettings.oldModParam;
+    macroCount = snapshot->newMacroCount;
+    localCount = snapshot->newLocalCount;
+    includeCache->addHit();
+    return true;
+}
+
+// start recording of included file (its input filter is current)
+void Assembler::beginIncludeFrame(const std::string& filename)
+{
+    if (currentScope != &globalScope || !globalScope.usedScopes.empty())
+        return;
+    IncludeFrame frame;
+    if (!includeCache->getFileHash(filename, frame.hash))
+        return;
+    frame.filter = currentInputFilter;
+    frame.path = filename;
+    frame.source = currentInputFilter->getSource();
+    frame.settings = getIncludeSettings();
+    frame.sideEffects = includeSideEffects;
+    frame.symbolReadsStart = includeSymbolReads.size();
+    frame.macroReadsStart = includeMacroReads.size();
+    frame.depsStart = includeDeps.size();
+    frame.messagesNum = messagesNum;
+    frame.clausesNum = clauses.size();
+    frame.symbolsNum = globalScope.symbolMap.size();
+    frame.sectionsNum = sections.size();
+    frame.kernelsNum = kernels.size();
+    frame.scopesNum = globalScope.scopeMap.size();
+    frame.regVarsNum = globalScope.regVarMap.size();
+    frame.unevalExprsNum = unevalExpressions.size();
+    frame.formatHandler = formatHandler;
+    frame.currentSection = currentSection;
+    frame.currentOutPos = currentOutPos;
+    frame.macroCount = macroCount;
+    frame.localCount = localCount;
+    includeFrames.push_back(std::move(frame));
+}
+
+// finish recording of included file and store snapshot if file can be replayed
+void Assembler::finishIncludeFrame()
+{
+    IncludeFrame frame = std::move(includeFrames.back());
+    includeFrames.pop_back();
+    
+    const AsmIncludeSettings settings = getIncludeSettings();
+    bool replayable = frame.sideEffects == includeSideEffects &&
+            frame.messagesNum == messagesNum && frame.clausesNum == clauses.size() &&
+            frame.sectionsNum == sections.size() && frame.kernelsNum == kernels.size() &&
+            frame.scopesNum == globalScope.scopeMap.size() &&
+            frame.regVarsNum == globalScope.regVarMap.size() &&
+            frame.unevalExprsNum == unevalExpressions.size() &&
+            frame.formatHandler == formatHandler &&
+            frame.currentSection == currentSection &&
+            frame.currentOutPos == currentOutPos &&
+            currentScope == &globalScope && globalScope.usedScopes.empty() &&
+            frame.settings.format == settings.format &&
+            frame.settings.deviceType == settings.deviceType &&
+            frame.settings._64bit == settings._64bit;
+    
+    AsmIncludeSnapshot snapshot;
+    if (replayable)
+    {
+        // incoming state is state at first usage of symbol or macro
+        std::unordered_set<CString> usedNames;
+        size_t newSymbolsNum = 0;
+        for (auto it = includeSymbolReads.begin() + frame.symbolReadsStart;
+             replayable && it != includeSymbolReads.end(); ++it)
+        {
+            if (!usedNames.insert(it->first).second)
+                continue;
+            if (it->second.complex)
+            {
+                // value of symbol is not known
+                replayable = false;
+                break;
+            }
+            snapshot.symbolReads.push_back(*it);
+            auto symIt = globalScope.symbolMap.find(it->first);
+            const AsmIncludeSymbolState state = getIncludeSymbolState(
+                    symIt != globalScope.symbolMap.end() ? &*symIt : nullptr);
+            if (state == it->second)
+                continue;
+            // only absolute values of symbols can be replayed
+            replayable = state.exists && state.hasValue && !state.complex &&
+                    !state.pending && state.sectionId == ASMSECT_ABS &&
+                    !it->second.pending && it->second.info == state.info &&
+                    it->second.other == state.other && it->second.size == state.size;
+            snapshot.symbols.push_back(std::make_pair(it->first, state));
+            if (!it->second.exists)
+                newSymbolsNum++;
+        }
+        // other created symbols are not recorded
+        replayable = replayable &&
+                globalScope.symbolMap.size() == frame.symbolsNum + newSymbolsNum;
+        
+        usedNames.clear();
+        for (auto it = includeMacroReads.begin() + frame.macroReadsStart;
+             replayable && it != includeMacroReads.end(); ++it)
+        {
+            if (!usedNames.insert(it->first).second)
+                continue;
+            snapshot.macroReads.push_back(*it);
+            auto macroIt = macroMap.find(it->first);
+            if (macroIt == macroMap.end())
+                // macro can not be removed
+                replayable = !it->second;
+            else if (macroIt->second->getOrigin() != it->second.get())
+                snapshot.macros.push_back(*macroIt);
+        }
+    }
+    
+    if (replayable)
+    {
+        snapshot.hash = frame.hash;
+        snapshot.settings = frame.settings;
+        snapshot.includeDirs = includeDirs;
+        snapshot.withCounters = frame.macroCount != macroCount ||
+                frame.localCount != localCount;
+        snapshot.macroCount = frame.macroCount;
+        snapshot.localCount = frame.localCount;
+        snapshot.dependencies.assign(includeDeps.begin() + frame.depsStart,
+                    includeDeps.end());
+        snapshot.source = frame.source;
+        snapshot.newSettings = settings;
+        snapshot.newMacroCount = macroCount;
+        snapshot.newLocalCount = localCount;
+        includeCache->addSnapshot(frame.path, std::move(snapshot));
+    }
+    if (includeFrames.empty())
+    {
+        // no recorded files
+        includeSymbolReads.clear();
+        includeMacroReads.clear();
+        includeDeps.clear();
+    }
+}
+
 bool Assembler::assemble()
 {
     resolvingRelocs = false;
@@ -2821,12 +3735,51 @@ bool Assembler::assemble()
     
     for (const DefSym& defSym: defSyms)
         if (defSym.first!=".")
-            globalScope.symbolMap[defSym.first] = AsmSymbol(ASMSECT_ABS, defSym.second);
+            insertInNameIndexedMap(globalScope.symbolMap, globalScope.symbolIndex,
+                    namePool, namePool.intern(defSym.first.c_str(), defSym.first.size()),
+                    AsmSymbol()).first->second = AsmSymbol(ASMSECT_ABS, defSym.second);
         else if ((flags & ASM_WARNINGS) != 0)// ignore for '.'
             messageStream << "<command-line>: Warning: Definition for symbol '.' "
                     "was ignored" << std::endl;
     
+    AsmCacheHash cacheKey{ 0, 0 };
+    if (cache != nullptr)
+    {
+        cacheKey = computeCacheKey();
+        if (cache->load(cacheKey, cacheEntry))
+        {
+            // binary found in cache: print stored messages and skip assembling
+            messageStream.write(cacheEntry.messages.c_str(), cacheEntry.messages.size());
+            printStream.write(cacheEntry.printed.c_str(), cacheEntry.printed.size());
+            cacheHit = useCachedBinary = true;
+            good = true;
+            return good;
+        }
+        cacheEntry = AsmCacheEntry();
+        cacheRecording = cacheable = true;
+        if (!filenames.empty()) // first file is already opened
+            addCacheDependency(filenames[0].c_str(), true);
+    }
+    
     good = true;
+    for (const CString& libFile: macroLibraryFiles)
+    {
+        addCacheDependency(libFile.c_str(), true);
+        std::unique_ptr<AsmMacroLibrary> library;
+        try
+        { library.reset(new AsmMacroLibrary(libFile)); }
+        catch(const Exception& ex)
+        {
+            good = false;
+            messagesNum++;
+            messageStream << "<command-line>: Error: Can't load macro library '" <<
+                    libFile << "': " << ex.what() << std::endl;
+            continue;
+        }
+        putMacroLibrary(nullptr, std::move(library));
+    }
+    
+    std::vector<char> localLabelName;
     while (!endOfAssembly)
     {
         if (!lineAlreadyRead)
@@ -2863,6 +3816,7 @@ bool Assembler::assemble()
             linePtr++;
             skipSpacesToEnd(linePtr, end);
             initializeOutputFormat();
+            markIncludeSideEffect();
             if (firstName.front() >= '0' && firstName.front() <= '9')
             {
                 // handle local labels
@@ -2881,12 +3835,21 @@ bool Assembler::assemble()
                 }
                 /* prevLRes - iterator to previous instance of local label (with 'b)
                  * nextLRes - iterator to next instance of local label (with 'f) */
-                AsmSymbolEntry& prevLRes =
-                        *globalScope.symbolMap.insert(std::make_pair(
-                            std::string(firstName.c_str())+"b", AsmSymbol())).first;
-                AsmSymbolEntry& nextLRes =
-                        *globalScope.symbolMap.insert(std::make_pair(
-                            std::string(firstName.c_str())+"f", AsmSymbol())).first;
+                // names of local label instances (buffer reused between labels)
+                localLabelName.assign(firstName.c_str(), firstName.c_str()+firstName.size());
+                localLabelName.push_back('b');
+                std::pair<AsmSymbolEntry*, bool> prevRes = insertInNameIndexedMap(
+                        globalScope.symbolMap, globalScope.symbolIndex, namePool,
+                        namePool.intern(localLabelName.data(), localLabelName.size()),
+                        AsmSymbol());
+                localLabelName.back() = 'f';
+                std::pair<AsmSymbolEntry*, bool> nextRes = insertInNameIndexedMap(
+                        globalScope.symbolMap, globalScope.symbolIndex, namePool,
+                        namePool.intern(localLabelName.data(), localLabelName.size()),
+                        AsmSymbol());
+                stats.symbolsNum += size_t(prevRes.second) + nextRes.second;
+                AsmSymbolEntry& prevLRes = *prevRes.first;
+                AsmSymbolEntry& nextLRes = *nextRes.first;
                 /* resolve forward symbol of label now */
                 assert(setSymbol(nextLRes, currentOutPos, currentSection));
                 // move symbol value from next local label into previous local label
@@ -2894,6 +3857,8 @@ bool Assembler::assemble()
                 prevLRes.second.value = nextLRes.second.value;
                 prevLRes.second.hasValue = isResolvableSection();
                 prevLRes.second.sectionId = currentSection;
+                if (!prevLRes.second.hasValue) // label in unresolvable section
+                    addPendingSymbol(&globalScope, prevLRes);
                 /// make forward symbol of label as undefined
                 nextLRes.second.hasValue = false;
             }
@@ -2908,8 +3873,9 @@ bool Assembler::assemble()
                 /*std::pair<AsmSymbolMap::iterator, bool> res = 
                         currentScope->symbolMap.insert(
                             std::make_pair(firstName, AsmSymbol()));*/
+                AsmScope* symScope;
                 std::pair<AsmSymbolEntry*, bool> res =
-                            insertSymbolInScope(firstName, AsmSymbol());
+                            insertSymbolInScope(firstName, AsmSymbol(), &symScope);
                 if (!res.second)
                 {
                     // found
@@ -2940,6 +3906,8 @@ bool Assembler::assemble()
                 setSymbol(*res.first, currentOutPos, currentSection);
                 res.first->second.onceDefined = true;
                 res.first->second.sectionId = currentSection;
+                if (!res.first->second.hasValue) // label in unresolvable section
+                    addPendingSymbol(symScope, *res.first);
                 
                 formatHandler->handleLabel(res.first->first);
             }
@@ -2986,6 +3954,7 @@ bool Assembler::assemble()
                     continue;
                 }
                 initializeOutputFormat();
+                markIncludeSideEffect();
                 // try parse instruction
                 if (!isWriteableSection())
                 {
@@ -2994,18 +3963,30 @@ bool Assembler::assemble()
                     continue;
                 }
                 
+                if (contentSizeHint != 0 &&
+                    sections[currentSection].type == AsmSectionType::CODE)
+                    applyContentSizeHint(sections[currentSection]);
                 if (sections[currentSection].usageHandler == nullptr)
                     sections[currentSection].usageHandler.reset(
                             isaAssembler->createUsageHandler(
                                     sections[currentSection].content));
                 
-                isaAssembler->assemble(firstName, stmtPlace, linePtr, end,
-                           sections[currentSection].content,
-                           sections[currentSection].usageHandler.get());
+                {
+                    AsmStatsTimer timer(statsEnabled, stats.instrEncodingTime);
+                    isaAssembler->assemble(firstName, stmtPlace, linePtr, end,
+                               sections[currentSection].content,
+                               sections[currentSection].usageHandler.get());
+                }
                 currentOutPos = sections[currentSection].getSize();
             }
         }
     }
+    // included files that are not finished can not be recorded
+    includeFrames.clear();
+    includeSymbolReads.clear();
+    includeMacroReads.clear();
+    includeDeps.clear();
+    
     /* check clauses and print errors */
     while (!clauses.empty())
     {
@@ -3085,21 +4066,75 @@ bool Assembler::assemble()
             kernels[i].closeCodeRegion(sections[sectionId].content.size());
         }
         // prepare binary
+        AsmStatsTimer timer(statsEnabled, stats.binaryGenTime);
         formatHandler->prepareBinary();
     }
+    
+    if (cacheRecording)
+    {
+        cacheRecording = false;
+        if (good && cacheable && formatHandler!=nullptr)
+        {
+            try
+            {
+                // generated binary will be used by writeBinary
+                {
+                    AsmStatsTimer timer(statsEnabled, stats.binaryGenTime);
+                    formatHandler->writeBinary(cacheEntry.binary);
+                }
+                useCachedBinary = true;
+                cache->store(cacheKey, cacheEntry);
+            }
+            catch(const Exception& ex)
+            { } // if binary generation failed, then writeBinary reports error
+        }
+    }
     return good;
 }
 
+void Assembler::allocateRegisters()
+{
+    AsmStatsTimer timer(statsEnabled, stats.regAllocTime);
+    // allocator holds whole state of allocation, hence sections are independent
+    std::vector<cxuint> codeSections;
+    regAllocators.clear();
+    regAllocators.resize(sections.size());
+    for (cxuint i = 0; i < sections.size(); i++)
+        if (sections[i].usageHandler != nullptr)
+        {
+            regAllocators[i].reset(new AsmRegAllocator(*this));
+            regAllocators[i]->setMode(regAllocMode);
+            codeSections.push_back(i);
+        }
+    parallelFor(codeSections.size(), regAllocThreadsNum, [this, &codeSections](size_t i)
+    {
+        const cxuint sectionId = codeSections[i];
+        regAllocators[sectionId]->allocateRegisters(sectionId);
+    });
+}
+
+void Assembler::writeCachedBinary(std::ostream& outStream) const
+{
+    outStream.write(reinterpret_cast<const char*>(cacheEntry.binary.data()),
+                cacheEntry.binary.size());
+    outStream.flush();
+}
+
 void Assembler::writeBinary(const char* filename) const
 {
     if (good)
     {
         const AsmFormatHandler* formatHandler = getFormatHandler();
-        if (formatHandler!=nullptr)
+        if (useCachedBinary || formatHandler!=nullptr)
         {
             std::ofstream ofs(filename, std::ios::binary);
-            if (ofs)
+            if (ofs && useCachedBinary)
+                writeCachedBinary(ofs);
+            else if (ofs)
+            {
+                AsmStatsTimer timer(statsEnabled, stats.binaryGenTime);
                 formatHandler->writeBinary(ofs);
+            }
             else
                 throw AsmException(std::string("Can't open output file '")+filename+"'");
         }
@@ -3115,8 +4150,13 @@ void Assembler::writeBinary(std::ostream& outStream) const
     if (good)
     {
         const AsmFormatHandler* formatHandler = getFormatHandler();
-        if (formatHandler!=nullptr)
+        if (useCachedBinary)
+            writeCachedBinary(outStream);
+        else if (formatHandler!=nullptr)
+        {
+            AsmStatsTimer timer(statsEnabled, stats.binaryGenTime);
             formatHandler->writeBinary(outStream);
+        }
         else
             throw AsmException("No output binary");
     }
@@ -3129,8 +4169,13 @@ void Assembler::writeBinary(Array<cxbyte>& array) const
     if (good)
     {
         const AsmFormatHandler* formatHandler = getFormatHandler();
-        if (formatHandler!=nullptr)
+        if (useCachedBinary)
+            array = cacheEntry.binary;
+        else if (formatHandler!=nullptr)
+        {
+            AsmStatsTimer timer(statsEnabled, stats.binaryGenTime);
             formatHandler->writeBinary(array);
+        }
         else
             throw AsmException("No output binary");
     }
@@ -1498,7 +1498,8 @@ static void dumpAmdKernelConfig(std::ostream& output, const AmdKernelConfig& con
 }
 
 void CLRX::disassembleAmd(std::ostream& output, const AmdDisasmInput* amdInput,
-       ISADisassembler* isaDisassembler, size_t& sectionCount, Flags flags)
+       ISADisassembler* isaDisassembler, size_t& sectionCount, Flags flags,
+       cxuint threadsNum)
 {
     if (amdInput->is64BitMode)
         output.write(".64bit\n", 7);
@@ -1529,8 +1530,25 @@ void CLRX::disassembleAmd(std::ostream& output, const AmdDisasmInput* amdInput,
         printDisasmData(amdInput->globalDataSize, amdInput->globalData, output);
     }
     
-    for (const AmdDisasmKernelInput& kinput: amdInput->kernels)
+    const size_t kernelsNum = amdInput->kernels.size();
+    std::vector<std::string> kernelCodes;
+    if (doDumpCode && threadsNum != 1 && kernelsNum > 1)
+        // disassemble codes of kernels in parallel before writing
+        disassembleCodesInParallel(isaDisassembler, kernelsNum, threadsNum, sectionCount,
+            [amdInput](size_t i)
+            {
+                const AmdDisasmKernelInput& kinput = amdInput->kernels[i];
+                return kinput.code != nullptr && kinput.codeSize != 0;
+            },
+            [amdInput](size_t i, ISADisassembler* kdisasm)
+            {
+                const AmdDisasmKernelInput& kinput = amdInput->kernels[i];
+                kdisasm->setInput(kinput.codeSize, kinput.code);
+            }, kernelCodes);
+    
+    for (size_t i = 0; i < kernelsNum; i++)
     {
+        const AmdDisasmKernelInput& kinput = amdInput->kernels[i];
         output.write(".kernel ", 8);
         output.write(kinput.kernelName.c_str(), kinput.kernelName.size());
         output.put('\n');
@@ -1549,9 +1567,14 @@ void CLRX::disassembleAmd(std::ostream& output, const AmdDisasmInput* amdInput,
         {
             // input kernel code (main disassembly)
             output.write("    .text\n", 10);
-            isaDisassembler->setInput(kinput.codeSize, kinput.code);
-            isaDisassembler->beforeDisassemble();
-            isaDisassembler->disassemble();
+            if (!kernelCodes.empty())
+                output.write(kernelCodes[i].c_str(), kernelCodes[i].size());
+            else
+            {
+                isaDisassembler->setInput(kinput.codeSize, kinput.code);
+                isaDisassembler->beforeDisassemble();
+                isaDisassembler->disassemble();
+            }
             sectionCount++;
         }
     }
@@ -797,8 +797,23 @@ static void dumpAmdCL2ArgsAndSamplers(std::ostream& output,
     }
 }
 
+// set kernel code and its relocations as input of ISA disassembler
+static void setKernelCodeInput(ISADisassembler* isaDisassembler,
+            const AmdCL2DisasmKernelInput& kinput)
+{
+    isaDisassembler->clearRelocations();
+    isaDisassembler->addRelSymbol(".gdata");
+    isaDisassembler->addRelSymbol(".ddata"); // rw data
+    isaDisassembler->addRelSymbol(".bdata"); // .bss data
+    for (const AmdCL2RelaEntry& entry: kinput.textRelocs)
+        isaDisassembler->addRelocation(entry.offset, entry.type, 
+                       cxuint(entry.symbol), entry.addend);
+    isaDisassembler->setInput(kinput.codeSize, kinput.code);
+}
+
 void CLRX::disassembleAmdCL2(std::ostream& output, const AmdCL2DisasmInput* amdCL2Input,
-       ISADisassembler* isaDisassembler, size_t& sectionCount, Flags flags)
+       ISADisassembler* isaDisassembler, size_t& sectionCount, Flags flags,
+       cxuint threadsNum)
 {
     const bool doMetadata = ((flags & DISASM_METADATA) != 0);
     const bool doDumpData = ((flags & DISASM_DUMPDATA) != 0);
@@ -917,8 +932,22 @@ void CLRX::disassembleAmdCL2(std::ostream& output, const AmdCL2DisasmInput* amdC
     const GPUArchitecture arch = getGPUArchitectureFromDeviceType(amdCL2Input->deviceType);
     const cxuint maxSgprsNum = getGPUMaxRegistersNum(arch, REGTYPE_SGPR, 0);
     
-    for (const AmdCL2DisasmKernelInput& kinput: amdCL2Input->kernels)
+    const size_t kernelsNum = amdCL2Input->kernels.size();
+    std::vector<std::string> kernelCodes;
+    if (doDumpCode && threadsNum != 1 && kernelsNum > 1)
+        // disassemble codes of kernels in parallel before writing
+        disassembleCodesInParallel(isaDisassembler, kernelsNum, threadsNum, sectionCount,
+            [amdCL2Input](size_t i)
+            {
+                const AmdCL2DisasmKernelInput& kinput = amdCL2Input->kernels[i];
+                return kinput.code != nullptr && kinput.codeSize != 0;
+            },
+            [amdCL2Input](size_t i, ISADisassembler* kdisasm)
+            { setKernelCodeInput(kdisasm, amdCL2Input->kernels[i]); }, kernelCodes);
+    
+    for (size_t i = 0; i < kernelsNum; i++)
     {
+        const AmdCL2DisasmKernelInput& kinput = amdCL2Input->kernels[i];
         output.write(".kernel ", 8);
         output.write(kinput.kernelName.c_str(), kinput.kernelName.size());
         output.put('\n');
@@ -985,18 +1014,15 @@ void CLRX::disassembleAmdCL2(std::ostream& output, const AmdCL2DisasmInput* amdC
         if (doDumpCode && kinput.code != nullptr && kinput.codeSize != 0)
         {
             // input kernel code (main disassembly)
-            isaDisassembler->clearRelocations();
-            isaDisassembler->addRelSymbol(".gdata");
-            isaDisassembler->addRelSymbol(".ddata"); // rw data
-            isaDisassembler->addRelSymbol(".bdata"); // .bss data
-            for (const AmdCL2RelaEntry& entry: kinput.textRelocs)
-                isaDisassembler->addRelocation(entry.offset, entry.type, 
-                               cxuint(entry.symbol), entry.addend);
-    
             output.write("    .text\n", 10);
-            isaDisassembler->setInput(kinput.codeSize, kinput.code);
-            isaDisassembler->beforeDisassemble();
-            isaDisassembler->disassemble();
+            if (!kernelCodes.empty())
+                output.write(kernelCodes[i].c_str(), kernelCodes[i].size());
+            else
+            {
+                setKernelCodeInput(isaDisassembler, kinput);
+                isaDisassembler->beforeDisassemble();
+                isaDisassembler->disassemble();
+            }
             sectionCount++;
         }
     }
@@ -25,6 +25,8 @@
 #include <string>
 #include <ostream>
 #include <utility>
+#include <vector>
+#include <functional>
 #include <CLRX/utils/Utilities.h>
 #include <CLRX/amdbin/AmdBinaries.h>
 #include <CLRX/amdbin/AmdCL2Binaries.h>
@@ -47,15 +49,24 @@ extern CLRX_INTERNAL void printDisasmDataU32(size_t size, const uint32_t* data,
 extern CLRX_INTERNAL void printDisasmLongString(size_t size, const char* data,
             std::ostream& output, bool secondAlign = false);
 
+// disassemble independent codes in parallel (every code to own output string)
+// sectionCount - section count before first code (numbered labels use it)
+// setCodeInput sets input (and relocations) for code that has code
+extern CLRX_INTERNAL void disassembleCodesInParallel(
+        const ISADisassembler* isaDisassembler, size_t codesNum, cxuint threadsNum,
+        size_t sectionCount, const std::function<bool(size_t)>& hasCode,
+        const std::function<void(size_t, ISADisassembler*)>& setCodeInput,
+        std::vector<std::string>& codeOutputs);
+
 // disassemble Amd OpenCL 1.0 binary input
 extern CLRX_INTERNAL void disassembleAmd(std::ostream& output,
        const AmdDisasmInput* amdInput, ISADisassembler* isaDisassembler,
-       size_t& sectionCount, Flags flags);
+       size_t& sectionCount, Flags flags, cxuint threadsNum = 1);
 
 // disassemble Amd OpenCL 2.0 binary input
 extern CLRX_INTERNAL void disassembleAmdCL2(std::ostream& output,
         const AmdCL2DisasmInput* amdCL2Input, ISADisassembler* isaDisassembler,
-        size_t& sectionCount, Flags flags);
+        size_t& sectionCount, Flags flags, cxuint threadsNum = 1);
 
 // disassemble ROCm binary input
 extern CLRX_INTERNAL void disassembleROCm(std::ostream& output,
@@ -21,6 +21,7 @@
 #include <string>
 #include <cstring>
 #include <ostream>
+#include <sstream>
 #include <cstring>
 #include <memory>
 #include <vector>
@@ -40,12 +41,23 @@ DisasmException::DisasmException(const std::string& message) : Exception(message
 
 ISADisassembler::ISADisassembler(Disassembler& _disassembler, cxuint outBufSize)
         : disassembler(_disassembler), startOffset(0), labelStartOffset(0),
-          dontPrintLabelsAfterCode(false), output(outBufSize, _disassembler.getOutput())
+          dontPrintLabelsAfterCode(false), sectionId(SIZE_MAX),
+          output(outBufSize, _disassembler.getOutput())
+{ }
+
+ISADisassembler::ISADisassembler(Disassembler& _disassembler, std::ostream& _output,
+        cxuint outBufSize)
+        : disassembler(_disassembler), startOffset(0), labelStartOffset(0),
+          dontPrintLabelsAfterCode(false), sectionId(SIZE_MAX),
+          output(outBufSize, _output)
 { }
 
 ISADisassembler::~ISADisassembler()
 { }
 
+size_t ISADisassembler::getSectionId() const
+{ return (sectionId != SIZE_MAX) ? sectionId : disassembler.sectionCount; }
+
 void ISADisassembler::writeLabelsToPosition(size_t pos, LabelIter& labelIter,
               NamedLabelIter& namedLabelIter)
 {
@@ -86,7 +98,7 @@ void ISADisassembler::writeLabelsToPosition(size_t pos, LabelIter& labelIter,
                 buf[bufPos++] = 'L';
                 bufPos += itocstrCStyle(*labelIter, buf+bufPos, 22, 10, 0, false);
                 buf[bufPos++] = '_';
-                bufPos += itocstrCStyle(disassembler.sectionCount,
+                bufPos += itocstrCStyle(getSectionId(),
                                 buf+bufPos, 22, 10, 0, false);
                 if (curPos != pos)
                 {
@@ -173,7 +185,7 @@ void ISADisassembler::writeLabelsToEnd(size_t start, LabelIter labelIter,
             buf[bufPos++] = 'L';
             bufPos += itocstrCStyle(*labelIter, buf+bufPos, 22, 10, 0, false);
             buf[bufPos++] = '_';
-            bufPos += itocstrCStyle(disassembler.sectionCount,
+            bufPos += itocstrCStyle(getSectionId(),
                             buf+bufPos, 22, 10, 0, false);
             buf[bufPos++] = ':';
             buf[bufPos++] = '\n';
@@ -219,7 +231,7 @@ void ISADisassembler::writeLocation(size_t pos)
     buf[bufPos++] = 'L';
     bufPos += itocstrCStyle(pos, buf+bufPos, 22, 10, 0, false);
     buf[bufPos++] = '_';
-    bufPos += itocstrCStyle(disassembler.sectionCount, buf+bufPos, 22, 10, 0, false);
+    bufPos += itocstrCStyle(getSectionId(), buf+bufPos, 22, 10, 0, false);
     output.forward(bufPos);
 }
 
@@ -277,6 +289,12 @@ void ISADisassembler::prepareLabelsAndRelocations()
     mapSort(relocations.begin(), relocations.end());
 }
 
+ISADisassembler* ISADisassembler::createForOutput(std::ostream& output) const
+{
+    throw DisasmException("Parallel disassembling is not supported by this "
+                "ISA disassembler");
+}
+
 void ISADisassembler::beforeDisassemble()
 {
     clearNumberedLabels();
@@ -286,7 +304,8 @@ void ISADisassembler::beforeDisassemble()
 
 Disassembler::Disassembler(const AmdMainGPUBinary32& binary, std::ostream& _output,
             Flags _flags) : fromBinary(true), binaryFormat(BinaryFormat::AMD),
-            amdInput(nullptr), output(_output), flags(_flags), sectionCount(0)
+            amdInput(nullptr), output(_output), flags(_flags),
+            sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     amdInput = getAmdDisasmInputFromBinary32(binary, flags);
@@ -294,7 +313,8 @@ Disassembler::Disassembler(const AmdMainGPUBinary32& binary, std::ostream& _outp
 
 Disassembler::Disassembler(const AmdMainGPUBinary64& binary, std::ostream& _output,
             Flags _flags) : fromBinary(true), binaryFormat(BinaryFormat::AMD),
-            amdInput(nullptr), output(_output), flags(_flags), sectionCount(0)
+            amdInput(nullptr), output(_output), flags(_flags),
+            sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     amdInput = getAmdDisasmInputFromBinary64(binary, flags);
@@ -303,7 +323,7 @@ Disassembler::Disassembler(const AmdMainGPUBinary64& binary, std::ostream& _outp
 Disassembler::Disassembler(const AmdCL2MainGPUBinary32& binary, std::ostream& _output,
            Flags _flags, cxuint driverVersion) : fromBinary(true),
             binaryFormat(BinaryFormat::AMDCL2), amdCL2Input(nullptr), output(_output),
-            flags(_flags), sectionCount(0)
+            flags(_flags), sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     amdCL2Input = getAmdCL2DisasmInputFromBinary32(binary, driverVersion);
@@ -312,7 +332,7 @@ Disassembler::Disassembler(const AmdCL2MainGPUBinary32& binary, std::ostream& _o
 Disassembler::Disassembler(const AmdCL2MainGPUBinary64& binary, std::ostream& _output,
            Flags _flags, cxuint driverVersion) : fromBinary(true),
             binaryFormat(BinaryFormat::AMDCL2), amdCL2Input(nullptr), output(_output),
-            flags(_flags), sectionCount(0)
+            flags(_flags), sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     amdCL2Input = getAmdCL2DisasmInputFromBinary64(binary, driverVersion);
@@ -320,7 +340,8 @@ Disassembler::Disassembler(const AmdCL2MainGPUBinary64& binary, std::ostream& _o
 
 Disassembler::Disassembler(const ROCmBinary& binary, std::ostream& _output, Flags _flags)
          : fromBinary(true), binaryFormat(BinaryFormat::ROCM),
-           rocmInput(nullptr), output(_output), flags(_flags), sectionCount(0)
+           rocmInput(nullptr), output(_output), flags(_flags),
+           sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     rocmInput = getROCmDisasmInputFromBinary(binary);
@@ -328,21 +349,24 @@ Disassembler::Disassembler(const ROCmBinary& binary, std::ostream& _output, Flag
 
 Disassembler::Disassembler(const AmdDisasmInput* disasmInput, std::ostream& _output,
             Flags _flags) : fromBinary(false), binaryFormat(BinaryFormat::AMD),
-            amdInput(disasmInput), output(_output), flags(_flags), sectionCount(0)
+            amdInput(disasmInput), output(_output), flags(_flags),
+            sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
 }
 
 Disassembler::Disassembler(const AmdCL2DisasmInput* disasmInput, std::ostream& _output,
             Flags _flags) : fromBinary(false), binaryFormat(BinaryFormat::AMDCL2),
-            amdCL2Input(disasmInput), output(_output), flags(_flags), sectionCount(0)
+            amdCL2Input(disasmInput), output(_output), flags(_flags),
+            sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
 }
 
 Disassembler::Disassembler(const ROCmDisasmInput* disasmInput, std::ostream& _output,
                  Flags _flags) : fromBinary(false), binaryFormat(BinaryFormat::ROCM),
-            rocmInput(disasmInput), output(_output), flags(_flags), sectionCount(0)
+            rocmInput(disasmInput), output(_output), flags(_flags),
+            sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
 }
@@ -350,7 +374,8 @@ Disassembler::Disassembler(const ROCmDisasmInput* disasmInput, std::ostream& _ou
 Disassembler::Disassembler(GPUDeviceType deviceType, const GalliumBinary& binary,
            std::ostream& _output, Flags _flags, cxuint llvmVersion) :
            fromBinary(true), binaryFormat(BinaryFormat::GALLIUM),
-           galliumInput(nullptr), output(_output), flags(_flags), sectionCount(0)
+           galliumInput(nullptr), output(_output), flags(_flags),
+           sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     galliumInput = getGalliumDisasmInputFromBinary(deviceType, binary, llvmVersion);
@@ -358,7 +383,8 @@ Disassembler::Disassembler(GPUDeviceType deviceType, const GalliumBinary& binary
 
 Disassembler::Disassembler(const GalliumDisasmInput* disasmInput, std::ostream& _output,
              Flags _flags) : fromBinary(false), binaryFormat(BinaryFormat::GALLIUM),
-            galliumInput(disasmInput), output(_output), flags(_flags), sectionCount(0)
+            galliumInput(disasmInput), output(_output), flags(_flags),
+            sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
 }
@@ -366,7 +392,7 @@ Disassembler::Disassembler(const GalliumDisasmInput* disasmInput, std::ostream&
 Disassembler::Disassembler(GPUDeviceType deviceType, size_t rawCodeSize,
            const cxbyte* rawCode, std::ostream& _output, Flags _flags)
        : fromBinary(true), binaryFormat(BinaryFormat::RAWCODE),
-         output(_output), flags(_flags), sectionCount(0)
+         output(_output), flags(_flags), sectionCount(0), threadsNum(1)
 {
     isaDisassembler.reset(new GCNDisassembler(*this));
     rawInput = new RawCodeInput{ deviceType, rawCodeSize, rawCode };
@@ -414,6 +440,36 @@ GPUDeviceType Disassembler::getDeviceType() const
     }
 }
 
+void CLRX::disassembleCodesInParallel(const ISADisassembler* isaDisassembler,
+        size_t codesNum, cxuint threadsNum, size_t sectionCount,
+        const std::function<bool(size_t)>& hasCode,
+        const std::function<void(size_t, ISADisassembler*)>& setCodeInput,
+        std::vector<std::string>& codeOutputs)
+{
+    // section ids (used by numbered labels) as in serial disassembling
+    std::vector<size_t> sectionIds(codesNum, SIZE_MAX);
+    for (size_t i = 0; i < codesNum; i++)
+        if (hasCode(i))
+            sectionIds[i] = sectionCount++;
+    
+    codeOutputs.assign(codesNum, std::string());
+    parallelFor(codesNum, threadsNum, [&](size_t i)
+    {
+        if (sectionIds[i] == SIZE_MAX)
+            return; // no code
+        // every code has own ISA disassembler and own output
+        std::ostringstream codeOss;
+        codeOss.exceptions(std::ios::failbit | std::ios::badbit);
+        std::unique_ptr<ISADisassembler> codeDisasm(
+                    isaDisassembler->createForOutput(codeOss));
+        codeDisasm->setSectionId(sectionIds[i]);
+        setCodeInput(i, codeDisasm.get());
+        codeDisasm->beforeDisassemble();
+        codeDisasm->disassemble();
+        codeOutputs[i] = codeOss.str();
+    });
+}
+
 void CLRX::printDisasmData(size_t size, const cxbyte* data, std::ostream& output,
                 bool secondAlign)
 {
@@ -624,11 +680,12 @@ void Disassembler::disassemble()
     switch(binaryFormat)
     {
         case BinaryFormat::AMD:
-            disassembleAmd(output, amdInput, isaDisassembler.get(), sectionCount, flags);
+            disassembleAmd(output, amdInput, isaDisassembler.get(), sectionCount, flags,
+                           threadsNum);
             break;
         case BinaryFormat::AMDCL2:
             disassembleAmdCL2(output, amdCL2Input, isaDisassembler.get(),
-                              sectionCount, flags);
+                              sectionCount, flags, threadsNum);
             break;
         case BinaryFormat::ROCM:
             disassembleROCm(output, rocmInput, isaDisassembler.get(), flags);
@@ -33,6 +33,71 @@ using namespace CLRX;
 static OnceFlag clrxGCNAssemblerOnceFlag;
 static Array<GCNAsmInstruction> gcnInstrSortedTable;
 
+// entry of mnemonic index
+struct CLRX_INTERNAL GCNMnemonicIndexEntry
+{
+    uint32_t hash;  // lower 32-bits of mnemonic hash
+    uint32_t index; // index of instruction in sorted table (UINT32_MAX if empty)
+};
+
+/* mnemonic indices (hash tables with linear probing) for every architecture.
+ * every index maps mnemonic to first instruction (in sorted table)
+ * which is available for this architecture */
+static const cxuint gcnArchsNum = cxuint(GPUArchitecture::GPUARCH_MAX)+1;
+static Array<GCNMnemonicIndexEntry> gcnMnemonicIndices[gcnArchsNum];
+
+static void initializeGCNMnemonicIndex(cxuint arch)
+{
+    const uint16_t archMask = 1U<<arch;
+    size_t mnemonicsNum = 0;
+    const char* lastMnemonic = "";
+    for (const GCNAsmInstruction& insn: gcnInstrSortedTable)
+        if ((insn.archMask & archMask) != 0 && ::strcmp(insn.mnemonic, lastMnemonic)!=0)
+        {
+            lastMnemonic = insn.mnemonic;
+            mnemonicsNum++;
+        }
+    
+    // hash table is at most half filled
+    size_t indexSize = 1;
+    while (indexSize < mnemonicsNum*2)
+        indexSize <<= 1;
+    Array<GCNMnemonicIndexEntry>& mnemIndex = gcnMnemonicIndices[arch];
+    mnemIndex.resize(indexSize);
+    std::fill(mnemIndex.begin(), mnemIndex.end(), GCNMnemonicIndexEntry{ 0, UINT32_MAX });
+    lastMnemonic = "";
+    for (size_t i = 0; i < gcnInstrSortedTable.size(); i++)
+    {
+        const GCNAsmInstruction& insn = gcnInstrSortedTable[i];
+        if ((insn.archMask & archMask) == 0 || ::strcmp(insn.mnemonic, lastMnemonic)==0)
+            continue;
+        // first instruction with this mnemonic for this architecture
+        lastMnemonic = insn.mnemonic;
+        const size_t hash = CStringHash()(insn.mnemonic);
+        size_t pos = hash & (indexSize-1);
+        while (mnemIndex[pos].index != UINT32_MAX)
+            pos = (pos+1) & (indexSize-1);
+        mnemIndex[pos] = { uint32_t(hash), uint32_t(i) };
+    }
+}
+
+// find first instruction for architecture, returns null if not found
+static const GCNAsmInstruction* findGCNInstruction(const char* mnemonic, cxuint arch)
+{
+    const Array<GCNMnemonicIndexEntry>& mnemIndex = gcnMnemonicIndices[arch];
+    const size_t hash = CStringHash()(mnemonic);
+    const size_t mask = mnemIndex.size()-1;
+    for (size_t pos = hash & mask; mnemIndex[pos].index != UINT32_MAX;
+                pos = (pos+1) & mask)
+    {
+        const GCNAsmInstruction& insn = gcnInstrSortedTable[mnemIndex[pos].index];
+        if (mnemIndex[pos].hash == uint32_t(hash) &&
+            ::strcmp(insn.mnemonic, mnemonic)==0)
+            return &insn;
+    }
+    return nullptr;
+}
+
 static void initializeGCNAssembler()
 {
     size_t tableSize = 0;
@@ -115,6 +180,9 @@ static void initializeGCNAssembler()
         }
     }
     gcnInstrSortedTable.resize(j); // final size
+    
+    for (cxuint arch = 0; arch < gcnArchsNum; arch++)
+        initializeGCNMnemonicIndex(arch);
 }
 
 // GCN Usage handler
@@ -3888,20 +3956,10 @@ void GCNAssembler::assemble(const CString& inMnemonic, const char* mnemPlace,
     else
         mnemonic = inMnemonic;
     
-    // find instruction by mnemonic
-    auto it = binaryFind(gcnInstrSortedTable.begin(), gcnInstrSortedTable.end(),
-               GCNAsmInstruction{mnemonic.c_str()},
-               [](const GCNAsmInstruction& instr1, const GCNAsmInstruction& instr2)
-               { return ::strcmp(instr1.mnemonic, instr2.mnemonic)<0; });
-    
-    // find matched entry
-    if (it != gcnInstrSortedTable.end() && (it->archMask & curArchMask)==0)
-        // if not match current arch mask
-        for (++it ;it != gcnInstrSortedTable.end() &&
-               ::strcmp(it->mnemonic, mnemonic.c_str())==0 &&
-               (it->archMask & curArchMask)==0; ++it);
-
-    if (it == gcnInstrSortedTable.end() || ::strcmp(it->mnemonic, mnemonic.c_str())!=0)
+    // find instruction by mnemonic (in index for current architecture)
+    const GCNAsmInstruction* it = findGCNInstruction(mnemonic.c_str(),
+                CTZ32(curArchMask));
+    if (it == nullptr)
     {
         // unrecognized mnemonic
         printError(mnemPlace, "Unknown instruction");
@@ -266,9 +266,18 @@ GCNDisassembler::GCNDisassembler(Disassembler& disassembler)
     callOnce(clrxGCNDisasmOnceFlag, initializeGCNDisassembler);
 }
 
+GCNDisassembler::GCNDisassembler(Disassembler& disassembler, std::ostream& output)
+        : ISADisassembler(disassembler, output), instrOutOfCode(false)
+{
+    callOnce(clrxGCNDisasmOnceFlag, initializeGCNDisassembler);
+}
+
 GCNDisassembler::~GCNDisassembler()
 { }
 
+ISADisassembler* GCNDisassembler::createForOutput(std::ostream& output) const
+{ return new GCNDisassembler(disassembler, output); }
+
 // gcn encoding sizes table: true - if 8 byte encoding, false - 4 byte encoding
 // for GCN1.0/1.1
 static const bool gcnSize11Table[16] =
@@ -3432,5 +3441,5 @@ void GCNDisassembler::disassemble()
     if (!dontPrintLabelsAfterCode)
         writeLabelsToEnd(codeWordsNum<<2, curLabel, curNamedLabel);
     output.flush();
-    disassembler.getOutput().flush();
+    output.getOStream().flush();
 }
@@ -178,17 +178,18 @@ void AmdInput::addEmptyKernel(const char* kernelName)
     kernels.push_back(std::move(kernel));
 }
 
-AmdGPUBinGenerator::AmdGPUBinGenerator() : manageable(false), input(nullptr)
+AmdGPUBinGenerator::AmdGPUBinGenerator() : manageable(false), input(nullptr),
+        threadsNum(1)
 { }
 
 AmdGPUBinGenerator::AmdGPUBinGenerator(const AmdInput* amdInput)
-        : manageable(false), input(amdInput)
+        : manageable(false), input(amdInput), threadsNum(1)
 { }
 
 AmdGPUBinGenerator::AmdGPUBinGenerator(bool _64bitMode, GPUDeviceType deviceType,
        uint32_t driverVersion, size_t globalDataSize, const cxbyte* globalData,
        const std::vector<AmdKernelInput>& kernelInputs)
-        : manageable(true), input(nullptr)
+        : manageable(true), input(nullptr), threadsNum(1)
 {
     input = new AmdInput{_64bitMode, deviceType, globalDataSize, globalData,
                 driverVersion, "", "", kernelInputs };
@@ -197,7 +198,7 @@ AmdGPUBinGenerator::AmdGPUBinGenerator(bool _64bitMode, GPUDeviceType deviceType
 AmdGPUBinGenerator::AmdGPUBinGenerator(bool _64bitMode, GPUDeviceType deviceType,
        uint32_t driverVersion, size_t globalDataSize, const cxbyte* globalData,
        std::vector<AmdKernelInput>&& kernelInputs)
-        : manageable(true), input(nullptr)
+        : manageable(true), input(nullptr), threadsNum(1)
 {
     input = new AmdInput{_64bitMode, deviceType, globalDataSize, globalData,
                 driverVersion, "", "", std::move(kernelInputs) };
@@ -409,6 +410,8 @@ struct CLRX_INTERNAL TempAmdKernelData
     ElfBinaryGen32 elfBinGen; // for kernel
     CALEncodingEntry calEncEntry;
     uint32_t header[8];
+    size_t metadataSize;
+    Array<cxbyte> innerBinary; // pregenerated inner binary (in parallel mode)
 };
 
 // fast and memory efficient String table generator for main binary
@@ -620,7 +623,10 @@ public:
     void operator()(FastOutputBuffer& fob) const
     {
         for (TempAmdKernelData& kernel: tempDatas)
-            kernel.elfBinGen.generate(fob);
+            if (!kernel.innerBinary.empty())
+                fob.writeArray(kernel.innerBinary.size(), kernel.innerBinary.data());
+            else
+                kernel.elfBinGen.generate(fob);
     }
 };
 
@@ -1626,12 +1632,25 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
             gpuDeviceCodeTable[cxuint(input->deviceType)], EV_CURRENT, UINT_MAX, 0, 0 }));
     
     Array<TempAmdKernelData> tempAmdKernelDatas(kernelsNum);
-    cxuint uniqueId = 1024;
-    std::vector<cxuint> uniqueIds = collectUniqueIdsAndFunctionIds(input);
+    Array<cxuint> kernelUniqueIds(kernelsNum);
+    {
+        // assign uniqueIds before generating kernels (independent from kernel order)
+        cxuint uniqueId = 1024;
+        std::vector<cxuint> uniqueIds = collectUniqueIdsAndFunctionIds(input);
+        for (size_t i = 0; i < kernelsNum; i++)
+            if (input->kernels[i].useConfig)
+            {
+                // get new free uniqueId
+                while (std::binary_search(uniqueIds.begin(), uniqueIds.end(), uniqueId))
+                    uniqueId++;
+                kernelUniqueIds[i] = uniqueId++;
+            }
+    }
     
-    uint64_t allInnerBinSize = 0;
-    size_t rodataSize = 0;
-    for (size_t i = 0; i < kernelsNum; i++)
+    /* generate inner binaries for kernels (in parallel if threadsNum>1).
+     * every kernel uses only own temporary data */
+    const bool parallelMode = (threadsNum != 1 && kernelsNum > 1);
+    parallelFor(kernelsNum, threadsNum, [&](size_t i)
     {
         size_t calNotesSize = 0;
         size_t metadataSize = 0;
@@ -1640,10 +1659,6 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
         tempData.kernelDataGen = KernelDataGen(&kinput);
         if (kinput.useConfig)
         {
-            // get new free uniqueId
-            while (std::binary_search(uniqueIds.begin(), uniqueIds.end(), uniqueId))
-                uniqueId++;
-            
             const AmdKernelConfig& config = kinput.config;
             cxuint readOnlyImages = 0;
             cxuint writeOnlyImages = 0;
@@ -1688,7 +1703,7 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
             tempConfig.uavsNum = uavsNum;
             
             tempAmdKernelDatas[i].metadata = generateMetadata(driverVersion, input, kinput,
-                     tempConfig, argSamplersNum, uniqueId);
+                     tempConfig, argSamplersNum, kernelUniqueIds[i]);
             
             calNotesSize = uint64_t(20*17) /*calNoteHeaders*/ + 16 + 128 + (18+32 +
                 4*((isOlderThan1124)?16:config.userDatas.size()))*8 /* proginfo */ +
@@ -1706,8 +1721,6 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
             tempData.header[5] = LEV(1U);
             tempData.header[6] = 0U;
             tempData.header[7] = 0U;
-            
-            uniqueId++;
         }
         else
         {
@@ -1717,7 +1730,7 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
             metadataSize = kinput.metadataSize + kinput.headerSize;
         }
         
-        rodataSize += metadataSize;
+        tempData.metadataSize = metadataSize;
         /* kernel elf bin generator */
         ElfBinaryGen32& kelfBinGen = tempAmdKernelDatas[i].elfBinGen;
         
@@ -1768,11 +1781,27 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
         const uint64_t innerBinSize = kelfBinGen.countSize();
         if (innerBinSize > UINT32_MAX)
             throw BinGenException("Inner binary size is too big!");
-        allInnerBinSize += tempAmdKernelDatas[i].innerBinSize = innerBinSize;
+        tempAmdKernelDatas[i].innerBinSize = innerBinSize;
         
         tempAmdKernelDatas[i].calEncEntry =
             { LEV(uint32_t(gpuDeviceInnerCodeTable[cxuint(input->deviceType)])), LEV(4U), 
                 LEV(0x1c0U), LEV(uint32_t(tempAmdKernelDatas[i].innerBinSize - 0x1c0U)) };
+        
+        if (parallelMode)
+        {
+            // generate inner binary now, main text generator just copies it
+            tempData.innerBinary.resize(innerBinSize);
+            FastOutputBuffer fob(innerBinSize, (char*)tempData.innerBinary.data());
+            kelfBinGen.generate(fob);
+        }
+    });
+    
+    uint64_t allInnerBinSize = 0;
+    size_t rodataSize = 0;
+    for (const TempAmdKernelData& tempData: tempAmdKernelDatas)
+    {
+        rodataSize += tempData.metadataSize;
+        allInnerBinSize += tempData.innerBinSize;
     }
     if (input->globalData!=nullptr)
         rodataSize += input->globalDataSize;
@@ -1805,29 +1834,30 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
     /****
      * prepare for write binary to output
      ****/
-    std::unique_ptr<std::ostream> outStreamHolder;
-    std::ostream* os = nullptr;
+    std::unique_ptr<FastOutputBuffer> fobHolder;
     if (aPtr != nullptr)
     {
+        // write directly to memory of output array
         aPtr->resize(binarySize);
-        outStreamHolder.reset(
-            new ArrayOStream(binarySize, reinterpret_cast<char*>(aPtr->data())));
-        os = outStreamHolder.get();
+        fobHolder.reset(new FastOutputBuffer(binarySize,
+                    reinterpret_cast<char*>(aPtr->data())));
     }
     else if (vPtr != nullptr)
     {
+        // write directly to memory of output vector
         vPtr->resize(binarySize);
-        outStreamHolder.reset(new VectorOStream(*vPtr));
-        os = outStreamHolder.get();
+        fobHolder.reset(new FastOutputBuffer(binarySize, vPtr->data()));
     }
     else // from argument
-        os = osPtr;
+        fobHolder.reset(new FastOutputBuffer(256, *osPtr));
+    FastOutputBuffer& fob = *fobHolder;
     
-    const std::ios::iostate oldExceptions = os->exceptions();
-    FastOutputBuffer fob(256, *os);
+    const std::ios::iostate oldExceptions = (osPtr != nullptr) ?
+                osPtr->exceptions() : std::ios::goodbit;
     try
     {
-        os->exceptions(std::ios::failbit | std::ios::badbit);
+        if (osPtr != nullptr)
+            osPtr->exceptions(std::ios::failbit | std::ios::badbit);
         if (input->is64Bit)
             elfBinGen64->generate(fob);
         else
@@ -1835,10 +1865,12 @@ void AmdGPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char>
     }
     catch(...)
     {
-        os->exceptions(oldExceptions);
+        if (osPtr != nullptr)
+            osPtr->exceptions(oldExceptions);
         throw;
     }
-    os->exceptions(oldExceptions);
+    if (osPtr != nullptr)
+        osPtr->exceptions(oldExceptions);
     assert(fob.getWritten() == binarySize);
 }
 
@@ -2609,29 +2609,30 @@ void AmdCL2GPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<ch
     /****
      * prepare for write binary to output
      ****/
-    std::unique_ptr<std::ostream> outStreamHolder;
-    std::ostream* os = nullptr;
+    std::unique_ptr<FastOutputBuffer> fobHolder;
     if (aPtr != nullptr)
     {
+        // write directly to memory of output array
         aPtr->resize(binarySize);
-        outStreamHolder.reset(
-            new ArrayOStream(binarySize, reinterpret_cast<char*>(aPtr->data())));
-        os = outStreamHolder.get();
+        fobHolder.reset(new FastOutputBuffer(binarySize,
+                    reinterpret_cast<char*>(aPtr->data())));
     }
     else if (vPtr != nullptr)
     {
+        // write directly to memory of output vector
         vPtr->resize(binarySize);
-        outStreamHolder.reset(new VectorOStream(*vPtr));
-        os = outStreamHolder.get();
+        fobHolder.reset(new FastOutputBuffer(binarySize, vPtr->data()));
     }
     else // from argument
-        os = osPtr;
+        fobHolder.reset(new FastOutputBuffer(256, *osPtr));
+    FastOutputBuffer& fob = *fobHolder;
     
-    const std::ios::iostate oldExceptions = os->exceptions();
-    FastOutputBuffer fob(256, *os);
+    const std::ios::iostate oldExceptions = (osPtr != nullptr) ?
+                osPtr->exceptions() : std::ios::goodbit;
     try
     {
-        os->exceptions(std::ios::failbit | std::ios::badbit);
+        if (osPtr != nullptr)
+            osPtr->exceptions(std::ios::failbit | std::ios::badbit);
         if (input->is64Bit)
             elfBinGen64->generate(fob);
         else
@@ -2639,10 +2640,12 @@ void AmdCL2GPUBinGenerator::generateInternal(std::ostream* osPtr, std::vector<ch
     }
     catch(...)
     {
-        os->exceptions(oldExceptions);
+        if (osPtr != nullptr)
+            osPtr->exceptions(oldExceptions);
         throw;
     }
-    os->exceptions(oldExceptions);
+    if (osPtr != nullptr)
+        osPtr->exceptions(oldExceptions);
     assert(fob.getWritten() == binarySize);
 }
 
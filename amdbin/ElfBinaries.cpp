@@ -1240,7 +1240,8 @@ void ElfBinaryGenTemplate<Types>::generate(FastOutputBuffer& fob)
         }
     }
     fob.flush();
-    fob.getOStream().flush();
+    if (!fob.isMemoryOutput())
+        fob.getOStream().flush();
     assert(size == fob.getWritten()-startOffset);
 }
 
@@ -839,32 +839,33 @@ void GalliumBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char
     /****
      * prepare for write binary to output
      ****/
-    std::unique_ptr<std::ostream> outStreamHolder;
-    std::ostream* os = nullptr;
+    std::unique_ptr<FastOutputBuffer> bosHolder;
     if (aPtr != nullptr)
     {
+        // write directly to memory of output array
         aPtr->resize(binarySize);
-        outStreamHolder.reset(
-                new ArrayOStream(binarySize, reinterpret_cast<char*>(aPtr->data())));
-        os = outStreamHolder.get();
+        bosHolder.reset(new FastOutputBuffer(binarySize,
+                    reinterpret_cast<char*>(aPtr->data())));
     }
     else if (vPtr != nullptr)
     {
+        // write directly to memory of output vector
         vPtr->resize(binarySize);
-        outStreamHolder.reset(new VectorOStream(*vPtr));
-        os = outStreamHolder.get();
+        bosHolder.reset(new FastOutputBuffer(binarySize, vPtr->data()));
     }
     else // from argument
-        os = osPtr;
+        bosHolder.reset(new FastOutputBuffer(256, *osPtr));
+    FastOutputBuffer& bos = *bosHolder;
     
-    const std::ios::iostate oldExceptions = os->exceptions();
+    const std::ios::iostate oldExceptions = (osPtr != nullptr) ?
+                osPtr->exceptions() : std::ios::goodbit;
     try
     {
-    os->exceptions(std::ios::failbit | std::ios::badbit);
+    if (osPtr != nullptr)
+        osPtr->exceptions(std::ios::failbit | std::ios::badbit);
     /****
      * write binary to output
      ****/
-    FastOutputBuffer bos(256, *os);
     bos.writeObject<uint32_t>(LEV(kernelsNum));
     // write Gallium kernel info
     for (uint32_t korder: kernelsOrder)
@@ -904,10 +905,12 @@ void GalliumBinGenerator::generateInternal(std::ostream* osPtr, std::vector<char
     }
     catch(...)
     {
-        os->exceptions(oldExceptions);
+        if (osPtr != nullptr)
+            osPtr->exceptions(oldExceptions);
         throw;
     }
-    os->exceptions(oldExceptions);
+    if (osPtr != nullptr)
+        osPtr->exceptions(oldExceptions);
 }
 
 void GalliumBinGenerator::generate(Array<cxbyte>& array) const
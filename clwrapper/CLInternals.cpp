@@ -1722,6 +1722,20 @@ try
     for (cxuint i = 0; i < devicesNum; i++)
         progDeviceEntries[i].status = CL_BUILD_IN_PROGRESS;
     
+    // optional persistent cache of assembled binaries
+    std::unique_ptr<AsmCache> asmCache;
+    const std::string asmCacheDir = parseEnvVariable<std::string>("CLRX_ASMCACHE_DIR");
+    if (!asmCacheDir.empty())
+    {
+        try
+        {
+            asmCache.reset(new AsmCache(asmCacheDir.c_str(),
+                    uint64_t(parseEnvVariable<cxuint>("CLRX_ASMCACHE_SIZE", 64))<<20));
+        }
+        catch(const Exception& ex)
+        { } // assemble without cache
+    }
+    
     bool asmFailure = false;
     bool asmNotAvailable = false;
     cxuint prevDeviceType = -1;
@@ -1768,6 +1782,7 @@ try
         if (error != CL_SUCCESS)
             clrxAbort("Fatal error at clCompilerCall (clGetDeviceInfo)");
         assembler.set64Bit(addressBits==64);
+        assembler.setCache(asmCache.get());
         
         for (const CString& incPath: includePaths)
             assembler.addIncludeDir(incPath);
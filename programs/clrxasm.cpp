@@ -21,11 +21,18 @@
 #include <iostream>
 #include <memory>
 #include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdio>
 #include <cstring>
+#include <utility>
 #include <CLRX/utils/Utilities.h>
 #include <CLRX/utils/CLIParser.h>
 #include <CLRX/amdbin/AmdBinaries.h>
 #include <CLRX/amdbin/GalliumBinaries.h>
+#include <CLRX/amdasm/AsmCache.h>
 #include <CLRX/amdasm/Assembler.h>
 
 using namespace CLRX;
@@ -62,6 +69,24 @@ static const CLIOption programOptions[] =
     { "noMacroCase", 'm', CLIArgType::NONE, false, false,
         "do not ignore letter's case in macro names", nullptr },
     { "noWarnings", 'w', CLIArgType::NONE, false, false, "disable warnings", nullptr },
+    { "batch", 0, CLIArgType::STRING, false, false,
+        "assemble jobs listed in manifest file", "MANIFEST" },
+    { "jobs", 'j', CLIArgType::UINT, false, false,
+        "set number of parallel jobs in batch mode (0 - number of CPU threads)", "JOBS" },
+    { "cacheDir", 0, CLIArgType::STRING, false, false,
+        "use cache of assembled binaries in directory", "DIR" },
+    { "cacheSize", 0, CLIArgType::UINT, false, false,
+        "set maximal size of cache in megabytes (default 64)", "SIZE" },
+    { "includeCache", 0, CLIArgType::NONE, false, false,
+        "reuse state of unchanged included files between assemblings", nullptr },
+    { "macroLib", 0, CLIArgType::STRING_ARRAY, false, true,
+        "load macros and symbols from pre-parsed macro library", "FILE" },
+    { "writeMacroLib", 0, CLIArgType::STRING, false, false,
+        "write defined macros and absolute symbols to macro library", "FILE" },
+    { "verbose", 'v', CLIArgType::NONE, false, false,
+        "print statistics of searching of included files", nullptr },
+    { "stats", 0, CLIArgType::NONE, false, false,
+        "print times of assembler phases and counters", nullptr },
     CLRX_CLI_AUTOHELP
     { nullptr, 0 }
 };
@@ -77,14 +102,39 @@ static bool verifySymbolName(const CString& symbolName)
     return *c==0;
 }
 
-int main(int argc, const char** argv)
-try
+// print times of assembler phases and counters
+static void printAssemblerStats(const AsmStats& stats, std::ostream& msgStream)
+{
+    const std::pair<const char*, uint64_t> times[8] =
+    {
+        { "line reading", stats.lineReadingTime },
+        { "macro expansion", stats.macroExpansionTime },
+        { "pseudo-op dispatch", stats.pseudoOpTime },
+        { "instruction encoding", stats.instrEncodingTime },
+        { "expression evaluation", stats.exprEvaluationTime },
+        { "symbol resolution", stats.symbolResolvingTime },
+        { "register allocation", stats.regAllocTime },
+        { "binary generation", stats.binaryGenTime }
+    };
+    msgStream << "Assembler statistics:\n";
+    char buf[80];
+    for (const auto& time: times)
+    {
+        ::snprintf(buf, sizeof buf, "  %-24s%12.3f ms\n", time.first,
+                   double(time.second)*1e-6);
+        msgStream << buf;
+    }
+    msgStream << "  lines: " << stats.linesNum << ", macro expansions: " <<
+            stats.macroExpansionsNum << ", deferred expressions: " <<
+            stats.deferredExprsNum << ", symbols created: " << stats.symbolsNum <<
+            std::endl;
+}
+
+// assemble source for options given in CLI parser
+static int assembleFromCLI(const CLIParser& cli, bool batchJob, AsmCache* cache,
+            AsmIncludeCache* includeCache, std::ostream& msgStream,
+            std::ostream& printStream)
 {
-    CLIParser cli("clrxasm", programOptions, argc, argv);
-    cli.parse();
-    if (cli.handleHelpOrUsage())
-        return 0;
-    
     int ret = 0;
     bool is64Bit = false;
     BinaryFormat binFormat = BinaryFormat::AMD;
@@ -143,13 +193,22 @@ try
     
     std::unique_ptr<Assembler> assembler;
     if (!filenames.empty())
-        assembler.reset(new Assembler(filenames, flags, binFormat, deviceType));
+        assembler.reset(new Assembler(filenames, flags, binFormat, deviceType,
+                    msgStream, printStream));
+    else if (batchJob)
+        throw Exception("No input files in batch job");
     else // if from stdin
-        assembler.reset(new Assembler(nullptr, std::cin, flags, binFormat, deviceType));
+        assembler.reset(new Assembler(nullptr, std::cin, flags, binFormat, deviceType,
+                    msgStream, printStream));
     assembler->set64Bit(is64Bit);
     assembler->setDriverVersion(driverVersion);
     assembler->setLLVMVersion(llvmVersion);
     assembler->setNewROCmBinFormat(newROCmBinFormat);
+    // macro library is written from state of assembler (unavailable if cache hit)
+    if (!cli.hasLongOption("writeMacroLib"))
+        assembler->setCache(cache);
+    assembler->setIncludeCache(includeCache);
+    assembler->setStatsEnabled(cli.hasLongOption("stats"));
     
     size_t defSymsNum = 0;
     const char* const* defSyms = nullptr;
@@ -162,6 +221,14 @@ try
     
     for (size_t i = 0; i < includePathsNum; i++)
         assembler->addIncludeDir(includePaths[i]);
+    if (cli.hasLongOption("macroLib"))
+    {
+        size_t macroLibsNum = 0;
+        const char* const* macroLibs = cli.getLongOptArgArray<const char*>(
+                    "macroLib", macroLibsNum);
+        for (size_t i = 0; i < macroLibsNum; i++)
+            assembler->addMacroLibrary(macroLibs[i]);
+    }
     for (size_t i = 0; i < defSymsNum; i++)
     {
         const char* eqPlace = ::strchr(defSyms[i], '=');
@@ -179,7 +246,7 @@ try
             { value = cstrtovCStyle<uint64_t>(eqPlace, nullptr, outEnd); }
             catch(const ParseException& ex)
             {
-                std::cerr << "For symbol '" << symName << "': " << ex.what() << std::endl;
+                msgStream << "For symbol '" << symName << "': " << ex.what() << std::endl;
                 ret = 1;
                 parsed = false;
             }
@@ -190,7 +257,7 @@ try
                 while (isSpace(*outEnd)) outEnd++;
                 if (*outEnd!=0)
                 {
-                    std::cerr << "Garbages at symbol '" << symName <<
+                    msgStream << "Garbages at symbol '" << symName <<
                                     "' value" << std::endl;
                     ret = 1;
                 }
@@ -202,7 +269,7 @@ try
             assembler->addInitialDefSym(symName, value);
         else
         {
-            std::cerr << "Invalid symbol name '" << symName << "'" << std::endl;
+            msgStream << "Invalid symbol name '" << symName << "'" << std::endl;
             ret = 1;
         }
     }
@@ -210,14 +277,218 @@ try
     if (ret!=0)
         return ret;
     /// run assembling
-    if (!assembler->assemble())
-        return 1;
-    /// write output to file
-    const char* outputName = "a.out";
-    if (cli.hasShortOption('o'))
-        outputName = cli.getShortOptArg<const char*>('o');
-    assembler->writeBinary(outputName);
-    return 0;
+    const bool good = assembler->assemble();
+    if (cli.hasShortOption('v'))
+    {
+        const AsmIncludeSearchStats& stats = assembler->getIncludeSearchStats();
+        msgStream << "Include search: " << stats.probesNum << " probes, " <<
+                stats.skippedProbesNum << " probes skipped by directory listings, " <<
+                stats.listingsNum << " directories listed" << std::endl;
+    }
+    if (good && cli.hasLongOption("writeMacroLib"))
+        assembler->writeMacroLibrary(cli.getLongOptArg<const char*>("writeMacroLib"));
+    // if macro library is written, then binary is written only if output is given
+    if (good && (!cli.hasLongOption("writeMacroLib") || cli.hasShortOption('o')))
+    {
+        /// write output to file
+        const char* outputName = "a.out";
+        if (cli.hasShortOption('o'))
+            outputName = cli.getShortOptArg<const char*>('o');
+        assembler->writeBinary(outputName);
+    }
+    // statistics are printed after writing binary (includes binary generation)
+    if (cli.hasLongOption("stats"))
+        printAssemblerStats(assembler->getStats(), msgStream);
+    return good ? 0 : 1;
+}
+
+/* batch mode */
+
+struct BatchJob
+{
+    size_t lineNo;  // line in manifest
+    std::vector<std::string> args;  // arguments (first is program name)
+    std::string messages;   // collected diagnostics
+    std::string printed;    // collected output from .print
+    int ret;
+};
+
+// split manifest line to words (words can be quoted by '"')
+static void splitManifestLine(const std::string& line, std::vector<std::string>& words)
+{
+    const char* p = line.c_str();
+    while (true)
+    {
+        while (isSpace(*p)) p++;
+        if (*p == 0 || *p == '#')
+            break; // end of line or comment
+        std::string word;
+        while (*p != 0 && !isSpace(*p))
+            if (*p == '"')
+            {
+                // quoted part of word
+                for (p++; *p != 0 && *p != '"'; p++)
+                    word += *p;
+                if (*p == 0)
+                    throw Exception("Unterminated quoted string");
+                p++;
+            }
+            else
+                word += *p++;
+        words.push_back(word);
+    }
+}
+
+// caches of included files are not thread-safe, hence every running job takes own cache
+class IncludeCachePool
+{
+private:
+    std::mutex mutex;
+    std::vector<std::unique_ptr<AsmIncludeCache> > caches;
+    const AsmCache* persistentCache;
+public:
+    explicit IncludeCachePool(const AsmCache* _persistentCache)
+            : persistentCache(_persistentCache)
+    { }
+    
+    std::unique_ptr<AsmIncludeCache> acquire()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (caches.empty())
+            return std::unique_ptr<AsmIncludeCache>(
+                        new AsmIncludeCache(8, persistentCache));
+        std::unique_ptr<AsmIncludeCache> cache = std::move(caches.back());
+        caches.pop_back();
+        return cache;
+    }
+    void release(std::unique_ptr<AsmIncludeCache>&& cache)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        caches.push_back(std::move(cache));
+    }
+};
+
+static void runBatchJob(BatchJob& job, AsmCache* cache, IncludeCachePool* includeCaches)
+{
+    std::ostringstream msgStream;
+    std::ostringstream printStream;
+    job.ret = 1;
+    try
+    {
+        std::vector<const char*> argv(job.args.size()+1);
+        for (size_t i = 0; i < job.args.size(); i++)
+            argv[i] = job.args[i].c_str();
+        argv[job.args.size()] = nullptr;
+        CLIParser cli("clrxasm", programOptions, job.args.size(), argv.data());
+        cli.parse();
+        if (cli.hasLongOption("batch") || cli.hasShortOption('j') ||
+            cli.hasLongOption("cacheDir") || cli.hasLongOption("cacheSize") ||
+            cli.hasLongOption("includeCache"))
+            throw Exception("Batch options in batch job");
+        if (includeCaches != nullptr)
+        {
+            std::unique_ptr<AsmIncludeCache> includeCache = includeCaches->acquire();
+            try
+            {
+                job.ret = assembleFromCLI(cli, true, cache, includeCache.get(),
+                            msgStream, printStream);
+            }
+            catch(...)
+            {
+                includeCaches->release(std::move(includeCache));
+                throw;
+            }
+            includeCaches->release(std::move(includeCache));
+        }
+        else
+            job.ret = assembleFromCLI(cli, true, cache, nullptr, msgStream, printStream);
+    }
+    catch(const Exception& ex)
+    { msgStream << ex.what() << std::endl; }
+    catch(const std::bad_alloc&)
+    { msgStream << "Out of memory" << std::endl; }
+    catch(const std::exception& ex)
+    { msgStream << "System exception: " << ex.what() << std::endl; }
+    job.messages = msgStream.str();
+    job.printed = printStream.str();
+}
+
+// assemble all jobs from manifest, diagnostics are printed in order of jobs
+static int runBatch(const char* manifestName, cxuint jobsNum, AsmCache* cache,
+            IncludeCachePool* includeCaches)
+{
+    std::ifstream ifs(manifestName);
+    if (!ifs)
+        throw Exception("Can't open manifest file");
+    std::vector<BatchJob> jobs;
+    std::string line;
+    for (size_t lineNo = 1; std::getline(ifs, line); lineNo++)
+    {
+        BatchJob job{ lineNo, { "clrxasm" }, "", "", 0 };
+        try
+        { splitManifestLine(line, job.args); }
+        catch(const Exception& ex)
+        {
+            std::cerr << manifestName << ":" << lineNo << ": " << ex.what() << std::endl;
+            return 1;
+        }
+        if (job.args.size() > 1) // if not empty line
+            jobs.push_back(std::move(job));
+    }
+    
+    // every job has own assembler and own output streams, cache is shared
+    parallelFor(jobs.size(), jobsNum, [&jobs, cache, includeCaches](size_t i)
+    { runBatchJob(jobs[i], cache, includeCaches); });
+    
+    int ret = 0;
+    for (const BatchJob& job: jobs)
+    {
+        std::cout << job.printed;
+        std::cerr << job.messages;
+        if (job.ret != 0)
+        {
+            std::cerr << manifestName << ":" << job.lineNo << ": Job failed" << std::endl;
+            ret = 1;
+        }
+    }
+    std::cout.flush();
+    return ret;
+}
+
+int main(int argc, const char** argv)
+try
+{
+    CLIParser cli("clrxasm", programOptions, argc, argv);
+    cli.parse();
+    if (cli.handleHelpOrUsage())
+        return 0;
+    
+    std::unique_ptr<AsmCache> cache;
+    if (cli.hasLongOption("cacheDir"))
+    {
+        uint64_t cacheSize = 64;
+        if (cli.hasLongOption("cacheSize"))
+            cacheSize = cli.getLongOptArg<cxuint>("cacheSize");
+        cache.reset(new AsmCache(cli.getLongOptArg<const char*>("cacheDir"),
+                    cacheSize<<20));
+    }
+    
+    if (cli.hasLongOption("batch"))
+    {
+        if (cli.getArgsNum() != 0)
+            throw Exception("Input files can not be given in batch mode");
+        const cxuint jobsNum = cli.hasShortOption('j') ?
+                    cli.getShortOptArg<cxuint>('j') : 0;
+        IncludeCachePool includeCaches(cache.get());
+        return runBatch(cli.getLongOptArg<const char*>("batch"), jobsNum, cache.get(),
+                    cli.hasLongOption("includeCache") ? &includeCaches : nullptr);
+    }
+    std::unique_ptr<AsmIncludeCache> includeCache;
+    if (cli.hasLongOption("includeCache"))
+        // snapshots are stored in directory of cache (if given)
+        includeCache.reset(new AsmIncludeCache(8, cache.get()));
+    return assembleFromCLI(cli, false, cache.get(), includeCache.get(),
+                std::cerr, std::cout);
 }
 catch(const Exception& ex)
 {
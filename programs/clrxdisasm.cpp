@@ -54,6 +54,9 @@ static const CLIOption programOptions[] =
         "set LLVM version (for Gallium)", "VERSION" },
     { "buggyFPLit", 0, CLIArgType::NONE, false, false,
         "use old and buggy fplit rules", nullptr },
+    { "jobs", 'j', CLIArgType::UINT, false, false,
+        "set number of threads to disassemble kernels (0 - number of CPU threads)",
+        "JOBS" },
     CLRX_CLI_AUTOHELP
     { nullptr, 0 }
 };
@@ -100,6 +103,9 @@ try
     cxuint llvmVersion = 0;
     if (cli.hasLongOption("llvmVersion"))
         llvmVersion = cli.getLongOptArg<cxuint>("llvmVersion");
+    cxuint threadsNum = 1;
+    if (cli.hasShortOption('j'))
+        threadsNum = cli.getShortOptArg<cxuint>('j');
     
     int ret = 0;
     for (const char* const* args = cli.getArgs();*args != nullptr; args++)
@@ -134,6 +140,7 @@ try
                         AmdMainGPUBinary32* amdGpuBin =
                                 static_cast<AmdMainGPUBinary32*>(base.get());
                         Disassembler disasm(*amdGpuBin, std::cout, disasmFlags);
+                        disasm.setThreadsNum(threadsNum);
                         disasm.disassemble();
                     }
                     else if (base->getType() == AmdMainType::GPU_64_BINARY)
@@ -141,6 +148,7 @@ try
                         AmdMainGPUBinary64* amdGpuBin =
                                 static_cast<AmdMainGPUBinary64*>(base.get());
                         Disassembler disasm(*amdGpuBin, std::cout, disasmFlags);
+                        disasm.setThreadsNum(threadsNum);
                         disasm.disassemble();
                     }
                     else
@@ -160,6 +168,7 @@ try
                                 static_cast<AmdCL2MainGPUBinary32*>(base.get());
                         Disassembler disasm(*amdGpuBin, std::cout, disasmFlags,
                                             driverVersion);
+                        disasm.setThreadsNum(threadsNum);
                         disasm.disassemble();
                     }
                     else if (base->getType() == AmdMainType::GPU_CL2_64_BINARY)
@@ -168,6 +177,7 @@ try
                                 static_cast<AmdCL2MainGPUBinary64*>(base.get());
                         Disassembler disasm(*amdGpuBin, std::cout, disasmFlags,
                                             driverVersion);
+                        disasm.setThreadsNum(threadsNum);
                         disasm.disassemble();
                     }
                     else
@@ -2333,5 +2333,213 @@ aa2=6
             { "vectorAdd", 0U, 0, 0U, true, true, false, 0, 0 }
         }, true, "", ""
     },
+    /* 81 - include file (filtering lines of mapped file) */
+    {   R"ffDXD(            .include "inc4.s"
+            .byte 16)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA,
+            {
+                1, 2, 3, 4, 5, 6, 7, 'a', ';', '#', 9, 10, 11, 12, 13, 14, 15, 16
+            } } },
+        { { ".", 18U, 0, 0U, true, false, false, 0, 0 } },
+        false, "In file included from test.s:1:13:\n"
+        CLRX_SOURCE_DIR "/tests/amdasm/incdir0/inc4.s:13:25: "
+        "Error: Expected ',' before next value\n", "",
+        { CLRX_SOURCE_DIR "/tests/amdasm/incdir0" }
+    },
+    /* 82 - scoped symbols, local labels and redefined macro (interned names) */
+    {   R"ffDXD(            .scope sa
+            x = 3
+            .scope sb
+            y = x+1
+            .ends
+            .ends
+            .using sa
+            .byte x, sa::sb::y, ::sa::x
+            .macro mm a
+            .byte \a+1
+            .endm
+            mm 4
+            .purgem mm
+            .macro mm a
+            .byte \a+2
+            .endm
+            mm 4
+1:          .byte 2f-1b, 3
+2:          .byte 2b-1b
+1:          .byte 1b-2b
+            .byte 1b-2b)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA,
+            { 3, 4, 3, 5, 6, 2, 3, 2, 1, 1 } } },
+        {
+            { ".", 10U, 0, 0U, true, false, false, 0, 0 },
+            { "1b", 8U, 0, 0U, true, false, false, 0, 0 },
+            { "1f", 8U, 0, 0U, false, false, false, 0, 0 },
+            { "2b", 7U, 0, 0U, true, false, false, 0, 0 },
+            { "2f", 7U, 0, 0U, false, false, false, 0, 0 },
+            { "sa::sb::y", 4U, ASMSECT_ABS, 0U, true, false, false, 0, 0 },
+            { "sa::x", 3U, ASMSECT_ABS, 0U, true, false, false, 0, 0 }
+        }, true, "", ""
+    },
+    /* 83 - macro substitutions with compiled macro content */
+    {   R"ffDXD(            .macro putv a, b=2
+            .byte \a\()0, \b, \@
+            .byte \a+\
+\b, 7 ; .byte \a*2 \b:
+            .byte \zz
+            .endm
+            putv 1
+            putv 3, 5)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA,
+            { 10, 2, 0, 3, 7, 2, 0, 30, 5, 1, 8, 7, 6, 0 } } },
+        { { ".", 14U, 0, 0U, true, false, false, 0, 0 } },
+        false, "In macro substituted from test.s:7:13:\n"
+        "test.s:4:18: Error: Expected ',' before next value\n"
+        "In macro substituted from test.s:7:13:\n"
+        "test.s:4:19: Error: Garbages at end of line\n"
+        "In macro substituted from test.s:7:13:\n"
+        "test.s:5:19: Warning: No expression, zero has been put\n"
+        "In macro substituted from test.s:7:13:\n"
+        "test.s:5:19: Error: Expected ',' before next value\n"
+        "In macro substituted from test.s:7:13:\n"
+        "test.s:5:20: Error: Garbages at end of line\n"
+        "In macro substituted from test.s:8:13:\n"
+        "test.s:4:18: Error: Expected ',' before next value\n"
+        "In macro substituted from test.s:8:13:\n"
+        "test.s:4:19: Error: Garbages at end of line\n"
+        "In macro substituted from test.s:8:13:\n"
+        "test.s:5:19: Warning: No expression, zero has been put\n"
+        "In macro substituted from test.s:8:13:\n"
+        "test.s:5:19: Error: Expected ',' before next value\n"
+        "In macro substituted from test.s:8:13:\n"
+        "test.s:5:20: Error: Garbages at end of line\n", ""
+    },
+    /* 84 - repetitions with replicated output and fallback to interpretation */
+    {   R"ffDXD(            .rept 3
+            .byte 1, 2
+            .short 0x304
+            .endr
+            .for x = 0, x < 3, x+1
+            .byte 5
+            .endr
+            .rept 2
+            .byte .&0xff
+            .endr
+            .rept 2
+            .byte 0x1ff
+            .endr
+            cnt = 0
+            .rept 2
+            cnt = cnt+1
+            .byte cnt
+            .endr)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA,
+            { 1, 2, 4, 3, 1, 2, 4, 3, 1, 2, 4, 3, 5, 5, 5, 15, 16,
+              0xff, 0xff, 1, 2 } } },
+        {
+            { ".", 21U, 0, 0U, true, false, false, 0, 0 },
+            { "cnt", 2U, ASMSECT_ABS, 0U, true, false, false, 0, 0 },
+            { "x", 3U, ASMSECT_ABS, 0U, true, false, false, 0, 0 }
+        }, true, "In repetition 1/2:\n"
+        "test.s:12:19: Warning: Value 0x1ff truncated to 0xff\n"
+        "In repetition 2/2:\n"
+        "test.s:12:19: Warning: Value 0x1ff truncated to 0xff\n", ""
+    },
+    /* 85 - pseudo-op names (main and format pseudo-ops, macros and errors) */
+    {   R"ffDXD(            .macro config
+            .byte 4
+            .endm
+            .macro setupargs
+            .byte 5
+            .endm
+            .macro exactpos
+            .byte 6
+            .endm
+            .BYTE 1
+            exactpos
+            .call_convention 0
+            .setupargs
+            .xyzpseudo
+            .)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA, { 1, 6 } } },
+        { { ".", 2U, 0, 0U, true, false, false, 0, 0 } }, false,
+        "test.s:12:13: Error: Gallium pseudo-op can be defined only in "
+        "Gallium format code\n"
+        "test.s:13:13: Error: AMDCL2 pseudo-op can be defined only in "
+        "AMDCL2 format code\n"
+        "test.s:14:13: Error: This is neither pseudo-op and nor macro\n"
+        "test.s:15:13: Error: Unknown instruction\n", ""
+    },
+    /* 86 - repetitions with local labels (not replicated) */
+    {   R"ffDXD(            .rept 2
+            .byte 1, 2, 3
+1:          .byte 1b-.
+            .endr
+            y = 0
+            .while y < 3
+1:          .byte .-1b
+            y = y+1
+            .endr)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA,
+            { 1, 2, 3, 0, 1, 2, 3, 0, 0, 0, 0 } } },
+        {
+            { ".", 11U, 0, 0U, true, false, false, 0, 0 },
+            { "1b", 10U, 0, 0U, true, false, false, 0, 0 },
+            { "1f", 10U, 0, 0U, false, false, false, 0, 0 },
+            { "y", 3U, ASMSECT_ABS, 0U, true, false, false, 0, 0 }
+        }, true, "", ""
+    },
+    /* 87 - expression waiting for symbol from closed temporary scope */
+    {   R"ffDXD(            .scope
+            .byte x+::y, ::y
+            .ends
+            y = 5)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA, { 0, 5 } } },
+        {
+            { ".", 2U, 0, 0U, true, false, false, 0, 0 },
+            { "y", 5U, ASMSECT_ABS, 0U, true, false, false, 0, 0 }
+        }, false, "test.s:2:19: Error: Expression has unresolved symbol "
+            "from closed scope\n", ""
+    },
+    /* 88 - removing macros and temporary scopes from name-indexed maps */
+    {   R"ffDXD(            .macro m1
+            .byte 1
+            .endm
+            .macro m2
+            .byte 2
+            .endm
+            .macro m3
+            .byte 3
+            .endm
+            .purgem m2
+            m1
+            m3
+            .scope
+            x = 4
+            .byte x
+            .ends
+            .scope
+            x = 5
+            .byte x
+            .ends
+            .macro m2
+            .byte 6
+            .endm
+            m2
+            .purgem m1
+            .purgem m3
+            m2)ffDXD",
+        BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, false, { },
+        { { nullptr, ASMKERN_GLOBAL, AsmSectionType::DATA, { 1, 3, 4, 5, 6, 6 } } },
+        {
+            { ".", 6U, 0, 0U, true, false, false, 0, 0 }
+        }, true, "", ""
+    },
     { nullptr }
 };
@@ -0,0 +1,143 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/AsmCache.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+#include "AsmTestUtils.h"
+
+using namespace CLRX;
+
+static const char* testDir = "asmcache-test";
+
+static size_t countCacheEntries(const AsmCache& cache)
+{
+    size_t count = 0;
+    for (const std::string& name: listDirectory(cache.getDirectory().c_str()))
+        if (name.size() > 6 && name.compare(name.size()-6, 6, ".cache") == 0)
+            count++;
+    return count;
+}
+
+static AsmResult assembleWithCache(AsmCache& cache, const char* source)
+{
+    const std::string filename = (source != nullptr) ? "stdin" :
+            joinPaths(testDir, "main.s");
+    return assembleSource(filename.c_str(), source, BinaryFormat::AMD,
+            [&cache](Assembler& assembler)
+            {
+                assembler.setDriverVersion(191205);
+                assembler.addIncludeDir(joinPaths(testDir, "incdir").c_str());
+                assembler.setCache(&cache);
+            });
+}
+
+static void assertSameResult(const char* caseName, const AsmResult& expected,
+            const AsmResult& result)
+{
+    assertTrue("AsmCache", std::string(caseName)+".good", result.good);
+    assertString("AsmCache", std::string(caseName)+".messages",
+                 expected.messages.c_str(), result.messages);
+    assertString("AsmCache", std::string(caseName)+".printed",
+                 expected.printed.c_str(), result.printed);
+    assertTrue("AsmCache", std::string(caseName)+".binary",
+               isSameBinary(expected, result));
+}
+
+static const char* mainSource = R"ffDXD(.kernel aaa
+    .config
+        .dims x
+    .text
+aaa:
+    .include "inc.s"
+    .include "inc2.s"
+    s_endpgm
+    .byte 300
+)ffDXD";
+
+static void testAsmCache()
+{
+    prepareDir(testDir);
+    prepareDir(joinPaths(testDir, "incdir"));
+    prepareDir(joinPaths(testDir, "cache"));
+    std::remove("inc2.s");
+    writeFile(joinPaths(testDir, "main.s"), mainSource);
+    writeFile(joinPaths(testDir, "incdir/inc.s"),
+              "    .print \"inc.s included\"\n    s_mov_b32 s1, s2\n");
+    writeFile(joinPaths(testDir, "incdir/inc2.s"), "    v_mov_b32 v1, v2\n");
+
+    AsmCache cache(joinPaths(testDir, "cache").c_str());
+    // first assembling: cache miss
+    AsmResult first = assembleWithCache(cache, nullptr);
+    assertTrue("AsmCache", "first.good", first.good);
+    assertTrue("AsmCache", "first.miss", !first.cacheHit);
+    assertTrue("AsmCache", "first.printed", first.printed == "inc.s included\n");
+    assertTrue("AsmCache", "first.warning",
+               first.messages.find("Warning") != std::string::npos);
+    assertValue("AsmCache", "entries", size_t(1), countCacheEntries(cache));
+    // second assembling: cache hit with this same result
+    AsmResult second = assembleWithCache(cache, nullptr);
+    assertTrue("AsmCache", "second.hit", second.cacheHit);
+    assertSameResult("second", first, second);
+
+    // changed include file
+    writeFile(joinPaths(testDir, "incdir/inc.s"),
+              "    .print \"inc.s included\"\n    s_mov_b32 s1, s3\n");
+    AsmResult third = assembleWithCache(cache, nullptr);
+    assertTrue("AsmCache", "third.good", third.good);
+    assertTrue("AsmCache", "third.miss", !third.cacheHit);
+    assertTrue("AsmCache", "third.binary", !isSameBinary(first, third));
+    AsmResult fourth = assembleWithCache(cache, nullptr);
+    assertTrue("AsmCache", "fourth.hit", fourth.cacheHit);
+    assertSameResult("fourth", third, fourth);
+
+    // new file in place of failed probe (current directory) must be used
+    writeFile("inc2.s", "    v_mov_b32 v1, v3\n");
+    AsmResult fifth = assembleWithCache(cache, nullptr);
+    std::remove("inc2.s");
+    assertTrue("AsmCache", "fifth.miss", !fifth.cacheHit);
+
+    // input from stream: content is in key
+    AsmResult streamFirst = assembleWithCache(cache, mainSource);
+    assertTrue("AsmCache", "streamFirst.miss", !streamFirst.cacheHit);
+    AsmResult streamSecond = assembleWithCache(cache, mainSource);
+    assertTrue("AsmCache", "streamSecond.hit", streamSecond.cacheHit);
+    assertSameResult("streamSecond", streamFirst, streamSecond);
+    const std::string otherSource = std::string(mainSource) + "    s_endpgm\n";
+    AsmResult streamThird = assembleWithCache(cache, otherSource.c_str());
+    assertTrue("AsmCache", "streamThird.miss", !streamThird.cacheHit);
+
+    // least recently used entries are removed
+    AsmCache smallCache(joinPaths(testDir, "cache").c_str(), 0);
+    smallCache.evict();
+    assertValue("AsmCache", "evicted", size_t(0), countCacheEntries(smallCache));
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testAsmCache);
+    return retVal;
+}
@@ -22,6 +22,8 @@
 #include <string>
 #include <cstring>
 #include <sstream>
+#include <chrono>
+#include <vector>
 #include <CLRX/amdasm/Assembler.h>
 #include "../TestUtils.h"
 
@@ -483,8 +485,9 @@ static std::string rpnExpression(const AsmExpression* expr)
     std::ostringstream oss;
     const AsmExprArg* args = expr->getArgs();
     bool first = true;
-    for (AsmExprOp op: expr->getOps())
+    for (size_t i = 0; i < expr->getOpsNum(); i++)
     {
+        const AsmExprOp op = expr->getOps()[i];
         if (!first)
             oss << ' ';
         first = false;
@@ -675,6 +678,56 @@ static void testFastExprEval(cxuint i, const FastExprEvalCase& testCase)
     assertString(testName, "extra", testCase.extra, resExtra);
 }
 
+/* micro-benchmark: counts evaluations per second of all evaluable expressions
+ * from parse test cases (run only with '--bench' option, not by ctest) */
+static void benchAsmExprEval()
+{
+    std::vector<cxuint> caseIndices;
+    std::vector<std::unique_ptr<MyAssembler> > assemblers;
+    std::vector<std::unique_ptr<AsmExpression> > exprs;
+    std::istringstream emptyIss;
+    std::ostringstream errorsOut;
+    const cxuint casesNum = sizeof(asmExprParseCases)/sizeof(AsmExprParseCase);
+    for (cxuint i = 0; i < casesNum; i++)
+    {
+        const AsmExprParseCase& testCase = asmExprParseCases[i];
+        if (!testCase.evaluated || testCase.errors[0] != 0)
+            continue;
+        std::istringstream iss(testCase.expression);
+        std::unique_ptr<MyAssembler> assembler(new MyAssembler(iss, errorsOut));
+        size_t linePos = 0;
+        std::unique_ptr<AsmExpression> expr(AsmExpression::parse(
+                    *assembler, linePos, false));
+        if (!expr || expr->getSymOccursNum() != 0)
+            continue;
+        caseIndices.push_back(i);
+        assemblers.push_back(std::move(assembler));
+        exprs.push_back(std::move(expr));
+    }
+    
+    const size_t roundsNum = 20000;
+    uint64_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < roundsNum; r++)
+        for (size_t i = 0; i < exprs.size(); i++)
+        {
+            uint64_t value = 0;
+            cxuint sectionId;
+            exprs[i]->evaluate(*assemblers[i], value, sectionId);
+            checksum += value;
+        }
+    const double seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+    
+    uint64_t expectedSum = 0;
+    for (cxuint i: caseIndices)
+        expectedSum += asmExprParseCases[i].value;
+    std::cout << "Expressions: " << exprs.size() << "\n"
+            "Evaluations per second: " << uint64_t(roundsNum*exprs.size() /
+                std::max(seconds, 1e-9)) << std::endl;
+    assertValue("AsmExprEvalBench", "checksum", expectedSum*roundsNum, checksum);
+}
+
 int main(int argc, const char** argv)
 {
     int retVal = 0;
@@ -705,5 +758,7 @@ int main(int argc, const char** argv)
             retVal = 1;
         }
     
+    if (argc >= 2 && ::strcmp(argv[1], "--bench") == 0)
+        retVal |= callTest(benchAsmExprEval);
     return retVal;
 }
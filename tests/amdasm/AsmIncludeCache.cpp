@@ -0,0 +1,187 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/AsmCache.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+#include "AsmTestUtils.h"
+
+using namespace CLRX;
+
+static const char* testDir = "asmincache-test";
+
+static AsmResult assembleWithIncludeCache(AsmIncludeCache* includeCache,
+            const char* source, const char* defSym)
+{
+    return assembleSource("main.s", source, BinaryFormat::RAWCODE,
+            [includeCache, defSym](Assembler& assembler)
+            {
+                assembler.addIncludeDir(testDir);
+                if (defSym != nullptr)
+                    assembler.addInitialDefSym(defSym, 1);
+                assembler.setIncludeCache(includeCache);
+            });
+}
+
+// compare result with cache with result of assembling without cache
+static void checkResult(const char* caseName, AsmIncludeCache& includeCache,
+            const char* source, const char* defSym = nullptr)
+{
+    const AsmResult expected = assembleWithIncludeCache(nullptr, source, defSym);
+    const AsmResult result = assembleWithIncludeCache(&includeCache, source, defSym);
+    assertTrue("AsmIncludeCache", std::string(caseName)+".good",
+               expected.good == result.good);
+    assertString("AsmIncludeCache", std::string(caseName)+".messages",
+                 expected.messages.c_str(), result.messages);
+    assertTrue("AsmIncludeCache", std::string(caseName)+".binary",
+               isSameBinary(expected, result));
+}
+
+static const char* libSource = R"ffDXD(.ifndef LIBVERSION
+    .set LIBVERSION, 2
+.endif
+.set LIBBASE, 100 + LIBVERSION
+.macro putsum a, b
+    .int \a + \b + LIBBASE
+.endm
+.macro putbad
+    .int undefsym(
+.endm
+.rept 3
+    .set LIBCOUNT, LIBCOUNT2 + 1
+    .set LIBCOUNT2, LIBCOUNT
+.endr
+.include "lib2.s"
+)ffDXD";
+
+static const char* mainSource = R"ffDXD(.set LIBCOUNT2, 0
+.include "lib.s"
+    putsum 1, 2
+    putsum LIBCOUNT, LIB2VALUE
+)ffDXD";
+
+static const char* mainSource2 = R"ffDXD(.set LIBCOUNT2, 0
+
+.include "lib.s"
+    putsum 4, 5
+    putbad
+)ffDXD";
+
+static void testAsmIncludeCache()
+{
+    if (!isFileExists(testDir))
+        makeDir(testDir);
+    writeFile(joinPaths(testDir, "lib.s"), libSource);
+    writeFile(joinPaths(testDir, "lib2.s"), ".macro putlib2\n.endm\n"
+            ".set LIB2VALUE, 7\n");
+    
+    AsmIncludeCache includeCache;
+    // first assembling: snapshots of both files are stored
+    checkResult("first", includeCache, mainSource);
+    assertValue("AsmIncludeCache", "first.hits", size_t(0), includeCache.getHitsNum());
+    assertValue("AsmIncludeCache", "first.stores", size_t(2), includeCache.getStoresNum());
+    // next assembling: snapshot of lib.s is replayed
+    checkResult("second", includeCache, mainSource);
+    assertValue("AsmIncludeCache", "second.hits", size_t(1), includeCache.getHitsNum());
+    // other place of inclusion: messages from macros points to new place
+    checkResult("third", includeCache, mainSource2);
+    assertValue("AsmIncludeCache", "third.hits", size_t(2), includeCache.getHitsNum());
+    
+    // other incoming state: file is assembled again
+    const size_t storesNum = includeCache.getStoresNum();
+    checkResult("defsym", includeCache, mainSource, "LIBVERSION");
+    assertValue("AsmIncludeCache", "defsym.hits", size_t(3), includeCache.getHitsNum());
+    assertValue("AsmIncludeCache", "defsym.stores", storesNum+1,
+                includeCache.getStoresNum());
+    checkResult("defsym2", includeCache, mainSource, "LIBVERSION");
+    assertValue("AsmIncludeCache", "defsym2.hits", size_t(4), includeCache.getHitsNum());
+    
+    // changed nested file: file is assembled again
+    writeFile(joinPaths(testDir, "lib2.s"), ".set LIB2VALUE, 8\n");
+    checkResult("changed", includeCache, mainSource);
+    assertValue("AsmIncludeCache", "changed.hits", size_t(4), includeCache.getHitsNum());
+    
+    // file that puts data can not be replayed
+    writeFile(joinPaths(testDir, "lib2.s"), ".set LIB2VALUE, 8\n.byte 1\n");
+    const size_t storesNum2 = includeCache.getStoresNum();
+    checkResult("data", includeCache, mainSource);
+    checkResult("data2", includeCache, mainSource);
+    assertValue("AsmIncludeCache", "data.hits", size_t(4), includeCache.getHitsNum());
+    assertValue("AsmIncludeCache", "data.stores", storesNum2,
+                includeCache.getStoresNum());
+}
+
+static const char* mainMacroSource = R"ffDXD(.macro defvalue name
+    .set \name, 5
+.endm
+.include "usemacro.s"
+    .int USEMACROVALUE
+)ffDXD";
+
+static void testPersistentIncludeCache()
+{
+    const std::string cacheDir = joinPaths(testDir, "cache");
+    prepareDir(cacheDir);
+    writeFile(joinPaths(testDir, "lib.s"), libSource);
+    writeFile(joinPaths(testDir, "lib2.s"), ".macro putlib2\n.endm\n"
+            ".set LIB2VALUE, 7\n");
+    writeFile(joinPaths(testDir, "usemacro.s"), "defvalue USEMACROVALUE\n");
+    AsmCache cache(cacheDir.c_str());
+    {
+        AsmIncludeCache includeCache(8, &cache);
+        checkResult("persistFirst", includeCache, mainSource);
+        checkResult("persistMacroFirst", includeCache, mainMacroSource);
+        assertValue("AsmIncludeCache", "persistFirst.stores", size_t(3),
+                    includeCache.getStoresNum());
+    }
+    // new cache (as in other process) replays snapshots stored in directory
+    AsmIncludeCache includeCache(8, &cache);
+    checkResult("persistSecond", includeCache, mainSource);
+    assertValue("AsmIncludeCache", "persistSecond.hits", size_t(1),
+                includeCache.getHitsNum());
+    // macros from stored snapshot points to new place of inclusion
+    checkResult("persistThird", includeCache, mainSource2);
+    assertValue("AsmIncludeCache", "persistThird.hits", size_t(2),
+                includeCache.getHitsNum());
+    // snapshot that uses macro defined outside file is not stored
+    checkResult("persistMacroSecond", includeCache, mainMacroSource);
+    assertValue("AsmIncludeCache", "persistMacroSecond.hits", size_t(2),
+                includeCache.getHitsNum());
+    
+    // changed file: only stored snapshot of unchanged nested file is used
+    writeFile(joinPaths(testDir, "lib.s"), (std::string(libSource) +
+                ".set LIBEXTRA, 1\n").c_str());
+    AsmIncludeCache includeCache2(8, &cache);
+    checkResult("persistChanged", includeCache2, mainSource);
+    assertValue("AsmIncludeCache", "persistChanged.hits", size_t(1),
+                includeCache2.getHitsNum());
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testAsmIncludeCache);
+    retVal |= callTest(testPersistentIncludeCache);
+    return retVal;
+}
@@ -0,0 +1,130 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/AsmCache.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+#include "AsmTestUtils.h"
+
+using namespace CLRX;
+
+static const char* testDir = "asmincdir-test";
+
+static void testMayContain()
+{
+    const std::string dir1 = joinPaths(testDir, "dir1");
+    prepareDir(dir1);
+    writeFile(joinPaths(dir1, "a.s"), "");
+    AsmIncludeDirCache dirCache;
+    bool listed;
+    assertTrue("AsmIncludeDirCache", "a.s", dirCache.mayContain(dir1, "a.s", true, listed));
+    assertTrue("AsmIncludeDirCache", "a.s.listed", listed);
+    assertTrue("AsmIncludeDirCache", "b.s",
+               !dirCache.mayContain(dir1, "b.s", false, listed));
+    assertTrue("AsmIncludeDirCache", "b.s.listed", !listed);
+    // first component of path is checked
+    assertTrue("AsmIncludeDirCache", "sub/b.s",
+               !dirCache.mayContain(dir1, joinPaths("sub", "b.s"), false, listed));
+    // absolute paths are not checked
+    assertTrue("AsmIncludeDirCache", "absolute",
+               dirCache.mayContain(dir1, CLRX_NATIVE_DIR_SEP_S "b.s", false, listed));
+    // not existing directory has no files
+    assertTrue("AsmIncludeDirCache", "nodir",
+               !dirCache.mayContain(joinPaths(testDir, "nodir"), "a.s", true, listed));
+    assertValue("AsmIncludeDirCache", "listingsNum", size_t(2),
+                dirCache.getListingsNum());
+
+    // directory modified just now: listing is read again while revalidation
+    writeFile(joinPaths(dir1, "b.s"), "");
+    assertTrue("AsmIncludeDirCache", "b.s.new",
+               dirCache.mayContain(dir1, "b.s", true, listed));
+    assertTrue("AsmIncludeDirCache", "b.s.new.listed", listed);
+    assertValue("AsmIncludeDirCache", "listingsNum2", size_t(3),
+                dirCache.getListingsNum());
+}
+
+static const char* mainSource = R"ffDXD(.rawcode
+    .include "inc.s"
+    .include "inc.s"
+    .incbin "data.bin"
+    .include "missing.s"
+)ffDXD";
+
+static void testAssemblerSearch()
+{
+    const std::string dirs[3] = { joinPaths(testDir, "inc1"), joinPaths(testDir, "inc2"),
+            joinPaths(testDir, "inc3") };
+    for (const std::string& dir: dirs)
+        prepareDir(dir);
+    writeFile(joinPaths(dirs[1], "inc.s"), ".int 1\n");
+    writeFile(joinPaths(dirs[2], "inc.s"), ".int 2\n");
+    writeFile(joinPaths(dirs[2], "data.bin"), "abcd");
+
+    AsmIncludeDirCache dirCache;
+    std::string expectedMessages;
+    Array<cxbyte> expectedBinary;
+    for (cxuint pass = 0; pass < 3; pass++)
+    {
+        std::ostringstream msgStream;
+        std::istringstream input(mainSource);
+        Assembler assembler("main.s", input, ASM_WARNINGS, BinaryFormat::RAWCODE,
+                    GPUDeviceType::PITCAIRN, msgStream);
+        for (const std::string& dir: dirs)
+            assembler.addIncludeDir(dir.c_str());
+        // first pass without listings
+        assembler.setIncludeDirCache(pass != 0 ? &dirCache : nullptr);
+        assertTrue("AsmIncludeDirCache", "good", !assembler.assemble());
+        const AsmIncludeSearchStats& stats = assembler.getIncludeSearchStats();
+        Array<cxbyte> binary(assembler.getSections()[0].content.begin(),
+                    assembler.getSections()[0].content.end());
+        if (pass == 0)
+        {
+            expectedMessages = msgStream.str();
+            expectedBinary = binary;
+            // every directory is probed
+            assertValue("AsmIncludeDirCache", "probesNum0", size_t(14), stats.probesNum);
+            assertValue("AsmIncludeDirCache", "skippedNum0", size_t(0),
+                        stats.skippedProbesNum);
+            continue;
+        }
+        assertString("AsmIncludeDirCache", "messages", expectedMessages.c_str(),
+                     msgStream.str());
+        assertTrue("AsmIncludeDirCache", "binary", expectedBinary.size() == binary.size() &&
+                std::equal(binary.begin(), binary.end(), expectedBinary.begin()));
+        // only current directory and directories holding files are probed
+        assertValue("AsmIncludeDirCache", "probesNum", size_t(7), stats.probesNum);
+        assertValue("AsmIncludeDirCache", "skippedNum", size_t(7), stats.skippedProbesNum);
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    if (!isFileExists(testDir))
+        makeDir(testDir);
+    retVal |= callTest(testMayContain);
+    retVal |= callTest(testAssemblerSearch);
+    return retVal;
+}
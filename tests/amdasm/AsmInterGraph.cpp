@@ -0,0 +1,166 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <utility>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+static void testInterGraph(size_t nodesNum, size_t edgesNum, size_t cliquesNum)
+{
+    std::ostringstream oss;
+    oss << "graph(" << nodesNum << "," << edgesNum << "," << cliquesNum << ")";
+    const std::string testName = oss.str();
+    
+    uint64_t seed = 0x9e3779b97f4a7c15ULL ^ nodesNum;
+    auto random = [&seed](size_t n)
+    {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        return size_t(seed>>33) % n;
+    };
+    
+    AsmInterGraph graph;
+    graph.reset(nodesNum);
+    std::vector<std::set<size_t> > expected(nodesNum);
+    for (size_t i = 0; i < edgesNum; i++)
+    {
+        const size_t a = random(nodesNum);
+        const size_t b = random(nodesNum);
+        graph.addEdge(a, b);
+        if (a != b)
+        {
+            expected[a].insert(b);
+            expected[b].insert(a);
+        }
+    }
+    for (size_t i = 0; i < cliquesNum; i++)
+    {
+        std::vector<size_t> clique;
+        const size_t cliqueSize = random(12);
+        for (size_t j = 0; j < cliqueSize; j++)
+            clique.push_back(random(nodesNum));
+        std::sort(clique.begin(), clique.end());
+        clique.resize(std::unique(clique.begin(), clique.end()) - clique.begin());
+        for (size_t a: clique)
+            for (size_t b: clique)
+                if (a != b)
+                {
+                    graph.addEdge(a, b);
+                    expected[a].insert(b);
+                }
+    }
+    graph.finish();
+    
+    assertValue("AsmInterGraph", testName+".size", nodesNum, graph.size());
+    assertTrue("AsmInterGraph", testName+".dense",
+               graph.isDense() == (nodesNum <= AsmInterGraph::maxDenseNodesNum));
+    for (size_t node = 0; node < nodesNum; node++)
+    {
+        std::ostringstream nodeOss;
+        nodeOss << testName << ".node" << node;
+        const std::string nodeName = nodeOss.str();
+        assertValue("AsmInterGraph", nodeName+".degree", expected[node].size(),
+                    graph.getDegree(node));
+        std::vector<size_t> neighbours;
+        graph.forEachNeighbour(node, [&neighbours](size_t nb)
+                { neighbours.push_back(nb); });
+        assertTrue("AsmInterGraph", nodeName+".neighbours",
+                   neighbours == std::vector<size_t>(expected[node].begin(),
+                            expected[node].end()));
+        for (size_t k = 0; k < 8; k++)
+        {
+            const size_t other = random(nodesNum);
+            assertTrue("AsmInterGraph", nodeName+".adjacent",
+                    graph.isAdjacent(node, other) == (expected[node].count(other)!=0));
+        }
+        for (size_t nb: expected[node])
+            assertTrue("AsmInterGraph", nodeName+".adjacent2",
+                       graph.isAdjacent(nb, node));
+    }
+}
+
+static void testBuildFromIntervals(size_t nodesNum, size_t intervalsNum, size_t maxLength)
+{
+    std::ostringstream oss;
+    oss << "intervals(" << nodesNum << "," << intervalsNum << "," << maxLength << ")";
+    const std::string testName = oss.str();
+    
+    uint64_t seed = 0x2545f4914f6cdd1dULL ^ intervalsNum;
+    auto random = [&seed](size_t n)
+    {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        return size_t(seed>>33) % n;
+    };
+    std::vector<AsmLiveInterval> intervals;
+    for (size_t i = 0; i < intervalsNum; i++)
+    {
+        const size_t start = random(intervalsNum*4);
+        intervals.push_back({ start, start + random(maxLength), random(nodesNum) });
+    }
+    // brute force: variables interfere if their intervals overlap
+    std::vector<std::set<size_t> > expected(nodesNum);
+    for (const AsmLiveInterval& a: intervals)
+        for (const AsmLiveInterval& b: intervals)
+            if (a.vidx != b.vidx && a.start < a.end && b.start < b.end &&
+                a.start < b.end && b.start < a.end)
+                expected[a.vidx].insert(b.vidx);
+    
+    AsmInterGraph graph;
+    graph.build(nodesNum, intervals);
+    assertValue("AsmInterGraph", testName+".size", nodesNum, graph.size());
+    for (size_t node = 0; node < nodesNum; node++)
+    {
+        std::ostringstream nodeOss;
+        nodeOss << testName << ".node" << node;
+        const std::string nodeName = nodeOss.str();
+        assertValue("AsmInterGraph", nodeName+".degree", expected[node].size(),
+                    graph.getDegree(node));
+        std::vector<size_t> neighbours;
+        graph.forEachNeighbour(node, [&neighbours](size_t nb)
+                { neighbours.push_back(nb); });
+        assertTrue("AsmInterGraph", nodeName+".neighbours",
+                   neighbours == std::vector<size_t>(expected[node].begin(),
+                            expected[node].end()));
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testInterGraph, 0, 0, 0);
+    retVal |= callTest(testInterGraph, 1, 4, 0);
+    retVal |= callTest(testInterGraph, 70, 300, 20);
+    retVal |= callTest(testInterGraph, 200, 0, 100);
+    retVal |= callTest(testInterGraph, 1000, 20000, 500);
+    retVal |= callTest(testInterGraph, size_t(AsmInterGraph::maxDenseNodesNum), 5000, 500);
+    retVal |= callTest(testInterGraph, 5000, 30000, 1000);
+    retVal |= callTest(testBuildFromIntervals, 0, 0, 1);
+    retVal |= callTest(testBuildFromIntervals, 10, 40, 8);
+    retVal |= callTest(testBuildFromIntervals, 300, 1000, 20);
+    retVal |= callTest(testBuildFromIntervals, 3000, 4000, 30);
+    return retVal;
+}
@@ -0,0 +1,169 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+static void testSimple()
+{
+    AsmLinearScan linearScan;
+    Array<cxuint> regMap;
+    linearScan.reset(6);
+    linearScan.addInterval({ 0, 10, 0 });
+    linearScan.addInterval({ 2, 5, 1 });
+    linearScan.addInterval({ 5, 8, 2 });
+    linearScan.addInterval({ 6, 12, 3 });
+    // variable 4 is used in two places (its range is from 1 to 14)
+    linearScan.addInterval({ 1, 2, 4 });
+    linearScan.addInterval({ 13, 14, 4 });
+    // variable 5 is never live
+    assertValue("AsmLinearScan", "simple.regsNum", cxuint(4),
+                linearScan.allocate(10, regMap));
+    const cxuint expected[6] = { 0, 2, 2, 3, 1, 0 };
+    for (size_t i = 0; i < 6; i++)
+        assertValue("AsmLinearScan", "simple.reg", expected[i], regMap[i]);
+
+    // not enough registers
+    assertCLRXException("AsmLinearScan", "simple.tooMany",
+            "Too many register is needed", [&linearScan, &regMap]()
+            { linearScan.allocate(3, regMap); });
+}
+
+static void testDependencies()
+{
+    AsmLinearScan linearScan;
+    Array<cxuint> regMap;
+    linearScan.reset(8);
+    linearScan.addInterval({ 0, 20, 0 });
+    // real register (fixed) used later
+    linearScan.addInterval({ 10, 12, 1 });
+    linearScan.setFixedRegister(1, 1);
+    // linear chain 2-3-4 (aligned to 4)
+    linearScan.addInterval({ 2, 6, 2 });
+    linearScan.addInterval({ 3, 6, 3 });
+    linearScan.addInterval({ 4, 7, 4 });
+    linearScan.addLinear(2, 3);
+    linearScan.addLinear(3, 4);
+    linearScan.setAlignment(2, 4);
+    // variables 5 and 6 are equal, 6 is next register after variable 7
+    linearScan.addInterval({ 1, 3, 5 });
+    linearScan.addInterval({ 8, 15, 6 });
+    linearScan.addEqual(5, 6);
+    linearScan.addInterval({ 9, 11, 7 });
+    linearScan.addLinear(7, 6);
+    assertValue("AsmLinearScan", "deps.regsNum", cxuint(7),
+                linearScan.allocate(16, regMap));
+    // variable 5 (range 1-15) can not use register 1 (used by real register)
+    const cxuint expected[8] = { 0, 1, 4, 5, 6, 3, 3, 2 };
+    for (size_t i = 0; i < 8; i++)
+        assertValue("AsmLinearScan", "deps.reg", expected[i], regMap[i]);
+
+    // fixed register at start of linear chain
+    linearScan.reset(2);
+    linearScan.addInterval({ 0, 2, 0 });
+    linearScan.addInterval({ 0, 2, 1 });
+    linearScan.addLinear(0, 1);
+    linearScan.setFixedRegister(1, 0);
+    assertCLRXException("AsmLinearScan", "deps.fixed",
+            "Linear dependencies of registers can not be satisfied",
+            [&linearScan, &regMap]() { linearScan.allocate(16, regMap); });
+}
+
+static void testRandom(size_t nodesNum, size_t intervalsNum, size_t maxLength)
+{
+    std::ostringstream oss;
+    oss << "random(" << nodesNum << "," << intervalsNum << "," << maxLength << ")";
+    const std::string testName = oss.str();
+
+    uint64_t seed = 0x6a09e667f3bcc909ULL ^ intervalsNum;
+    auto random = [&seed](size_t n)
+    {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        return size_t(seed>>33) % n;
+    };
+    AsmLinearScan linearScan;
+    linearScan.reset(nodesNum);
+    std::vector<std::pair<size_t, size_t> > ranges(nodesNum,
+                std::make_pair(SIZE_MAX, size_t(0)));
+    for (size_t i = 0; i < intervalsNum; i++)
+    {
+        const size_t start = random(intervalsNum*2);
+        const AsmLiveInterval interval = { start, start + 1 + random(maxLength),
+                random(nodesNum) };
+        linearScan.addInterval(interval);
+        ranges[interval.vidx].first = std::min(ranges[interval.vidx].first,
+                    interval.start);
+        ranges[interval.vidx].second = std::max(ranges[interval.vidx].second,
+                    interval.end);
+    }
+    // linear chains of neighbouring variables
+    std::vector<size_t> nextNodes(nodesNum, SIZE_MAX);
+    std::vector<cxbyte> aligns(nodesNum, 0);
+    for (size_t node = 0; node+1 < nodesNum; node += 1 + random(8))
+    {
+        const size_t chainSize = std::min(random(4), nodesNum-node-1);
+        aligns[node] = chainSize!=0 ? 2 : 1;
+        linearScan.setAlignment(node, aligns[node]);
+        for (size_t i = 0; i < chainSize; i++, node++)
+        {
+            linearScan.addLinear(node, node+1);
+            nextNodes[node] = node+1;
+        }
+    }
+
+    Array<cxuint> regMap;
+    const cxuint regsNum = linearScan.allocate(256, regMap);
+    assertValue("AsmLinearScan", testName+".size", nodesNum, regMap.size());
+    cxuint maxReg = 0;
+    for (size_t a = 0; a < nodesNum; a++)
+    {
+        maxReg = std::max(maxReg, regMap[a]+1);
+        if (aligns[a] > 1)
+            assertTrue("AsmLinearScan", testName+".align", (regMap[a] % aligns[a]) == 0);
+        if (nextNodes[a] != SIZE_MAX)
+            assertValue("AsmLinearScan", testName+".linear", regMap[a]+1,
+                        regMap[nextNodes[a]]);
+        for (size_t b = a+1; b < nodesNum; b++)
+            if (ranges[a].first < ranges[b].second && ranges[b].first < ranges[a].second)
+                assertTrue("AsmLinearScan", testName+".interfere",
+                           regMap[a] != regMap[b]);
+    }
+    assertValue("AsmLinearScan", testName+".regsNum", maxReg, regsNum);
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testSimple);
+    retVal |= callTest(testDependencies);
+    retVal |= callTest(testRandom, 1, 3, 4);
+    retVal |= callTest(testRandom, 30, 60, 8);
+    retVal |= callTest(testRandom, 200, 400, 12);
+    return retVal;
+}
@@ -0,0 +1,171 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/AsmMacroLibrary.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+#include "AsmTestUtils.h"
+
+using namespace CLRX;
+
+static const char* testDir = "asmmaclib-test";
+
+static AsmResult assembleWithLibrary(const char* source, const char* macroLib = nullptr)
+{
+    return assembleSource("main.s", source, BinaryFormat::RAWCODE,
+            [macroLib](Assembler& assembler)
+            {
+                assembler.addIncludeDir(testDir);
+                if (macroLib != nullptr)
+                    assembler.addMacroLibrary(joinPaths(testDir, macroLib).c_str());
+            });
+}
+
+static const char* libSource = R"ffDXD(.equiv CONSTA, 12
+.set CONSTB, 0x100
+.eqv CONSTC, CONSTB+1
+.macro addx dst, src, val=1
+    s_add_u32 \dst, \src, \val+CONSTA
+.endm
+.macro cnt
+    .int \@, CONSTB+1
+.endm
+.macro varx first:req, rest:vararg
+    .int \first
+    .ifnb \rest
+        varx \rest
+    .endif
+.endm
+.irp i, 1, 2
+.macro nopx\i
+    s_nop \i
+.endm
+.endr
+.macro bad
+    s_mov_b32 s1, xx(
+.endm
+)ffDXD";
+
+static const char* mainSource = R"ffDXD(.rawcode
+.include "lib.s"
+    addx s1, s2
+    addx s3, s4, 5
+    .int CONSTB, CONSTA
+    cnt
+    varx 4, 5, 6
+    cnt
+    nopx2
+)ffDXD";
+
+static void testMacroLibrary()
+{
+    if (!isFileExists(testDir))
+        makeDir(testDir);
+    const std::string libPath = joinPaths(testDir, "lib.s");
+    const std::string libFile = joinPaths(testDir, "lib.clrxlib");
+    writeFile(libPath, libSource);
+    {
+        // build library
+        std::ostringstream msgStream;
+        Array<CString> filenames(1);
+        filenames[0] = libPath.c_str();
+        Assembler assembler(filenames, ASM_WARNINGS, BinaryFormat::RAWCODE,
+                    GPUDeviceType::PITCAIRN, msgStream);
+        assertTrue("AsmMacroLibrary", "lib.good", assembler.assemble());
+        assembler.writeMacroLibrary(libFile.c_str());
+    }
+    {
+        AsmMacroLibrary library(libFile.c_str());
+        // CONSTC is not absolute symbol (it has expression)
+        assertValue("AsmMacroLibrary", "symbolsNum", size_t(2), library.getSymbolsNum());
+        assertString("AsmMacroLibrary", "symbol0", "CONSTA", library.getSymbol(0).name);
+        assertTrue("AsmMacroLibrary", "symbol0.once", library.getSymbol(0).onceDefined);
+        assertValue("AsmMacroLibrary", "macrosNum", size_t(6), library.getMacrosNum());
+        assertValue("AsmMacroLibrary", "loaded", size_t(0), library.getLoadedMacrosNum());
+    }
+
+    const AsmResult expected = assembleWithLibrary(mainSource);
+    assertTrue("AsmMacroLibrary", "expected.good", expected.good);
+    // library included by pseudo-op gives same result
+    std::string libMainSource(mainSource);
+    libMainSource.replace(libMainSource.find(".include \"lib.s\""), 16,
+                ".includelib \"lib.clrxlib\"");
+    const AsmResult result = assembleWithLibrary(libMainSource.c_str());
+    assertTrue("AsmMacroLibrary", "result.good", result.good);
+    assertString("AsmMacroLibrary", "result.messages", expected.messages.c_str(),
+                 result.messages);
+    assertTrue("AsmMacroLibrary", "result.binary", isSameBinary(expected, result));
+    // only used macros are loaded
+    assertValue("AsmMacroLibrary", "result.loaded", size_t(4), result.loadedMacrosNum);
+
+    // library given by user
+    std::string userMainSource(mainSource);
+    userMainSource.erase(userMainSource.find(".include \"lib.s\""), 16);
+    const AsmResult userResult = assembleWithLibrary(userMainSource.c_str(), "lib.clrxlib");
+    assertTrue("AsmMacroLibrary", "userResult.good", userResult.good);
+    assertTrue("AsmMacroLibrary", "userResult.binary", isSameBinary(expected, userResult));
+
+    // error in macro points to its definition in library source
+    const std::string errorSource = libMainSource + "    bad\n";
+    const AsmResult errorExpected = assembleWithLibrary((std::string(mainSource) +
+                "    bad\n").c_str());
+    const AsmResult errorResult = assembleWithLibrary(errorSource.c_str());
+    assertTrue("AsmMacroLibrary", "errorResult.good", !errorResult.good);
+    assertString("AsmMacroLibrary", "errorResult.messages",
+                 errorExpected.messages.c_str(), errorResult.messages);
+
+    // redefinitions and purged macros
+    const AsmResult redefResult = assembleWithLibrary(".rawcode\n.equiv CONSTA, 3\n"
+                ".macro cnt\n.endm\n.includelib \"lib.clrxlib\"\n.purgem addx\n"
+                "addx s1, s2\n");
+    assertString("AsmMacroLibrary", "redefResult.messages",
+                "main.s:5:1: Error: Symbol 'CONSTA' is already defined\n"
+                "main.s:5:1: Error: Macro 'cnt' is already defined\n"
+                "main.s:7:1: Error: Unknown instruction\n", redefResult.messages);
+
+    // truncated library
+    {
+        Array<cxbyte> content = loadDataFromFile(libFile.c_str());
+        std::ofstream ofs(joinPaths(testDir, "trunc.clrxlib").c_str(), std::ios::binary);
+        ofs.write((const char*)content.data(), content.size()-5);
+    }
+    const AsmResult truncResult = assembleWithLibrary(".rawcode\n"
+                ".includelib \"trunc.clrxlib\"\n");
+    assertString("AsmMacroLibrary", "truncResult.messages",
+                "main.s:2:1: Error: Can't load macro library 'asmmaclib-test/"
+                "trunc.clrxlib': Macro library is corrupted\n", truncResult.messages);
+    const AsmResult missingResult = assembleWithLibrary(".rawcode\n"
+                ".includelib \"missing.clrxlib\"\n");
+    assertString("AsmMacroLibrary", "missingResult.messages",
+                "main.s:2:13: Error: Macro library 'missing.clrxlib' not found or "
+                "unavailable in any directory\n", missingResult.messages);
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testMacroLibrary);
+    return retVal;
+}
@@ -0,0 +1,157 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <algorithm>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+/* assembling many sources in parallel (by separate assemblers) must give same
+ * binaries and messages as assembling serially */
+
+struct AsmJobCase
+{
+    const char* input;
+    BinaryFormat format;
+    GPUDeviceType deviceType;
+};
+
+static const AsmJobCase asmJobCasesTbl[] =
+{
+    {   R"ffDXD(.kernel aaa
+        .config
+            .dims x
+        .text
+aaa:    s_mov_b32 s1, s2
+        v_add_f32 v1, v2, v3
+        s_endpgm
+.kernel bbb
+        .config
+            .dims xy
+        .text
+bbb:    v_mad_f32 v1, v2, v3, v4
+        s_endpgm
+)ffDXD", BinaryFormat::AMD, GPUDeviceType::PITCAIRN },
+    {   R"ffDXD(.kernel aaa
+        .config
+            .dims x
+        .text
+aaa:    s_load_dwordx2 s[0:1], s[4:5], 0
+        s_waitcnt lgkmcnt(0)
+        v_mov_b32 v1, s0
+        s_endpgm
+)ffDXD", BinaryFormat::AMDCL2, GPUDeviceType::TONGA },
+    {   R"ffDXD(.kernel aaa
+        .args
+            .arg scalar, 4
+        .config
+            .dims x
+        .text
+aaa:    s_mov_b32 s3, 0x1234
+        v_cvt_f32_u32 v1, s3
+        s_endpgm
+)ffDXD", BinaryFormat::GALLIUM, GPUDeviceType::BONAIRE },
+    {   R"ffDXD(.kernel aaa
+        .config
+            .dims x
+        .text
+aaa:    .skip 256
+        v_add_u32 v1, vcc, v2, v3
+        s_endpgm
+)ffDXD", BinaryFormat::ROCM, GPUDeviceType::FIJI },
+    {   R"ffDXD(        s_mov_b32 s1, s2
+        .print "raw code"
+        .warning "some warning"
+        v_add_f32 v1, v2, v3
+)ffDXD", BinaryFormat::RAWCODE, GPUDeviceType::CAPE_VERDE },
+    {   R"ffDXD(        s_mov_b32 s1, s2
+        s_unknown_insn s1
+        v_add_f32 v1, v2, xx
+)ffDXD", BinaryFormat::RAWCODE, GPUDeviceType::CAPE_VERDE }
+};
+
+struct AsmJobResult
+{
+    bool good;
+    Array<cxbyte> binary;
+    std::string messages;
+    std::string printed;
+};
+
+static void runAsmJob(const AsmJobCase& testCase, AsmJobResult& result)
+{
+    std::istringstream input(testCase.input);
+    std::ostringstream msgStream;
+    std::ostringstream printStream;
+    Assembler assembler("test.s", input, ASM_ALL&~ASM_ALTMACRO,
+            testCase.format, testCase.deviceType, msgStream, printStream);
+    assembler.setDriverVersion(191205);
+    assembler.setLLVMVersion(30900);
+    result.good = assembler.assemble();
+    if (result.good)
+        assembler.writeBinary(result.binary);
+    result.messages = msgStream.str();
+    result.printed = printStream.str();
+}
+
+static void testParallelAssembling()
+{
+    const size_t casesNum = sizeof(asmJobCasesTbl)/sizeof(AsmJobCase);
+    const size_t jobsNum = casesNum*16;
+    Array<AsmJobResult> expected(casesNum);
+    for (size_t i = 0; i < casesNum; i++)
+        runAsmJob(asmJobCasesTbl[i], expected[i]);
+    
+    Array<AsmJobResult> results(jobsNum);
+    parallelFor(jobsNum, 8, [&results](size_t i)
+    { runAsmJob(asmJobCasesTbl[i % casesNum], results[i]); });
+    
+    for (size_t i = 0; i < jobsNum; i++)
+    {
+        const AsmJobResult& exp = expected[i % casesNum];
+        const AsmJobResult& res = results[i];
+        std::ostringstream oss;
+        oss << "job#" << i;
+        const std::string jobName = oss.str();
+        assertValue("AsmParallel", jobName+".good", exp.good, res.good);
+        assertValue("AsmParallel", jobName+".messages", exp.messages, res.messages);
+        assertValue("AsmParallel", jobName+".printed", exp.printed, res.printed);
+        assertTrue("AsmParallel", jobName+".binary",
+                exp.binary.size() == res.binary.size() &&
+                std::equal(exp.binary.begin(), exp.binary.end(), res.binary.begin()));
+    }
+    // check whether cases are not trivial (only last case fails)
+    for (size_t i = 0; i < casesNum-1; i++)
+        assertTrue("AsmParallel", "good", expected[i].good && !expected[i].binary.empty());
+    assertTrue("AsmParallel", "lastFailed", !expected[casesNum-1].good &&
+                !expected[casesNum-1].messages.empty());
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testParallelAssembling);
+    return retVal;
+}
@@ -285,6 +285,127 @@ static void testCreateSSAData(cxuint testSuiteId, cxuint i, const AsmSSADataCase
     }
 }
 
+struct AsmColorCase
+{
+    const char* input;
+    cxuint realRegs[2][2]; // expected real registers (SGPRs, VGPRs), UINT_MAX - none
+};
+
+static const AsmColorCase colorTestCasesTbl[] =
+{
+    {   // 0 - real registers are only read
+        ".regvar sa:s, va:v\n"
+        "s_add_u32 sa, s9, s7\n"
+        "v_add_f32 va, v3, v5\n"
+        "s_add_u32 sa, sa, s7\n"
+        "v_add_f32 va, va, v5\n"
+        "s_endpgm\n",
+        { { 7, 9 }, { 3, 5 } }
+    },
+    {   // 1 - written real registers (some without variables)
+        ".regvar sa:s, va:v\n"
+        "s_mov_b32 s9, s7\n"
+        "v_mov_b32 v3, v5\n"
+        "s_add_u32 s9, s9, s7\n"
+        "v_add_f32 v3, v3, v5\n"
+        "s_add_u32 sa, s9, s7\n"
+        "v_add_f32 va, v3, v5\n"
+        "s_mov_b32 s9, sa\n"
+        "v_mov_b32 v3, va\n"
+        "s_endpgm\n",
+        { { 7, UINT_MAX }, { 5, UINT_MAX } }
+    },
+    { nullptr }
+};
+
+static void testColorInterferenceGraph(cxuint i, const AsmColorCase& testCase)
+{
+    std::istringstream input(testCase.input);
+    std::ostringstream errorStream;
+    std::ostringstream oss;
+    oss << " testColorInterGraph case#" << i;
+    const std::string testCaseName = oss.str();
+    
+    Assembler assembler("test.s", input,
+                    (ASM_ALL&~ASM_ALTMACRO) | ASM_TESTRUN | ASM_TESTRESOLVE,
+                    BinaryFormat::RAWCODE, GPUDeviceType::CAPE_VERDE, errorStream);
+    assertValue<bool>("testColorInterGraph", testCaseName+".good", true,
+                      assembler.assemble());
+    
+    AsmRegAllocator regAlloc(assembler);
+    regAlloc.allocateRegisters(0);
+    // real registers must be colored by its register index
+    for (cxuint regType = 0; regType < 2; regType++)
+    {
+        const Array<cxuint>& gcMap = regAlloc.getGraphColorMap(regType);
+        std::ostringstream rtOss;
+        rtOss << testCaseName << ".regType" << regType << ".";
+        const std::string rtName = rtOss.str();
+        for (size_t j = 0; j < gcMap.size(); j++)
+            if (gcMap[j] == UINT_MAX)
+            {
+                std::ostringstream noss;
+                noss << rtName << "node" << j << ".notColored";
+                throw Exception(noss.str());
+            }
+        for (cxuint reg: testCase.realRegs[regType])
+            if (reg != UINT_MAX)
+                assertValue("testColorInterGraph", rtName+"realReg", true,
+                    std::find(gcMap.begin(), gcMap.end(), reg) != gcMap.end());
+    }
+}
+
+static void testCompareRegAllocModes(cxuint testSuiteId, cxuint i, const char* input)
+{
+    std::istringstream inputStream(input);
+    std::ostringstream errorStream;
+    std::ostringstream oss;
+    oss << " testCompareRegAllocModes" << testSuiteId << " case#" << i;
+    const std::string testCaseName = oss.str();
+    
+    Assembler assembler("test.s", inputStream,
+                    (ASM_ALL&~ASM_ALTMACRO) | ASM_TESTRUN | ASM_TESTRESOLVE,
+                    BinaryFormat::RAWCODE, GPUDeviceType::CAPE_VERDE, errorStream);
+    if (!assembler.assemble() || assembler.getSections().empty() ||
+        assembler.getSections()[0].usageHandler == nullptr)
+        return; // skip cases with errors or without code
+    
+    cxuint regsNums[2][2];
+    for (AsmRegAllocMode mode: { AsmRegAllocMode::GRAPH_COLORING,
+                AsmRegAllocMode::LINEAR_SCAN })
+    {
+        AsmRegAllocator regAlloc(assembler);
+        regAlloc.setMode(mode);
+        regAlloc.allocateRegisters(0);
+        for (cxuint regType = 0; regType < 2; regType++)
+        {
+            std::ostringstream rtOss;
+            rtOss << testCaseName << ".mode" << cxuint(mode) << ".regType" << regType;
+            const std::string rtName = rtOss.str();
+            const cxuint regsNum = regAlloc.getRegistersNum(regType);
+            // every variable must get register below number of allocated registers
+            const Array<cxuint>& gcMap = regAlloc.getGraphColorMap(regType);
+            for (size_t j = 0; j < gcMap.size(); j++)
+                if (gcMap[j] >= regsNum)
+                {
+                    std::ostringstream noss;
+                    noss << rtName << ".node" << j << ".badColor";
+                    throw Exception(noss.str());
+                }
+            regsNums[cxuint(mode)][regType] = regsNum;
+        }
+    }
+    // both modes must allocate same number of registers for these cases
+    for (cxuint regType = 0; regType < 2; regType++)
+    {
+        std::ostringstream rtOss;
+        rtOss << testCaseName << ".regType" << regType << ".regsNum";
+        assertValue("testCompareRegAllocModes", rtOss.str(),
+                regsNums[cxuint(AsmRegAllocMode::GRAPH_COLORING)][regType],
+                regsNums[cxuint(AsmRegAllocMode::LINEAR_SCAN)][regType]);
+    }
+}
+
 int main(int argc, const char** argv)
 {
     int retVal = 0;
@@ -320,5 +441,45 @@ int main(int argc, const char** argv)
             std::cerr << ex.what() << std::endl;
             retVal = 1;
         }
+    for (size_t i = 0; colorTestCasesTbl[i].input!=nullptr; i++)
+        try
+        { testColorInterferenceGraph(i, colorTestCasesTbl[i]); }
+        catch(const std::exception& ex)
+        {
+            std::cerr << ex.what() << std::endl;
+            retVal = 1;
+        }
+    for (size_t i = 0; ssaDataTestCases1Tbl[i].input!=nullptr; i++)
+        try
+        { testCompareRegAllocModes(0, i, ssaDataTestCases1Tbl[i].input); }
+        catch(const std::exception& ex)
+        {
+            std::cerr << ex.what() << std::endl;
+            retVal = 1;
+        }
+    for (size_t i = 0; ssaDataTestCases2Tbl[i].input!=nullptr; i++)
+        try
+        { testCompareRegAllocModes(1, i, ssaDataTestCases2Tbl[i].input); }
+        catch(const std::exception& ex)
+        {
+            std::cerr << ex.what() << std::endl;
+            retVal = 1;
+        }
+    for (size_t i = 0; ssaDataTestCases3Tbl[i].input!=nullptr; i++)
+        try
+        { testCompareRegAllocModes(2, i, ssaDataTestCases3Tbl[i].input); }
+        catch(const std::exception& ex)
+        {
+            std::cerr << ex.what() << std::endl;
+            retVal = 1;
+        }
+    for (size_t i = 0; colorTestCasesTbl[i].input!=nullptr; i++)
+        try
+        { testCompareRegAllocModes(3, i, colorTestCasesTbl[i].input); }
+        catch(const std::exception& ex)
+        {
+            std::cerr << ex.what() << std::endl;
+            retVal = 1;
+        }
     return retVal;
 }
@@ -594,12 +594,12 @@ const AsmSSADataCase ssaDataTestCases1Tbl[] =
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 266 }, SSAInfo(0, 0, 0, 0, 0, false) },
-                    { { "sa", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 2, 2, false) },
                     { { "va", 0 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 1 }, SSAInfo(0, 1, 1, 2, 2, false) },
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 4 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 5 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true }
@@ -635,34 +635,34 @@ j3:     v_add_f32 va[2], va[5], va[3]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 2, 2, false) },
                     { { "va", 0 }, SSAInfo(0, 1, 1, 3, 3, false) },
                     { { "va", 1 }, SSAInfo(0, 1, 1, 3, 3, false) },
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 4 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 5 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
             { 44, 56, { },
                 {
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 5 }, SSAInfo(1, 2, 2, 2, 1, false) },
                     { { "va", 6 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
             { 56, 68, { },
                 {
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 3 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 5 }, SSAInfo(1, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "va", 5 }, SSAInfo(1, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "va", 6 }, SSAInfo(0, 2, 2, 2, 1, false) }
                 }, false, false, true },
             { 68, 76, { },
                 {
                     { { "va", 2 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 5 }, SSAInfo(1, SIZE_MAX, 3, SIZE_MAX, 0, true) }
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 5 }, SSAInfo(1, UINT32_MAX, 3, UINT32_MAX, 0, true) }
                 }, false, false, true },
         },
         { },
@@ -697,34 +697,34 @@ j3:     v_add_f32 va[2], va[5], va[3]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 2, 2, false) },
                     { { "va", 0 }, SSAInfo(0, 1, 1, 3, 3, false) },
                     { { "va", 1 }, SSAInfo(0, 1, 1, 3, 3, false) },
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 4 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 5 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
             { 64, 76, { },
                 {
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 5 }, SSAInfo(1, 2, 2, 2, 1, false) },
                     { { "va", 6 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
             { 76, 88, { },
                 {
-                    { { "va", 2 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 3 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 5 }, SSAInfo(1, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "va", 5 }, SSAInfo(1, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "va", 6 }, SSAInfo(0, 2, 2, 2, 1, false) }
                 }, false, false, true },
             { 88, 96, { },
                 {
                     { { "va", 2 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 3 }, SSAInfo(0, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 5 }, SSAInfo(1, SIZE_MAX, 3, SIZE_MAX, 0, true) }
+                    { { "va", 3 }, SSAInfo(0, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 5 }, SSAInfo(1, UINT32_MAX, 3, UINT32_MAX, 0, true) }
                 }, false, false, true },
         },
         { },
@@ -812,12 +812,12 @@ wx3:    v_nop
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+2 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "va", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 2 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 3 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 4 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 5 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "va", 5 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             { 52, 68,
                 { { 3, false }, { 6, false }, { 10, false }, { 14, false } },
@@ -825,11 +825,11 @@ wx3:    v_nop
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+3, }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "va", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 2 }, SSAInfo(1, 2, 2, 2, 1, false) },
                     { { "va", 3 }, SSAInfo(1, 2, 2, 2, 1, false) },
-                    { { "va", 4 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 4 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 5 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, false },
             { 68, 92,
@@ -838,19 +838,19 @@ wx3:    v_nop
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+4 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "va", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 2 }, SSAInfo(2, 3, 3, 3, 1, false) },
                     { { "va", 3 }, SSAInfo(2, 3, 3, 3, 1, false) },
-                    { { "va", 4 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 4 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 6 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
             // 4-7:
             { 96, 112,
                 { },
                 {
-                    { { "va", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "vb", 0 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "vb", 5 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
@@ -862,21 +862,21 @@ wx3:    v_nop
                 {
                     { { "", 256+11 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "va", 9 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "vb", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "vb", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             { 128, 136,
                 { },
                 {
                     { { "", 256+11 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "va", 10 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "vb", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "vb", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // 8-11
             { 144, 160,
                 { },
                 {
-                    { { "va", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 3 }, SSAInfo(0, 4, 4, 4, 1, false) },
                     { { "vb", 1 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
@@ -891,15 +891,15 @@ wx3:    v_nop
                 {
                     { { "", 256+19 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "va", 8 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "vb", 5 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "vb", 5 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // 12-15
             { 192, 208,
                 { },
                 {
-                    { { "va", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "vb", 1 }, SSAInfo(0, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "vb", 1 }, SSAInfo(0, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "vb", 2 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "vb", 3 }, SSAInfo(0, 1, 1, 1, 1, false) }
                 }, false, false, true },
@@ -908,14 +908,14 @@ wx3:    v_nop
                 {
                     { { "", 256+11 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "va", 7 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "vb", 5 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "vb", 5 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             { 216, 224,
                 { },
                 {
                     { { "", 256+13 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "va", 6 }, SSAInfo(0, 2, 2, 2, 1, false) },
-                    { { "vb", 5 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "vb", 5 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             { 224, 232,
                 { },
@@ -1043,8 +1043,8 @@ b12:    v_mov_b32 va[4], 122
                     { { "", 6 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 7 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 0 }, SSAInfo(5, 6, 6, 8, 3, false) },
-                    { { "sa", 2 }, SSAInfo(7, SIZE_MAX, 8, SIZE_MAX, 0, true) },
-                    { { "sa", 3 }, SSAInfo(5, SIZE_MAX, 6, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(7, UINT32_MAX, 8, UINT32_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(5, UINT32_MAX, 6, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "sa", 5 }, SSAInfo(0, 1, 1, 3, 3, false) },
                     { { "sa", 6 }, SSAInfo(0, 1, 1, 4, 4, false) }
@@ -1057,13 +1057,13 @@ b12:    v_mov_b32 va[4], 122
                     { { "", 256+2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+3 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+4 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(5, SIZE_MAX, 9, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(6, SIZE_MAX, 9, SIZE_MAX, 0, true) },
-                    { { "sa", 2 }, SSAInfo(7, SIZE_MAX, 8, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(5, UINT32_MAX, 9, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(6, UINT32_MAX, 9, UINT32_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(7, UINT32_MAX, 8, UINT32_MAX, 0, true) },
                     { { "va", 1 }, SSAInfo(0, 13, 13, 20, 8, true) },
                     { { "va", 2 }, SSAInfo(0, 6, 6, 11, 6, false) },
                     { { "va", 3 }, SSAInfo(0, 1, 1, 4, 4, false) },
-                    { { "va", 4 }, SSAInfo(0, SIZE_MAX, 8, SIZE_MAX, 0, true) },
+                    { { "va", 4 }, SSAInfo(0, UINT32_MAX, 8, UINT32_MAX, 0, true) },
                 }, false, false, true },
             // block 3
             { 328, 412,
@@ -1074,7 +1074,7 @@ b12:    v_mov_b32 va[4], 122
                     { { "", 256+1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 1 }, SSAInfo(6, 7, 7, 7, 1, true) },
-                    { { "sa", 2 }, SSAInfo(7, SIZE_MAX, 8, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(7, UINT32_MAX, 8, UINT32_MAX, 0, true) },
                     { { "va", 0 }, SSAInfo(0, 1, 1, 5, 5, false) },
                     { { "va", 1 }, SSAInfo(0, 1, 1, 6, 6, false) },
                     { { "va", 2 }, SSAInfo(0, 1, 1, 5, 5, false) }
@@ -1087,8 +1087,8 @@ b12:    v_mov_b32 va[4], 122
                     { { "", 256 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 256+2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 1 }, SSAInfo(6, 8, 8, 8, 1, false) },
-                    { { "sa", 2 }, SSAInfo(7, SIZE_MAX, 8, SIZE_MAX, 0, true) },
-                    { { "sa", 3 }, SSAInfo(5, SIZE_MAX, 6, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(7, UINT32_MAX, 8, UINT32_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(5, UINT32_MAX, 6, UINT32_MAX, 0, true) },
                     { { "va", 0 }, SSAInfo(0, 6, 6, 11, 6, true) },
                     { { "va", 1 }, SSAInfo(0, 7, 7, 12, 6, true) },
                     { { "va", 4 }, SSAInfo(0, 1, 1, 7, 7, false) }
@@ -1141,11 +1141,11 @@ loop:
                 { { 1, false }, { 2, false } },
                 {
                     { { "sa", 0 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 0 }, SSAInfo(1, 2, 2, 4, 3, false) },
                     { { "va", 1 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "va", 2 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 3 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 3 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 4 }, SSAInfo(1, 2, 2, 4, 3, true) }
                 }, false, false, false },
             { 84, 96,
@@ -1237,7 +1237,7 @@ pp2:    s_xor_b32 sa[1], sa[1], sa[0]
             { 28, 48,
                 { { 2, false }, { 3, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 1 }, SSAInfo(1, 2, 2, 3, 2, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, false) },
                 }, false, false, false },
@@ -1270,8 +1270,8 @@ pp2:    s_xor_b32 sa[1], sa[1], sa[0]
             { 120, 144,
                 { { 1, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(6, SIZE_MAX, 7, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(7, SIZE_MAX, 8, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(6, UINT32_MAX, 7, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(7, UINT32_MAX, 8, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 9, 3, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 4, 2, true) }
                 }, false, false, true },
@@ -1281,9 +1281,9 @@ pp2:    s_xor_b32 sa[1], sa[1], sa[0]
                 {
                     { { "sa", 0 }, SSAInfo(6, 7, 7, 8, 2, true) },
                     { { "sa", 1 }, SSAInfo(7, 8, 8, 8, 1, true) },
-                    { { "sa", 2 }, SSAInfo(6, SIZE_MAX, 10, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(6, UINT32_MAX, 10, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 5, 3, true) },
-                    { { "sa", 4 }, SSAInfo(1, SIZE_MAX, 5, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(1, UINT32_MAX, 5, UINT32_MAX, 0, true) }
                 }, false, false, true }
         },
         {
@@ -1363,11 +1363,11 @@ loop1end:
             { 16, 36,
                 { { 2, false }, { 3, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(0, 1, 1, 1, 1, false) },
                     { { "va", 0 }, SSAInfo(1, 2, 2, 3, 2, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "va", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 2 (to bb0)
             { 36, 48,
@@ -1385,17 +1385,17 @@ loop1end:
             { 56, 60,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 1 }, SSAInfo(1, 2, 2, 2, 1, false) }
                 }, false, false, false },
             // block 5 (loop1)
             { 60, 84,
                 { { 6, false }, { 7, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(0, 1, 1, 1, 1, false) },
-                    { { "va", 0 }, SSAInfo(5, SIZE_MAX, 6, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(5, UINT32_MAX, 6, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 2 }, SSAInfo(1, 2, 2, 3, 2, true) }
                 }, false, false, false },
             // block 6 (to bb1)
@@ -1424,8 +1424,8 @@ loop1end:
                 {
                     { { "sa", 0 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "va", 0 }, SSAInfo(5, 6, 6, 8, 3, true) },
-                    { { "va", 1 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
-                    { { "va", 2 }, SSAInfo(4, SIZE_MAX, 5, SIZE_MAX, 0, true) }
+                    { { "va", 1 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
+                    { { "va", 2 }, SSAInfo(4, UINT32_MAX, 5, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 10 (to bb0)
             { 140, 144,
@@ -1507,56 +1507,56 @@ bb1e:   s_add_u32 sa[0], sa[0], sa[1]
                 { { 2, false }, { 3, false } },
                 {
                     { { "sa", 0 }, SSAInfo(1, 2, 2, 4, 3, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 2 - bb00 second
             { 40, 52,
                 { { 4, false } },
                 {
                     { { "sa", 0 }, SSAInfo(4, 5, 5, 6, 2, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 3 - bb01
             { 52, 60,
                 { },
                 {
                     { { "sa", 0 }, SSAInfo(4, 8, 8, 9, 2, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 4 - bb0e
             { 60, 68,
                 { },
                 {
                     { { "sa", 0 }, SSAInfo(6, 7, 7, 7, 1, true) },
-                    { { "sa", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 5 - bb10
             { 68, 92,
                 { { 6, false }, { 7, false } },
                 {
                     { { "sa", 0 }, SSAInfo(1, 10, 10, 14, 5, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 6 - bb10 (second)
             { 92, 104,
                 { { 8, false } },
                 {
                     { { "sa", 0 }, SSAInfo(14, 15, 15, 16, 2, true) },
-                    { { "sa", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 7 - bb11
             { 104, 112,
                 { },
                 {
                     { { "sa", 0 }, SSAInfo(14, 18, 18, 19, 2, true) },
-                    { { "sa", 3 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 3 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 8 - bb1e
             { 112, 120,
                 { },
                 {
                     { { "sa", 0 }, SSAInfo(16, 17, 17, 17, 1, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, true }
         },
         {   // SSA replaces
@@ -1622,7 +1622,7 @@ bb1:    s_xor_b32 sa[2], sa[2], sa[0]
             { 36, 48,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, true },
@@ -1630,8 +1630,8 @@ bb1:    s_xor_b32 sa[2], sa[2], sa[0]
             { 48, 64,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 3, 3, 4, 2, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, false, false, true },
@@ -1639,8 +1639,8 @@ bb1:    s_xor_b32 sa[2], sa[2], sa[0]
             { 64, 76,
                 { { 1, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 6, 6, 6, 1, true) }
                 }, false, false, true }
@@ -1784,21 +1784,21 @@ bb2:    s_add_u32 sa[3], sa[3], sa[2]
             { 24, 32,
                 { },
                 {
-                    { { "sa", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
             // block 2 - bbx
             { 32, 40,
                 { { 3, false }, { 4, false } },
                 {
-                    { { "sa", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
             // block 3 - bb0
             { 40, 48,
                 { },
                 {
-                    { { "sa", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, true },
             // block 4 - bb1_
@@ -1816,7 +1816,7 @@ bb2:    s_add_u32 sa[3], sa[3], sa[2]
             { 56, 64,
                 { { 5, false } },
                 {
-                    { { "sa", 2 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 5, 5, 5, 1, true) }
                 }, false, false, true }
         },
@@ -1869,7 +1869,7 @@ b3:     s_xor_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 2 - b1
             { 24, 32,
@@ -1877,14 +1877,14 @@ b3:     s_xor_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - b1x
             { 32, 40,
                 { { 1, false } },
                 {
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 4 - b2
             { 40, 48,
@@ -1892,14 +1892,14 @@ b3:     s_xor_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 5 - b2x
             { 48, 56,
                 { { 3, false } },
                 {
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 6 - b3
             { 56, 68,
@@ -1907,7 +1907,7 @@ b3:     s_xor_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 5, 5, 5, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true }
         },
         {   // SSA replaces
@@ -1948,14 +1948,14 @@ b2:     s_branch b11
                 { },
                 {
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 3 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 3 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 2 - b1
             { 20, 28,
                 { { 1, false } },
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 3 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 3 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, false, true },
             // block 3 - b2
             { 28, 32,
@@ -1998,15 +1998,15 @@ end:    s_xor_b32 sa[3], sa[3], sa[4]
                 { { 2, false }, { 4, false } },
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 2 - loop part 2
             { 16, 24,
                 { { 1, false }, { 3, false } },
                 {
-                    { { "sa", 2 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, false) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - end 2
             { 24, 28,
@@ -2017,7 +2017,7 @@ end:    s_xor_b32 sa[3], sa[3], sa[4]
                 { },
                 {
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true }
         },
         {
@@ -2056,22 +2056,22 @@ end:    s_xor_b32 sa[3], sa[3], sa[4]
                 { { 2, false }, { 3, false } },
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 2 - loop part 2
             { 16, 24,
                 { { 1, false }, { 3, false } },
                 {
-                    { { "sa", 2 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, false) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - end
             { 24, 32,
                 { },
                 {
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true }
         },
         {
@@ -2128,7 +2128,7 @@ routine:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         { },
@@ -2190,7 +2190,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - first return
             { 56, 68,
@@ -2200,7 +2200,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 4 - second return
             { 68, 80,
@@ -2210,7 +2210,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -2272,7 +2272,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                 { { 3, false }, { 4, false } },
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - first return
             { 52, 64,
@@ -2282,7 +2282,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 4 - second return
             { 64, 72,
@@ -2291,7 +2291,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -2354,7 +2354,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - first return
             { 56, 64,
@@ -2363,7 +2363,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 4 - second return
             { 64, 72,
@@ -2372,7 +2372,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -2475,7 +2475,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 56, 72,
                 { { 3, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 6 }, SSAInfo(0, 1, 1, 1, 1, false) }
@@ -2484,7 +2484,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 72, 84,
                 { { 4, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
@@ -2492,7 +2492,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 84, 92,
                 { { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, true },
             // block 5 - bb00_
@@ -2501,7 +2501,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
@@ -2509,7 +2509,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 104, 112,
                 { { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) }
                 }, false, false, true },
             // block 7 - bb01_
@@ -2518,7 +2518,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 1, 1, true) }
@@ -2527,7 +2527,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 128, 140,
                 { { 9, false }, { 11, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 6, 6, 6, 1, true) }
                 }, false, false, false },
@@ -2535,7 +2535,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 140, 148,
                 { { 10, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(8, 9, 9, 9, 1, true) }
                 }, false, false, true },
             // block 10 - bb10_
@@ -2544,7 +2544,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(9, 10, 10, 10, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 5 }, SSAInfo(0, 1, 1, 1, 1, false) }
@@ -2553,7 +2553,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
             { 164, 172,
                 { { 12, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(8, 11, 11, 11, 1, true) }
                 }, false, false, true },
             // block 12
@@ -2562,7 +2562,7 @@ bb11_:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(11, 12, 12, 12, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(0, 2, 2, 2, 1, true) }
@@ -2673,7 +2673,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 5
             { 128, 136,
@@ -2682,7 +2682,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 6
             { 136, 144,
@@ -2691,7 +2691,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -2752,7 +2752,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - first return
             { 52, 60,
@@ -2761,7 +2761,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 4 - second return
             { 60, 68,
@@ -2770,7 +2770,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         { },
@@ -2830,7 +2830,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - first return
             { 56, 64,
@@ -2839,7 +2839,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 4 - second return
             { 64, 72,
@@ -2848,7 +2848,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -2953,7 +2953,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 4 - routine - first way bb0
             { 92, 120,
@@ -2964,7 +2964,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, true, false, false },
             // block 5 - routine - return 0
             { 120, 124,
@@ -2980,7 +2980,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 6, 6, 6, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 7
             { 132, 144,
@@ -2988,7 +2988,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 8
             { 144, 152,
@@ -2997,7 +2997,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 9
             { 152, 160,
@@ -3006,7 +3006,7 @@ bb2:    s_min_u32 sa[2], sa[2], sa[4]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -3130,7 +3130,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 4 - routine way 0
             { 112, 120,
@@ -3139,7 +3139,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 5 - routine way 1
             { 120, 128,
@@ -3148,7 +3148,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 6 - routine 2
             { 128, 140,
@@ -3156,7 +3156,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                 {
                     { { "sa", 2 }, SSAInfo(1, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 7 - routine 2 way 0
             { 140, 148,
@@ -3165,7 +3165,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 8 - routine 2 way 1
             { 148, 156,
@@ -3174,7 +3174,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 7, 7, 7, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 9 - routine 3
             { 156, 168,
@@ -3182,7 +3182,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                 {
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 10 - routine 3 way 0
             { 168, 176,
@@ -3191,7 +3191,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 3 }, SSAInfo(4, 5, 5, 5, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 11 - routine 3 way 1
             { 176, 184,
@@ -3200,7 +3200,7 @@ bb3:    s_and_b32 sa[5], sa[5], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 4, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true  }
         },
         {   // SSA replaces
@@ -131,7 +131,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[6]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 6 - routine1 way 1
             { 96, 108,
@@ -141,7 +141,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[6]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 7 - routine1 way 2
             { 108, 120,
@@ -151,7 +151,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[6]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 8 - routine 2
             { 120, 132,
@@ -159,7 +159,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[6]
                 {
                     { { "sa", 2 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 9 - routine 2 way 0
             { 132, 144,
@@ -169,7 +169,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[6]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true },
             // block 10 - routine 2 way 1
             { 144, 152,
@@ -178,7 +178,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[6]
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
-                    { { "sa", 6 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 6 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, true, true }
         },
         {   // SSA replaces
@@ -336,18 +336,18 @@ mainz:
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(0, 1, 1, 1, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "va", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 2 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "xa", 0 }, SSAInfo(0, 1, 1, 1, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             {   // block 10 - mainy
                 128, 148,
                 { },
                 {
                     { { "va", 0 }, SSAInfo(0, 1, 1, 1, 1, true) },
-                    { { "va", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "va", 3 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "va", 4 }, SSAInfo(0, 1, 1, 1, 1, true) }
@@ -360,12 +360,12 @@ mainz:
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "xa", 3 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "xa", 4 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "xa", 5 }, SSAInfo(0, 1, 1, 1, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                 }, false, false, true },
         },
         {   // SSA replaces
@@ -446,36 +446,36 @@ aa3:    s_xor_b32 sa[4], sa[4], sa[7]
                 { },
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             {   // block 2 - l1
                 32, 40,
                 { },
                 {
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             {   // block 3 - l2
                 40, 48,
                 { },
                 {
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(3, 4, 4, 4, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             {   // block 4 - l3
                 48, 60,
                 { { 1, false }, { 5, false } },
                 {
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(4, 5, 5, 5, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             {   // block 5 - end
                 60, 64,
@@ -486,36 +486,36 @@ aa3:    s_xor_b32 sa[4], sa[4], sa[7]
                 { { 1, false } },
                 {
                     { { "sa", 5 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(1, 6, 6, 6, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             {   // block 7 - aa1
                 76, 88,
                 { { 2, false } },
                 {
                     { { "sa", 2 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(1, 7, 7, 7, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             {   // block 9 - aa2
                 88, 100,
                 { { 3, false } },
                 {
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(1, 8, 8, 8, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true },
             {   // block 10 - aa3
                 100, 112,
                 { { 4, false } },
                 {
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "sa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "xa", 0 }, SSAInfo(1, 9, 9, 9, 1, true) },
-                    { { "xa", 7 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "xa", 7 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, true }
         },
         {   // SSA replaces
@@ -594,7 +594,7 @@ loopend:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 5 }, SSAInfo(4, 6, 6, 6, 1, true) }
                 }, true, false, false },
@@ -606,8 +606,8 @@ loopend:
                 36, 44,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -615,8 +615,8 @@ loopend:
                 44, 56,
                 { { 5, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 3 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, false) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 },
@@ -625,23 +625,23 @@ loopend:
                 56, 64,
                 { { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, false) },
-                    { { "sa", 3 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) }
+                    { { "sa", 3 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) }
                 }, false, false, true },
             {   // block 6 - j1
                 64, 68,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 2 }, SSAInfo(2, SIZE_MAX, 4, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(2, UINT32_MAX, 4, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 5, 5, 5, 1, false) }
                 }, false, false, false },
             {   // block 7 - loopend
                 68, 76,
                 { { 4, false }, { 8, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 8 - routine end
@@ -650,8 +650,8 @@ loopend:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true }
@@ -728,7 +728,7 @@ rend:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 5 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, true, false, false },
@@ -740,8 +740,8 @@ rend:
                 36, 56,
                 { { 4, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, false) },
@@ -751,10 +751,10 @@ rend:
                 56, 68,
                 { { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, false) },
-                    { { "sa", 3 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, false) }
                 },
                 false, false, true },
@@ -762,10 +762,10 @@ rend:
                 68, 76,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 2 }, SSAInfo(2, SIZE_MAX, 4, SIZE_MAX, 0, true) },
-                    { { "sa", 3 }, SSAInfo(2, SIZE_MAX, 4, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(2, UINT32_MAX, 4, UINT32_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(2, UINT32_MAX, 4, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, false) },
                     { { "sa", 5 }, SSAInfo(2, 4, 4, 4, 1, false) }
                 }, false, false, false },
@@ -775,8 +775,8 @@ rend:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true }
@@ -873,7 +873,7 @@ routine2:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, true, false, false },
@@ -881,7 +881,7 @@ routine2:
                 44, 68,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 5 }, SSAInfo(3, 6, 6, 6, 1, true) },
                     { { "sa", 6 }, SSAInfo(2, 3, 3, 3, 1, true) },
@@ -892,8 +892,8 @@ routine2:
                 68, 92,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, false) },
@@ -907,9 +907,9 @@ routine2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 2 }, SSAInfo(2, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(2, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
@@ -918,8 +918,8 @@ routine2:
                 108, 132,
                 { { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, false) },
@@ -1003,7 +1003,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                 {
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) }
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) }
                 }, false, false, false },
             // block 3 - first return
             { 72, 88,
@@ -1013,7 +1013,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
             // block 4 - second return
@@ -1024,7 +1024,7 @@ bb1:    s_and_b32 sa[2], sa[2], sa[4]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "sa", 4 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 4 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true }
         },
@@ -1130,7 +1130,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 28, 40,
                 { { 2, false }, { 3, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 6, 6, 6, 1, false) }
                 }, false, false, false },
@@ -1138,7 +1138,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 40, 52,
                 { { 4, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 5, 5, 5, 1, false) },
                     { { "sa", 5 }, SSAInfo(1, 5, 5, 5, 1, false) }
                 }, false, false, true },
@@ -1146,7 +1146,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 52, 64,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 6, 6, 6, 1, false) },
                     { { "sa", 6 }, SSAInfo(1, 7, 7, 7, 1, false) }
@@ -1164,15 +1164,15 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 68, 80,
                 { { 6, false }, { 7, false } },
                 {
-                    { { "sa", 3 }, SSAInfo(3, SIZE_MAX, 7, SIZE_MAX, 0, true) },
-                    { { "sa", 4 }, SSAInfo(2, SIZE_MAX, 6, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(3, UINT32_MAX, 7, UINT32_MAX, 0, true) },
+                    { { "sa", 4 }, SSAInfo(2, UINT32_MAX, 6, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 5, 5, 6, 2, false) }
                 }, false, false, false },
             {   // block 6 - end1
                 80, 88,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 7 }, SSAInfo(1, 5, 5, 5, 1, false) }
                 }, false, false, true },
             {   // block 7 - end2
@@ -1187,7 +1187,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1197,7 +1197,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
@@ -1211,7 +1211,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -1225,7 +1225,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -1323,7 +1323,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 24, 36,
                 { { 2, false }, { 3, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 6, 6, 6, 1, false) }
                 }, false, false, false },
@@ -1332,18 +1332,18 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 { },
                 {
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
-                    { { "sa", 3 }, SSAInfo(6, SIZE_MAX, 7, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(6, UINT32_MAX, 7, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 5, 5, 5, 1, false) },
-                    { { "sa", 5 }, SSAInfo(2, SIZE_MAX, 5, SIZE_MAX, 0, true) },
+                    { { "sa", 5 }, SSAInfo(2, UINT32_MAX, 5, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 5, 5, 5, 1, false) }
                 }, false, false, true },
             {   // block 3 - aa1
                 52, 72,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 8, 8, 9, 2, false) },
-                    { { "sa", 3 }, SSAInfo(6, SIZE_MAX, 7, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(6, UINT32_MAX, 7, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 6, 6, 6, 1, true) },
                     { { "sa", 6 }, SSAInfo(2, 6, 6, 6, 1, true) }
                 }, false, false, true },
@@ -1353,7 +1353,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1363,7 +1363,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
@@ -1376,7 +1376,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -1389,7 +1389,7 @@ bb2:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -1527,8 +1527,8 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 5, 5, 5, 1, false) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, true, false, false },
@@ -1541,11 +1541,11 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 48, 68,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(0, 4, 4, 4, 1, false) },
                     { { "sa", 7 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "va", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 1 }, SSAInfo(1, 4, 4, 4, 1, false) },
                     { { "va", 2 }, SSAInfo(1, 4, 4, 4, 1, false) }
                 }, false, false, true },
@@ -1553,46 +1553,46 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 68, 96,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(4, 6, 6, 6, 1, true) },
                     { { "sa", 6 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 7 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 8 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "va", 0 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "va", 1 }, SSAInfo(2, 5, 5, 5, 1, true) },
-                    { { "va", 2 }, SSAInfo(2, SIZE_MAX, 5, SIZE_MAX, 0, true) }
+                    { { "va", 2 }, SSAInfo(2, UINT32_MAX, 5, UINT32_MAX, 0, true) }
                 }, false, false, true },
             {   // block 6 - aa1
                 96, 116,
                 { { 7, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 7, 2, true) },
                     { { "sa", 3 }, SSAInfo(3, 6, 6, 6, 1, true) },
-                    { { "sa", 4 }, SSAInfo(2, SIZE_MAX, 4, SIZE_MAX, 0, true) },
+                    { { "sa", 4 }, SSAInfo(2, UINT32_MAX, 4, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 7, 7, 7, 1, true) }
                 }, false, false, false },
             {   // block 7 - aa4
                 116, 128,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, true) },
-                    { { "va", 0 }, SSAInfo(0, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(0, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "va", 1 }, SSAInfo(2, 6, 6, 6, 1, true) }
                 }, false, false, true },
             {   // block 8 - aa5
                 128, 136,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 5, 5, 5, 1, true) }
                 }, false, false, true },
             {   // block 9 - routine
                 136, 148,
                 { { 10, false }, { 11, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1602,12 +1602,12 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) },
-                    { { "va", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 1 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "va", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
@@ -1617,12 +1617,12 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 3, 3, 3, 1, true) },
-                    { { "va", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "va", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "va", 1 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "va", 2 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, true, true },
@@ -1630,7 +1630,7 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 204, 216,
                 { { 13, false }, { 14, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "sa", 7 }, SSAInfo(0, 1, 1, 1, 1, true) }
                 }, false, false, false },
@@ -1640,7 +1640,7 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 7 }, SSAInfo(1, 2, 2, 2, 1, true) },
@@ -1652,7 +1652,7 @@ bb3:    s_and_b32 sa[6], sa[6], sa[1]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 7 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -1737,7 +1737,7 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 12, 20,
                 { { 2, false }, { 4, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 1, 1, true) }
                 }, false, false, false },
             {   // block 2 - aa0
@@ -1753,15 +1753,15 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 24, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, false, false, true },
             {   // block 4 - aa1
                 32, 44,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
@@ -1769,7 +1769,7 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 44, 52,
                 { { 6, false }, { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 6 - bb0
@@ -1778,7 +1778,7 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 7 - bb1
@@ -1787,15 +1787,15 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 8 - routine2
                 68, 80,
                 { { 9, false }, { 10, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 5, 5, 5, 1, false) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1805,8 +1805,8 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, false) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
@@ -1816,8 +1816,8 @@ cc1:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 7, 7, 7, 1, false) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) }
                 }, false, true, true }
@@ -1886,8 +1886,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 4, 4, 4, 1, true) }
@@ -1896,8 +1896,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 32, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 5, 5, 5, 1, true) }
@@ -1906,7 +1906,7 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 48, 56,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1914,8 +1914,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 56, 72,
                 { { 4, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -1926,8 +1926,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true }
@@ -2007,8 +2007,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, true, false, false },
@@ -2030,8 +2030,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                 32, 44,
                 { { 5, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -2041,8 +2041,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
@@ -2052,8 +2052,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) }
                 }, false, true, true },
@@ -2061,8 +2061,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                 68, 80,
                 { { 8, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(5, 6, 6, 6, 1, true) }
                 }, false, false, false },
@@ -2072,8 +2072,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) }
                 }, false, true, true },
@@ -2083,8 +2083,8 @@ aa1:    s_and_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 8, 8, 8, 1, true) }
                 }, false, true, true }
@@ -2183,8 +2183,8 @@ subr2:
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 6, 6, 6, 1, true) },
@@ -2195,7 +2195,7 @@ subr2:
                 48, 64,
                 { { 3, false }, { 10, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -2204,28 +2204,28 @@ subr2:
                 64, 72,
                 { { 4, false }, { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - to end2
                 72, 80,
                 { { 5, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - to end3
                 80, 88,
                 { { 6, false }, { 9, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 6 - loop end
                 88, 96,
                 { { 3, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, true },
             {   // block 7 - end1
@@ -2234,7 +2234,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 8 - end2
@@ -2243,7 +2243,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 9 - end3
@@ -2252,15 +2252,15 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 10 - subr1
                 120, 144,
                 { { 3, false }, { 11, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -2273,8 +2273,8 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(4, 5, 5, 5, 1, true) },
@@ -2397,8 +2397,8 @@ subr3:
                 28, 56,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 7, 7, 7, 1, true) },
@@ -2410,7 +2410,7 @@ subr3:
                 56, 72,
                 { { 3, false }, { 11, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -2419,35 +2419,35 @@ subr3:
                 72, 80,
                 { { 4, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - to end2
                 80, 88,
                 { { 5, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - to end3
                 88, 96,
                 { { 6, false }, { 10, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 6 - loop1 end
                 96, 104,
                 { { 3, false }, { 7, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 7 - loop0 end
                 104, 112,
                 { { 2, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
             {   // block 8 - end1
@@ -2456,7 +2456,7 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 9 - end2
@@ -2465,7 +2465,7 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 10 - end3
@@ -2474,15 +2474,15 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 11 - subr1
                 136, 164,
                 { { 2, false }, { 12, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -2494,8 +2494,8 @@ subr3:
                 164, 192,
                 { { 3, false }, { 13, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(4, 5, 5, 5, 1, true) },
@@ -2509,8 +2509,8 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(5, 6, 6, 6, 1, true) },
@@ -2636,8 +2636,8 @@ subr3:
                 28, 56,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 7, 7, 7, 1, true) },
@@ -2653,7 +2653,7 @@ subr3:
                 60, 76,
                 { { 4, false }, { 12, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -2662,35 +2662,35 @@ subr3:
                 76, 84,
                 { { 5, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - to end2
                 84, 92,
                 { { 6, false }, { 10, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 6 - to end3
                 92, 100,
                 { { 7, false }, { 11, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 7 - loop1 end
                 100, 108,
                 { { 4, false }, { 8, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 8 - loop0 end
                 108, 116,
                 { { 3, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
             {   // block 9 - end1
@@ -2699,7 +2699,7 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 10 - end2
@@ -2708,7 +2708,7 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 11 - end3
@@ -2717,15 +2717,15 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 12 - subr1
                 140, 168,
                 { { 3, false }, { 13, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -2737,8 +2737,8 @@ subr3:
                 168, 196,
                 { { 4, false }, { 14, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(4, 5, 5, 5, 1, true) },
@@ -2752,8 +2752,8 @@ subr3:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(5, 6, 6, 6, 1, true) },
@@ -2840,8 +2840,8 @@ end3:   s_xor_b32 sa[4], sa[4], sa[0]
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -2852,28 +2852,28 @@ end3:   s_xor_b32 sa[4], sa[4], sa[0]
                 48, 56,
                 { { 3, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 3 - to end2
                 56, 64,
                 { { 4, false }, { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 4 - to end3
                 64, 72,
                 { { 5, false }, { 8, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 5 - loop end
                 72, 80,
                 { { 2, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
             {   // block 6 - end1
@@ -2882,7 +2882,7 @@ end3:   s_xor_b32 sa[4], sa[4], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 7 - end2
@@ -2891,7 +2891,7 @@ end3:   s_xor_b32 sa[4], sa[4], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 8 - end3
@@ -2900,7 +2900,7 @@ end3:   s_xor_b32 sa[4], sa[4], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true }
         },
@@ -3036,8 +3036,8 @@ subr2:
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 10, 10, 10, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 10, 10, 10, 1, true) },
@@ -3048,7 +3048,7 @@ subr2:
                 48, 64,
                 { { 3, false }, { 18, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -3057,35 +3057,35 @@ subr2:
                 64, 72,
                 { { 4, false }, { 12, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - to end2
                 72, 80,
                 { { 5, false }, { 13, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - to end3
                 80, 88,
                 { { 6, false }, { 14, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 6 - loop0 end
                 88, 96,
                 { { 3, false }, { 7, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 7 - after loop0
                 96, 112,
                 { { 8, false }, { 19, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -3094,28 +3094,28 @@ subr2:
                 112, 120,
                 { { 9, false }, { 15, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, false },
             {   // block 9 - to end5
                 120, 128,
                 { { 10, false }, { 16, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, false },
             {   // block 10 - to end6
                 128, 136,
                 { { 11, false }, { 17, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 11 - loop1 end
                 136, 144,
                 { { 8, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(4, 5, 5, 5, 1, true) }
                 }, false, false, true },
             {   // block 12 - end1
@@ -3124,7 +3124,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) }
                 }, false, true, true },
             {   // block 13 - end2
@@ -3133,7 +3133,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 8, 8, 8, 1, true) }
                 }, false, true, true },
             {   // block 14 - end3
@@ -3142,7 +3142,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 8, 8, 8, 1, true) }
                 }, false, true, true },
             {   // block 15 - end4
@@ -3151,7 +3151,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(4, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 16 - end5
@@ -3160,7 +3160,7 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(4, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 17 - end6
@@ -3169,15 +3169,15 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 18 - subr1
                 192, 216,
                 { { 3, false }, { 19, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 9, 9, 9, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 9, 9, 9, 1, true) },
@@ -3188,8 +3188,8 @@ subr2:
                 216, 240,
                 { { 8, false }, { 20, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(4, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 6, 6, 6, 1, true) },
@@ -3202,8 +3202,8 @@ subr2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(6, 7, 7, 7, 1, true) },
@@ -3347,8 +3347,8 @@ subr1:
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 9, 9, 9, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 9, 9, 9, 1, true) },
@@ -3359,7 +3359,7 @@ subr1:
                 48, 64,
                 { { 3, false }, { 19, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -3368,63 +3368,63 @@ subr1:
                 64, 72,
                 { { 4, false }, { 13, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - to end2
                 72, 80,
                 { { 5, false }, { 14, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - before loop1
                 80, 84,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 6 - loop1
                 84, 92,
                 { { 7, false }, { 16, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 7 - to end5
                 92, 100,
                 { { 8, false }, { 17, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 8 - to end6
                 100, 108,
                 { { 9, false }, { 18, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 9 - loop1 end
                 108, 116,
                 { { 6, false }, { 10, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, false },
             {   // block 10 - to end3
                 116, 124,
                 { { 11, false }, { 15, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 11 - loop0 end
                 124, 132,
                 { { 3, false }, { 12, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, false },
             {   // block 12 - routine end
@@ -3440,7 +3440,7 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 14 - end2
@@ -3449,7 +3449,7 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 15 - end3
@@ -3458,7 +3458,7 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 16 - end4
@@ -3467,7 +3467,7 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 17 - end5
@@ -3476,7 +3476,7 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 18 - end6
@@ -3485,15 +3485,15 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 19 - subr1
                 184, 208,
                 { { 3, false }, { 20, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 6, 6, 6, 1, true) },
@@ -3504,8 +3504,8 @@ subr1:
                 208, 232,
                 { { 6, false }, { 21, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(6, 7, 7, 7, 1, true) },
@@ -3518,8 +3518,8 @@ subr1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(7, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(7, 8, 8, 8, 1, true) },
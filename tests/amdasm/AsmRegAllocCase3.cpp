@@ -161,7 +161,7 @@ r5a1:
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 9, 9, 9, 1, true) },
@@ -176,7 +176,7 @@ r5a1:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, true, false, false },
             {   // block 3 - jump a1,a2,a3
@@ -194,7 +194,7 @@ r5a1:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, true, false, false },
             {   // block 5 - a1 end
@@ -212,7 +212,7 @@ r5a1:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 5, 5, 5, 1, true) }
                 }, true, false, false },
             {   // block 7 - e0
@@ -223,8 +223,8 @@ r5a1:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 4 }, SSAInfo(3, SIZE_MAX, 6, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 4 }, SSAInfo(3, UINT32_MAX, 6, UINT32_MAX, 0, true) },
                     { { "sa", 7 }, SSAInfo(0, 1, 1, 2, 2, false) }
                 }, true, false, false },
             {   // block 8 - a2 end
@@ -242,7 +242,7 @@ r5a1:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, true, false, false },
             {   // block 10 - a3 end
@@ -254,7 +254,7 @@ r5a1:
                 108, 116,
                 { { 12, false }, { 13, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 12 - ret1
@@ -263,7 +263,7 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 13 - ret2
@@ -272,15 +272,15 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 2 }, SSAInfo(2, SIZE_MAX, 4, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 2 }, SSAInfo(2, UINT32_MAX, 4, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, false) }
                 }, false, true, true },
             {   // block 14 - routine2
                 132, 140,
                 { { 15, false }, { 16, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 4, 4, 4, 1, true) }
                 }, false, false, false },
             {   // block 15 - ret1
@@ -289,7 +289,7 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 16 - ret2
@@ -298,14 +298,14 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
             {   // block 17 - routine3
                 156, 164,
                 { { 18, false }, { 19, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 18 - ret1
@@ -314,7 +314,7 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 4, 4, 4, 1, false) }
                 }, false, true, true },
@@ -324,15 +324,15 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, false) },
-                    { { "sa", 5 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) }
+                    { { "sa", 5 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) }
                 }, false, true, true },
             {   // block 20 - routine4
                 184, 192,
                 { { 21, false }, { 22, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 7, 7, 7, 1, true) }
                 }, false, false, false },
             {   // block 21 - ret1
@@ -341,7 +341,7 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(7, 8, 8, 8, 1, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
@@ -351,14 +351,14 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, false, true, true },
             {   // block 23 - routine5
                 212, 220,
                 { { 24, false }, { 25, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(3, 6, 6, 6, 1, true) }
                 }, false, false, false },
             {   // block 24 - ret1
@@ -367,7 +367,7 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 6, 6, 6, 1, true) }
                 }, false, true, true },
             {   // block 25 - ret2
@@ -376,7 +376,7 @@ r5a1:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true }
         },
@@ -462,15 +462,15 @@ bb2:    s_and_b32 sa[3], sa[3], sa[0]
                 24, 36,
                 { { 2, false }, { 3, false } },
                 {
-                    { { "sa", 3 }, SSAInfo(3, SIZE_MAX, 6, SIZE_MAX, 0, true) },
-                    { { "sa", 4 }, SSAInfo(2, SIZE_MAX, 5, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(3, UINT32_MAX, 6, UINT32_MAX, 0, true) },
+                    { { "sa", 4 }, SSAInfo(2, UINT32_MAX, 5, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 5, 5, 6, 2, false) }
                 }, false, false, false },
             {   // block 2 - aa2
                 36, 44,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 7 }, SSAInfo(1, 5, 5, 5, 1, false) }
                 }, false, false, true },
             {   // block 3 - aa3
@@ -486,7 +486,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -496,7 +496,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) },
@@ -508,7 +508,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -520,7 +520,7 @@ bb2:    s_and_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -593,7 +593,7 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -604,8 +604,8 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 48, 60,
                 { { 3, false }, { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -613,21 +613,21 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 60, 64,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - l0
                 64, 68,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 5 - l1
                 68, 76,
                 { { 3, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 6 - ret
@@ -642,14 +642,14 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 80, 88,
                 { { 4, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 8 - jump to l1
                 88, 96,
                 { { 5, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true }
         },
@@ -731,7 +731,7 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -742,8 +742,8 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 48, 60,
                 { { 3, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -751,21 +751,21 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 60, 64,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - l0
                 64, 72,
                 { { 5, false }, { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 5 - l1
                 72, 80,
                 { { 6, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 6 - loop end
@@ -779,7 +779,7 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
             {   // block 8 - end2
@@ -788,22 +788,22 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, false) }
                 }, false, true, true },
             {   // block 9 - b0
                 100, 108,
                 { { 4, false }, { 10, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 10 - to l1
                 108, 116,
                 { { 5, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, true }
         },
@@ -885,7 +885,7 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -898,7 +898,7 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
             {   // block 3 - end2
@@ -907,16 +907,16 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, false) }
                 }, false, true, true },
             {   // block 4 - routine
                 64, 76,
                 { { 5, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -924,21 +924,21 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 76, 80,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 6 - l0
                 80, 88,
                 { { 2, false }, { 7, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 7 - l1
                 88, 96,
                 { { 3, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 8 - loop end
@@ -950,14 +950,14 @@ b0:     s_xor_b32 sa[5], sa[5], sa[0]
                 100, 108,
                 { { 6, false }, { 10, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 10 - to l1
                 108, 116,
                 { { 7, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, true }
         },
@@ -1023,7 +1023,7 @@ routine2:
                 16, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1032,8 +1032,8 @@ routine2:
                 32, 44,
                 { { 3, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1059,7 +1059,7 @@ routine2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 6 - routine2
@@ -1068,8 +1068,8 @@ routine2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, false) }
                 }, false, true, true }
         },
@@ -1132,7 +1132,7 @@ routine2:
                 16, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1143,15 +1143,15 @@ routine2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
             {   // block 3 - routine
                 40, 52,
                 { { 2, false }, { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1177,8 +1177,8 @@ routine2:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, false) }
                 }, false, true, true }
         },
@@ -1240,7 +1240,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 16, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 6 }, SSAInfo(2, 4, 4, 4, 1, true) }
@@ -1249,8 +1249,8 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 32, 44,
                 { { 3, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1269,7 +1269,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
@@ -1279,7 +1279,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1373,8 +1373,8 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(6, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) },
@@ -1385,8 +1385,8 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 48, 60,
                 { { 3, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1405,8 +1405,8 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(4, 6, 6, 6, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 6 }, SSAInfo(2, 4, 4, 4, 1, true) }
@@ -1417,7 +1417,7 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 7, 7, 7, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 5, 5, 5, 1, true) }
@@ -1426,8 +1426,8 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 96, 108,
                 { { 7, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
@@ -1446,8 +1446,8 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -1458,7 +1458,7 @@ b1:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1538,7 +1538,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 16, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 4, 4, 4, 1, true) }
@@ -1547,8 +1547,8 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 32, 44,
                 { { 3, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1569,7 +1569,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, true, false, false },
@@ -1579,7 +1579,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true ,true },
             {   // block 6 - routine end 2
@@ -1588,7 +1588,7 @@ b0:     s_xor_b32 sa[3], sa[3], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1647,7 +1647,7 @@ b0:     s_add_u32 sa[2], sa[2], sa[0]
                 16, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1656,7 +1656,7 @@ b0:     s_add_u32 sa[2], sa[2], sa[0]
                 32, 40,
                 { { 3, false }, { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 3 - routine end 1
@@ -1665,14 +1665,14 @@ b0:     s_add_u32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
             {   // block 4 - routine end 2
                 48, 64,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -1727,7 +1727,7 @@ b0:     s_add_u32 sa[2], sa[2], sa[0]
                 16, 32,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) }
@@ -1736,21 +1736,21 @@ b0:     s_add_u32 sa[2], sa[2], sa[0]
                 32, 40,
                 { { 3, false }, { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 3 - routine end 1
                 40, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
             {   // block 4 - routine end 2
                 48, 64,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -1817,7 +1817,7 @@ b2:     s_add_u32 sa[5], sa[5], sa[0]
                 20, 40,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 4, 4, 4, 1, true) },
@@ -1829,7 +1829,7 @@ b2:     s_add_u32 sa[5], sa[5], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 3 - routine end 1
@@ -1838,14 +1838,14 @@ b2:     s_add_u32 sa[5], sa[5], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true },
             {   // block 4 - routine end 2
                 56, 72,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -1854,14 +1854,14 @@ b2:     s_add_u32 sa[5], sa[5], sa[0]
                 72, 80,
                 { { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, true },
             {   // block 6 - b2
                 80, 88,
                 { { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
         },
@@ -1929,8 +1929,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 4, 4, 4, 1, true) }
@@ -1939,8 +1939,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 32, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 5, 5, 5, 1, true) }
@@ -1951,8 +1951,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
@@ -1960,7 +1960,7 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 60, 68,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -1970,8 +1970,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -2041,8 +2041,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, true) }
@@ -2051,8 +2051,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 32, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 5, 5, 5, 1, true) }
@@ -2061,7 +2061,7 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 48, 56,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -2069,8 +2069,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 56, 72,
                 { { 4, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -2079,8 +2079,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 72, 84,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, true }
@@ -2152,8 +2152,8 @@ routine:
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
@@ -2162,8 +2162,8 @@ routine:
                 32, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 5, 5, 5, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 6, 6, 6, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, true) }
@@ -2172,7 +2172,7 @@ routine:
                 48, 60,
                 { { 4, false }, { 5, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, false },
@@ -2187,7 +2187,7 @@ routine:
                 64, 72,
                 { },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(4, 5, 5, 5, 1, true) }
                 }, false, false, false },
@@ -2197,8 +2197,8 @@ routine:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true }
@@ -2316,8 +2316,8 @@ r2b0:
                 24, 48,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 9, 9, 9, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 9, 9, 9, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 7, 7, 7, 1, true) },
@@ -2328,7 +2328,7 @@ r2b0:
                 48, 64,
                 { { 3, false }, { 11, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 2, 2, 2, 1, true) }
@@ -2337,21 +2337,21 @@ r2b0:
                 64, 72,
                 { { 4, false }, { 8, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 4 - to end2
                 72, 80,
                 { { 5, false }, { 9, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - to end3
                 80, 88,
                 { { 6, false }, { 10, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
             {   // block 6 - call routine
@@ -2367,7 +2367,7 @@ r2b0:
                 92, 100,
                 { { 3, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(2, 4, 4, 4, 1, true) }
                 }, false, false, true },
             {   // block 8 - end1
@@ -2376,7 +2376,7 @@ r2b0:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 6, 6, 6, 1, true) }
                 }, false, true, true },
             {   // block 9 - end2
@@ -2385,7 +2385,7 @@ r2b0:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 6, 6, 6, 1, true) }
                 }, false, true, true },
             {   // block 10 - end3
@@ -2394,15 +2394,15 @@ r2b0:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 11 - subr1
                 124, 148,
                 { { 3, false }, { 12, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 7, 7, 7, 1, true) },
                     { { "sa", 3 }, SSAInfo(2, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 5, 5, 5, 1, true) },
@@ -2415,8 +2415,8 @@ r2b0:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(7, 8, 8, 8, 1, true) },
                     { { "sa", 3 }, SSAInfo(7, 8, 8, 8, 1, true) },
                     { { "sa", 4 }, SSAInfo(5, 6, 6, 6, 1, true) },
@@ -2427,8 +2427,8 @@ r2b0:
                 172, 184,
                 { { 14, false }, { 15, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, false) }
                 }, false, false, false },
@@ -2438,8 +2438,8 @@ r2b0:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 5 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true },
@@ -2449,8 +2449,8 @@ r2b0:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
                 }, false, true, true }
@@ -2500,7 +2500,7 @@ b0:     s_xor_b32 sa[2], sa[2], sa[0]
                 8, 16,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, true },
             {   // block 2 - a1 (routine call)
@@ -2520,7 +2520,7 @@ b0:     s_xor_b32 sa[2], sa[2], sa[0]
                 24, 32,
                 { { 5, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
             {   // block 5 - routine end 1
@@ -2529,7 +2529,7 @@ b0:     s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, true, true },
             {   // block 6 - routine end 2
@@ -2538,7 +2538,7 @@ b0:     s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 5, 5, 5, 1, true) }
                 }, false, true, true }
         },
@@ -2593,8 +2593,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, false) },
                     { { "", 2 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 3 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, true) }
@@ -2603,8 +2603,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 20, 36,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 4, 4, 4, 1, true) }
@@ -2613,8 +2613,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 36, 52,
                 { { 3, false }, { 4, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "sa", 3 }, SSAInfo(0, 1, 1, 1, 1, true) },
                     { { "sa", 4 }, SSAInfo(0, 1, 1, 1, 1, true) }
@@ -2625,8 +2625,8 @@ loop0:  s_xor_b32 sa[2], sa[2], sa[0]
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, true, true }
@@ -2796,8 +2796,8 @@ a3loop:
                 44, 88,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 3 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(3, 4, 4, 4, 1, true) },
@@ -2815,7 +2815,7 @@ a3loop:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 2, 2, 2, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 2, 2, 2, 1, true) }
                 }, false, false, false },
@@ -2823,17 +2823,17 @@ a3loop:
                 100, 112,
                 { { 1, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 3, 3, 3, 1, true) },
-                    { { "sa", 3 }, SSAInfo(1, SIZE_MAX, 2, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(1, UINT32_MAX, 2, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 3, 3, 3, 1, false) }
                 }, false, false, true },
             {   // block 4 - a00
                 112, 124,
                 { { 3, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(2, 5, 5, 5, 1, true) }
                 }, false, false, true },
@@ -2841,10 +2841,10 @@ a3loop:
                 124, 136,
                 { { 3, false }, { 6, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(2, 6, 6, 6, 1, false) },
-                    { { "sa", 3 }, SSAInfo(1, SIZE_MAX, 3, SIZE_MAX, 0, true) },
+                    { { "sa", 3 }, SSAInfo(1, UINT32_MAX, 3, UINT32_MAX, 0, true) },
                     { { "sa", 4 }, SSAInfo(2, 6, 6, 6, 1, true) }
                 }, false, false, false },
             {   // block 6 - a02
@@ -2853,8 +2853,8 @@ a3loop:
                 {
                     { { "", 0 }, SSAInfo(0, 0, 0, 0, 0, true) },
                     { { "", 1 }, SSAInfo(0, 0, 0, 0, 0, true) },
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(6, 7, 7, 7, 1, true) },
                     { { "sa", 4 }, SSAInfo(6, 7, 7, 7, 1, true) }
                 }, false, false, true },
@@ -2862,8 +2862,8 @@ a3loop:
                 148, 156,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 5 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
@@ -2871,8 +2871,8 @@ a3loop:
                 156, 172,
                 { { 9, false }, { 13, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 5 }, SSAInfo(3, 4, 4, 5, 2, true) }
                 }, false, false, false },
@@ -2880,8 +2880,8 @@ a3loop:
                 172, 184,
                 { { 10, false }, { 14, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 4 }, SSAInfo(1, 8, 8, 8, 1, false) }
                 }, false, false, false },
@@ -2889,7 +2889,7 @@ a3loop:
                 184, 200,
                 { { 9, false }, { 11, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 2 }, SSAInfo(1, 8, 8, 8, 1, false) },
                     { { "sa", 3 }, SSAInfo(5, 6, 6, 6, 1, true) },
                     { { "sa", 5 }, SSAInfo(5, 6, 6, 6, 1, true) }
@@ -2898,28 +2898,28 @@ a3loop:
                 200, 208,
                 { { 8, false }, { 12, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(6, 7, 7, 7, 1, true) }
                 }, false, false, false },
             {   // block 12 - a1 end
                 208, 216,
                 { { 1, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(6, 7, 7, 7, 1, true) }
                 }, false, false, true },
             {   // block 13 - a1end0
                 216, 224,
                 { { 1, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 3 }, SSAInfo(4, 8, 8, 8, 1, true) }
                 }, false, false, true },
             {   // block 14 - a1end1
                 224, 232,
                 { { 8, false }, { 15, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(5, 8, 8, 8, 1, true) }
                 }, false, false, false },
             {   // block 15 - jump to end
@@ -2930,8 +2930,8 @@ a3loop:
                 236, 244,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 7 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
@@ -2939,8 +2939,8 @@ a3loop:
                 244, 252,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 7 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, false },
@@ -2948,8 +2948,8 @@ a3loop:
                 252, 264,
                 { { 18, false }, { 19, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 8 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 9 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
@@ -2957,22 +2957,22 @@ a3loop:
                 264, 272,
                 { { 19, false }, { 20, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 5 }, SSAInfo(1, 9, 9, 9, 1, true) }
                 }, false, false, false },
             {   // block 20 - a2loop0 end
                 272, 280,
                 { { 17, false }, { 21, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 7 }, SSAInfo(4, 5, 5, 5, 1, true) }
                 }, false, false, false },
             {   // block 21 - a2loop3
                 280, 288,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 6 }, SSAInfo(4, 5, 5, 5, 1, true) },
                     { { "sa", 7 }, SSAInfo(5, 6, 6, 6, 1, true) }
                 }, false, false, false },
@@ -2980,8 +2980,8 @@ a3loop:
                 288, 300,
                 { { 17, false }, { 23, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 8 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 9 }, SSAInfo(3, 4, 4, 4, 1, false) }
                 }, false, false, false },
@@ -2993,9 +2993,9 @@ a3loop:
                 304, 312,
                 { { 21, false }, { 25, false } },
                 {
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 7 }, SSAInfo(6, 7, 7, 7, 1, false) },
-                    { { "sa", 9 }, SSAInfo(4, SIZE_MAX, 5, SIZE_MAX, 0, true) }
+                    { { "sa", 9 }, SSAInfo(4, UINT32_MAX, 5, UINT32_MAX, 0, true) }
                 }, false, false, false },
             {   // block 25 - to end
                 312, 316,
@@ -3005,8 +3005,8 @@ a3loop:
                 316, 324,
                 { },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 10 }, SSAInfo(1, 3, 3, 3, 1, true) },
                     { { "sa", 11 }, SSAInfo(1, 3, 3, 3, 1, true) }
                 }, false, false, false },
@@ -3014,8 +3014,8 @@ a3loop:
                 324, 336,
                 { { 27, false } },
                 {
-                    { { "sa", 0 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
-                    { { "sa", 1 }, SSAInfo(0, SIZE_MAX, 1, SIZE_MAX, 0, true) },
+                    { { "sa", 0 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
+                    { { "sa", 1 }, SSAInfo(0, UINT32_MAX, 1, UINT32_MAX, 0, true) },
                     { { "sa", 10 }, SSAInfo(3, 4, 4, 4, 1, true) },
                     { { "sa", 11 }, SSAInfo(3, 4, 4, 4, 1, true) }
                 }, false, false, true }
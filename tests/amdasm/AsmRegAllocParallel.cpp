@@ -0,0 +1,147 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+/* allocating registers of code sections in parallel must give same results
+ * as allocating serially */
+
+struct RegAllocResult
+{
+    cxuint sectionId;
+    cxuint regsNums[2];
+    std::vector<cxuint> colorMaps[2];
+};
+
+static std::string generateSource(cxuint kernelsNum)
+{
+    std::ostringstream oss;
+    for (cxuint k = 0; k < kernelsNum; k++)
+        oss << ".kernel kernel" << k << "\n"
+            "    .config\n"
+            "        .dims x\n";
+    for (cxuint k = 0; k < kernelsNum; k++)
+    {
+        oss << ".kernel kernel" << k << "\n"
+            "    .text\n"
+            "    .regvar sa" << k << ":s:4, va" << k << ":v:4\n"
+            "    s_mov_b32 sa" << k << "[0], s1\n"
+            "    s_add_u32 sa" << k << "[1], sa" << k << "[0], " << k << "\n"
+            "    v_mov_b32 va" << k << "[0], sa" << k << "[1]\n";
+        for (cxuint i = 0; i < k; i++)
+            oss << "    v_add_f32 va" << k << "[" << ((i+1)&3) << "], "
+                "va" << k << "[" << (i&3) << "], v1\n";
+        oss << "    s_endpgm\n";
+    }
+    return oss.str();
+}
+
+static std::vector<RegAllocResult> allocateRegisters(Assembler& assembler,
+            AsmRegAllocMode mode, cxuint threadsNum)
+{
+    assembler.setRegAllocMode(mode);
+    assembler.setRegAllocThreadsNum(threadsNum);
+    assembler.allocateRegisters();
+
+    std::vector<RegAllocResult> results;
+    for (cxuint i = 0; i < assembler.getSections().size(); i++)
+    {
+        const AsmRegAllocator* regAlloc = assembler.getRegAllocator(i);
+        const AsmSection& section = assembler.getSections()[i];
+        assertTrue("AsmRegAllocParallel", "allocator",
+                   (regAlloc != nullptr) == (section.usageHandler != nullptr));
+        if (regAlloc == nullptr)
+            continue;
+        RegAllocResult result;
+        result.sectionId = i;
+        for (cxuint regType = 0; regType < 2; regType++)
+        {
+            result.regsNums[regType] = regAlloc->getRegistersNum(regType);
+            const Array<cxuint>& colorMap = regAlloc->getGraphColorMap(regType);
+            result.colorMaps[regType].assign(colorMap.begin(), colorMap.end());
+        }
+        results.push_back(result);
+    }
+    return results;
+}
+
+static void testParallelRegAlloc(cxuint kernelsNum)
+{
+    std::istringstream input(generateSource(kernelsNum));
+    std::ostringstream msgStream;
+    // usages of registers are recorded only in test run
+    Assembler assembler("test.s", input,
+                (ASM_ALL&~ASM_ALTMACRO) | ASM_TESTRUN | ASM_TESTRESOLVE,
+                BinaryFormat::AMD, GPUDeviceType::PITCAIRN, msgStream);
+    assertTrue("AsmRegAllocParallel", "good", assembler.assemble());
+    
+    for (AsmRegAllocMode mode: { AsmRegAllocMode::GRAPH_COLORING,
+                AsmRegAllocMode::LINEAR_SCAN })
+    {
+        std::ostringstream oss;
+        oss << "kernels" << kernelsNum << ".mode" << cxuint(mode);
+        const std::string testName = oss.str();
+        const std::vector<RegAllocResult> expected =
+                allocateRegisters(assembler, mode, 1);
+        assertValue("AsmRegAllocParallel", testName+".sectionsNum",
+                    size_t(kernelsNum), expected.size());
+        for (const RegAllocResult& result: expected)
+            // every kernel uses scalar and vector registers
+            assertTrue("AsmRegAllocParallel", testName+".allocated",
+                    result.regsNums[0] != 0 && result.regsNums[1] != 0);
+        for (cxuint threadsNum: { 0U, 3U, 8U })
+        {
+            const std::vector<RegAllocResult> results =
+                    allocateRegisters(assembler, mode, threadsNum);
+            assertValue("AsmRegAllocParallel", testName+".resultsNum",
+                        expected.size(), results.size());
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                assertValue("AsmRegAllocParallel", testName+".sectionId",
+                            expected[i].sectionId, results[i].sectionId);
+                for (cxuint regType = 0; regType < 2; regType++)
+                {
+                    assertValue("AsmRegAllocParallel", testName+".regsNum",
+                            expected[i].regsNums[regType], results[i].regsNums[regType]);
+                    assertTrue("AsmRegAllocParallel", testName+".colorMap",
+                            expected[i].colorMaps[regType] ==
+                                results[i].colorMaps[regType]);
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testParallelRegAlloc, 1);
+    retVal |= callTest(testParallelRegAlloc, 12);
+    return retVal;
+}
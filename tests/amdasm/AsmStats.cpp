@@ -0,0 +1,84 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <sstream>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+static const char* statsSource = R"ffDXD(.rawcode
+.macro addx dst, src
+    s_add_u32 \dst, \src, 1
+.endm
+    addx s1, s2
+    addx s3, s4
+    s_mov_b32 s1, sym+1
+    .int sym2, 3+4
+sym = 5
+sym2 = sym*2
+label:
+    s_nop 0
+)ffDXD";
+
+static void testStats(bool enabled)
+{
+    std::ostringstream msgStream;
+    std::istringstream input(statsSource);
+    Assembler assembler("test.s", input, ASM_WARNINGS, BinaryFormat::RAWCODE,
+                GPUDeviceType::PITCAIRN, msgStream);
+    assembler.setStatsEnabled(enabled);
+    assertTrue("AsmStats", "good", assembler.assemble());
+    Array<cxbyte> binary;
+    assembler.writeBinary(binary);
+    const AsmStats& stats = assembler.getStats();
+    // counters are updated always
+    assertValue("AsmStats", "linesNum", size_t(14), stats.linesNum);
+    assertValue("AsmStats", "macroExpansionsNum", size_t(2), stats.macroExpansionsNum);
+    assertValue("AsmStats", "deferredExprsNum", size_t(2), stats.deferredExprsNum);
+    assertValue("AsmStats", "symbolsNum", size_t(3), stats.symbolsNum);
+    // times are measured only if statistics are enabled
+    const uint64_t times[7] = { stats.lineReadingTime, stats.macroExpansionTime,
+            stats.pseudoOpTime, stats.instrEncodingTime, stats.exprEvaluationTime,
+            stats.symbolResolvingTime, stats.binaryGenTime };
+    uint64_t timesSum = 0;
+    for (cxuint i = 0; i < 7; i++)
+    {
+        if (!enabled)
+            assertValue("AsmStats", (std::string("time#")+std::to_string(i)).c_str(),
+                   uint64_t(0), times[i]);
+        timesSum += times[i];
+    }
+    // single phase can be shorter than resolution of clock, hence checks only sum
+    if (enabled)
+        assertTrue("AsmStats", "timesSum", timesSum != 0);
+    // no register allocation in assembler
+    assertValue("AsmStats", "regAllocTime", uint64_t(0), stats.regAllocTime);
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testStats, false);
+    retVal |= callTest(testStats, true);
+    return retVal;
+}
@@ -0,0 +1,104 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef __CLRXTEST_ASMTESTUTILS_H__
+#define __CLRXTEST_ASMTESTUTILS_H__
+
+#include <CLRX/Config.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <memory>
+#include <algorithm>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/Containers.h>
+#include <CLRX/amdasm/Assembler.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+/* helpers for tests which assemble sources with files (caches and libraries) */
+
+// write file with content
+static inline void writeFile(const std::string& filename, const char* content)
+{
+    std::ofstream ofs(filename.c_str(), std::ios::binary);
+    ofs << content;
+}
+
+// create directory if it does not exist and remove its files
+static inline void prepareDir(const std::string& dirname)
+{
+    if (!isFileExists(dirname.c_str()))
+        makeDir(dirname.c_str());
+    for (const std::string& name: listDirectory(dirname.c_str()))
+        std::remove(joinPaths(dirname, name).c_str());
+}
+
+struct AsmResult
+{
+    bool good;
+    bool cacheHit;
+    std::string messages;
+    std::string printed;
+    Array<cxbyte> binary;
+    size_t loadedMacrosNum;
+};
+
+/* assemble source (or file if source is null) for PITCAIRN,
+ * setup prepares assembler before assembling */
+template<typename Setup>
+static AsmResult assembleSource(const char* filename, const char* source,
+            BinaryFormat format, Setup setup)
+{
+    std::ostringstream msgStream, printStream;
+    std::unique_ptr<Assembler> assembler;
+    std::istringstream input(source == nullptr ? "" : source);
+    if (source != nullptr)
+        assembler.reset(new Assembler(filename, input, ASM_WARNINGS,
+                    format, GPUDeviceType::PITCAIRN, msgStream, printStream));
+    else
+    {
+        Array<CString> filenames(1);
+        filenames[0] = filename;
+        assembler.reset(new Assembler(filenames, ASM_WARNINGS,
+                    format, GPUDeviceType::PITCAIRN, msgStream, printStream));
+    }
+    setup(*assembler);
+    AsmResult result;
+    result.good = assembler->assemble();
+    result.cacheHit = assembler->isCacheHit();
+    if (result.good)
+        assembler->writeBinary(result.binary);
+    result.messages = msgStream.str();
+    result.printed = printStream.str();
+    result.loadedMacrosNum = assembler->getLoadedLibraryMacrosNum();
+    return result;
+}
+
+// return true if results have same binaries
+static inline bool isSameBinary(const AsmResult& expected, const AsmResult& result)
+{
+    return expected.binary.size() == result.binary.size() &&
+            std::equal(expected.binary.begin(), expected.binary.end(),
+                       result.binary.begin());
+}
+
+#endif
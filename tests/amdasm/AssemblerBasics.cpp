@@ -154,6 +154,94 @@ static void testAssembler(cxuint testSuiteId, cxuint testId, const AsmTestCase&
     assertString(testName, "printMessages", testCase.printMessages, printMsgs);
 }
 
+/* unresolved symbols are reported in order of first use, and only symbols
+ * which can be unresolved are held by scopes as pending */
+static void testUnresolvedSymbols()
+{
+    std::istringstream input(R"ffDXD(        .byte b, a+1
+        .scope sc
+        .byte c, ::d
+        .ends
+lab:    .byte lab, lab2
+        x = e+2
+        .byte x, b
+lab2:   .byte 1f
+1:      .byte 2
+        y = 3
+        .eqv w, y+1
+        .undef y
+        .byte w)ffDXD");
+    std::ostringstream errorStream;
+    std::ostringstream printStream;
+    Assembler assembler("test.s", input,
+            (ASM_ALL|ASM_TESTRUN|ASM_TESTRESOLVE)&~ASM_ALTMACRO,
+            BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, errorStream, printStream);
+    assertTrue("UnresolvedSymbols", "good", !assembler.assemble());
+    assertString("UnresolvedSymbols", "errorMessages",
+            "test.s:1:15: Error: Unresolved symbol 'b'\n"
+            "test.s:7:18: Error: Unresolved symbol 'b'\n"
+            "test.s:1:18: Error: Unresolved symbol 'a'\n"
+            "test.s:3:18: Error: Unresolved symbol 'd'\n"
+            "test.s:6:13: Error: Unresolved symbol 'e'\n"
+            "test.s:7:15: Error: Unresolved symbol 'x'\n"
+            "Expression evaluation from test.s:13:15:\n"
+            "test.s:11:17: Error: Unresolved symbol 'y'\n"
+            "test.s:3:15: Error: Unresolved symbol 'sc::c'\n", errorStream.str());
+    // labels and resolved symbols are not pending
+    const AsmScope& globalScope = assembler.getGlobalScope();
+    for (const AsmSymbolEntry* symEntry: globalScope.pendingSymbols)
+        assertTrue("UnresolvedSymbols", std::string("pending.")+symEntry->first.c_str(),
+                symEntry->first != "lab" && symEntry->first != "1b");
+}
+
+/* resolved symbols are removed from pending symbols */
+static void testPendingSymbolsCompaction()
+{
+    std::ostringstream source;
+    for (cxuint i = 0; i < 1000; i++)
+        source << ".byte s" << i << "\ns" << i << " = " << (i&0xff) << "\n";
+    source << ".byte x\n";
+    std::istringstream input(source.str());
+    std::ostringstream errorStream;
+    std::ostringstream printStream;
+    Assembler assembler("test.s", input,
+            (ASM_ALL|ASM_TESTRUN|ASM_TESTRESOLVE)&~ASM_ALTMACRO,
+            BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, errorStream, printStream);
+    assertTrue("PendingSymbolsCompaction", "good", !assembler.assemble());
+    assertString("PendingSymbolsCompaction", "errorMessages",
+            "test.s:2001:7: Error: Unresolved symbol 'x'\n", errorStream.str());
+    const AsmScope& globalScope = assembler.getGlobalScope();
+    assertValue("PendingSymbolsCompaction", "pendingSymbols.size", size_t(1),
+            globalScope.pendingSymbols.size());
+    assertString("PendingSymbolsCompaction", "pendingSymbol",
+            "x", globalScope.pendingSymbols[0]->first);
+}
+
+/* replicated repetitions in data section do not create usage handler
+ * (only sections with instructions have it) */
+static void testReplicationInDataSection()
+{
+    std::istringstream input(R"ffDXD(        .rept 4
+        .byte 1, 2
+        .endr
+        .rept 2
+        .short 0x403
+        .endr)ffDXD");
+    std::ostringstream errorStream;
+    std::ostringstream printStream;
+    Assembler assembler("test.s", input,
+            (ASM_ALL|ASM_TESTRUN|ASM_TESTRESOLVE)&~ASM_ALTMACRO,
+            BinaryFormat::AMD, GPUDeviceType::CAPE_VERDE, errorStream, printStream);
+    assertTrue("ReplicationInDataSection", "good", assembler.assemble());
+    const AsmSection& section = assembler.getSections()[0];
+    const cxbyte expContent[] = { 1, 2, 1, 2, 1, 2, 1, 2, 3, 4, 3, 4 };
+    assertArray<cxbyte>("ReplicationInDataSection", "content",
+            Array<cxbyte>(expContent, expContent + sizeof(expContent)),
+            section.content.size(), section.content.data());
+    assertTrue("ReplicationInDataSection", "noUsageHandler",
+            section.usageHandler == nullptr);
+}
+
 int main(int argc, const char** argv)
 {
     int retVal = 0;
@@ -173,5 +261,8 @@ int main(int argc, const char** argv)
             std::cerr << ex.what() << std::endl;
             retVal = 1;
         }
+    retVal |= callTest(testUnresolvedSymbols);
+    retVal |= callTest(testPendingSymbolsCompaction);
+    retVal |= callTest(testReplicationInDataSection);
     return retVal;
 }
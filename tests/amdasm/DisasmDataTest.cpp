@@ -1642,7 +1642,9 @@ data2:
     }
 };
 
-static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
+// threadsNum - number of threads used to disassemble kernels (output must be same)
+static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase,
+            cxuint threadsNum)
 {
     std::ostringstream disasmOss;
     std::string resultStr;
@@ -1657,12 +1659,14 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
         if (testCase.amdInput != nullptr)
         {
             Disassembler disasm(testCase.amdInput, disasmOss, disasmFlags);
+            disasm.setThreadsNum(threadsNum);
             disasm.disassemble();
             resultStr = disasmOss.str();
         }
         else if (testCase.galliumInput != nullptr)
         {
             Disassembler disasm(testCase.galliumInput, disasmOss, disasmFlags);
+            disasm.setThreadsNum(threadsNum);
             disasm.disassemble();
             resultStr = disasmOss.str();
         }
@@ -1682,6 +1686,7 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
                     AMDBIN_CREATE_INFOSTRINGS));
             AmdMainGPUBinary32* amdGpuBin = static_cast<AmdMainGPUBinary32*>(base.get());
             Disassembler disasm(*amdGpuBin, disasmOss, disasmFlags);
+            disasm.setThreadsNum(threadsNum);
             disasm.disassemble();
             resultStr = disasmOss.str();
         }
@@ -1695,6 +1700,7 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
                 AMDBIN_CREATE_INFOSTRINGS | AMDCL2BIN_INNER_CREATE_KERNELDATA |
                 AMDCL2BIN_INNER_CREATE_KERNELDATAMAP | AMDCL2BIN_INNER_CREATE_KERNELSTUBS);
             Disassembler disasm(amdBin, disasmOss, disasmFlags);
+            disasm.setThreadsNum(threadsNum);
             disasm.disassemble();
             resultStr = disasmOss.str();
         }
@@ -1703,6 +1709,7 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
             // if ROCm (HSACO) binary
             ROCmBinary rocmBin(binaryData.size(), binaryData.data(), 0);
             Disassembler disasm(rocmBin, disasmOss, disasmFlags);
+            disasm.setThreadsNum(threadsNum);
             disasm.disassemble();
             resultStr = disasmOss.str();
         }
@@ -1711,6 +1718,7 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
             GalliumBinary galliumBin(binaryData.size(),binaryData.data(), 0);
             Disassembler disasm(GPUDeviceType::CAPE_VERDE, galliumBin,
                             disasmOss, disasmFlags, testCase.llvmVersion);
+            disasm.setThreadsNum(threadsNum);
             disasm.disassemble();
             resultStr = disasmOss.str();
         }
@@ -1721,7 +1729,7 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
     {
         // print error
         std::ostringstream oss;
-        oss << "Failed for #" << testId << std::endl;
+        oss << "Failed for #" << testId << " threads=" << threadsNum << std::endl;
         oss << resultStr << std::endl;
         oss.flush();
         throw Exception(oss.str());
@@ -1731,13 +1739,14 @@ static void testDisasmData(cxuint testId, const DisasmAmdTestCase& testCase)
 int main(int argc, const char** argv)
 {
     int retVal = 0;
-    for (cxuint i = 0; i < sizeof(disasmDataTestCases)/sizeof(DisasmAmdTestCase); i++)
-        try
-        { testDisasmData(i, disasmDataTestCases[i]); }
-        catch(const std::exception& ex)
-        {
-            std::cerr << ex.what() << std::endl;
-            retVal = 1;
-        }
+    for (cxuint threadsNum: { 1, 4 })
+        for (cxuint i = 0; i < sizeof(disasmDataTestCases)/sizeof(DisasmAmdTestCase); i++)
+            try
+            { testDisasmData(i, disasmDataTestCases[i], threadsNum); }
+            catch(const std::exception& ex)
+            {
+                std::cerr << ex.what() << std::endl;
+                retVal = 1;
+            }
     return retVal;
 }
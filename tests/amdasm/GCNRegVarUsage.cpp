@@ -1719,6 +1719,32 @@ static const GCNRegVarUsageCase gcnRvuTestCases1Tbl[] =
             { 72, nullptr, 256+10, 256+11, GCNFIELD_VOP_VSRC1, ASMRVU_READ, 0 }
         },
         true, ""
+    },
+    {   /* 28: replicated repetitions */
+        ".regvar rax:s, rbx:s:2\n"
+        ".rept 3\n"
+        "s_mov_b32 rax, rbx[1]\n"
+        ".endr\n"
+        ".for x = 0, x < 2, x+1\n"
+        "s_add_u32 rax, rax, s7\n"
+        ".endr\n",
+        {
+            // s_mov_b32 rax, rbx[1] (3 times)
+            { 0, "rax", 0, 1, GCNFIELD_SDST, ASMRVU_WRITE, 1 },
+            { 0, "rbx", 1, 2, GCNFIELD_SSRC0, ASMRVU_READ, 1 },
+            { 4, "rax", 0, 1, GCNFIELD_SDST, ASMRVU_WRITE, 1 },
+            { 4, "rbx", 1, 2, GCNFIELD_SSRC0, ASMRVU_READ, 1 },
+            { 8, "rax", 0, 1, GCNFIELD_SDST, ASMRVU_WRITE, 1 },
+            { 8, "rbx", 1, 2, GCNFIELD_SSRC0, ASMRVU_READ, 1 },
+            // s_add_u32 rax, rax, s7 (2 times)
+            { 12, "rax", 0, 1, GCNFIELD_SDST, ASMRVU_WRITE, 1 },
+            { 12, "rax", 0, 1, GCNFIELD_SSRC0, ASMRVU_READ, 1 },
+            { 12, nullptr, 7, 8, GCNFIELD_SSRC1, ASMRVU_READ, 0 },
+            { 16, "rax", 0, 1, GCNFIELD_SDST, ASMRVU_WRITE, 1 },
+            { 16, "rax", 0, 1, GCNFIELD_SSRC0, ASMRVU_READ, 1 },
+            { 16, nullptr, 7, 8, GCNFIELD_SSRC1, ASMRVU_READ, 0 }
+        },
+        true, ""
     }
 };
 
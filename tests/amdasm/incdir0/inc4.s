@@ -0,0 +1,14 @@
+            .byte 1, 2 # comment
+	.byte 3 ; .byte 4
+/* long
+   comment */ .byte 5
+            .byte 6, \
+              7
+            .ascii "a;#"
+            .byte 8/*c*/+1
+            .byte 10
+            .byte 11
+            .byte 12 # comment \
+  continued
+            .byte 13, 14x
+            .byte 15
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include <sstream>
 #include <map>
 #include <memory>
+#include <algorithm>
 #include <CLRX/utils/Containers.h>
 #include <CLRX/amdbin/AmdBinaries.h>
 #include <CLRX/amdbin/AmdBinGen.h>
@@ -674,6 +675,33 @@ static void testOrigBinary(cxuint testCase, const char* origBinaryFilename, bool
                     ": byte=" << i;
             throw Exception(oss.str());
         }
+    
+    // binary generated to stream must be same as binary generated to memory
+    std::ostringstream binOss;
+    binGen.generate(binOss);
+    const std::string streamOutput = binOss.str();
+    if (streamOutput.size() != output.size() ||
+        !std::equal(output.begin(), output.end(),
+                    reinterpret_cast<const cxbyte*>(streamOutput.data())))
+    {
+        std::ostringstream oss;
+        oss << "Failed for #" << testCase << " file=" << origBinaryFilename <<
+                ": stream output differs";
+        throw Exception(oss.str());
+    }
+    
+    // binary generated in parallel mode must be same as serially generated binary
+    Array<cxbyte> parOutput;
+    binGen.setThreadsNum(4);
+    binGen.generate(parOutput);
+    if (parOutput.size() != output.size() ||
+        !std::equal(output.begin(), output.end(), parOutput.begin()))
+    {
+        std::ostringstream oss;
+        oss << "Failed for #" << testCase << " file=" << origBinaryFilename <<
+                ": parallel output differs";
+        throw Exception(oss.str());
+    }
 }
 
 int main(int argc, const char** argv)
@@ -0,0 +1,225 @@
+/*
+ *  CLRadeonExtender - Unofficial OpenCL Radeon Extensions Library
+ *  Copyright (C) 2014-2018 Mateusz Szpakowski
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <CLRX/Config.h>
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <CLRX/utils/Utilities.h>
+#include <CLRX/utils/Containers.h>
+#include <CLRX/amdbin/ElfBinaries.h>
+#include <CLRX/amdbin/GalliumBinaries.h>
+#include "../TestUtils.h"
+
+using namespace CLRX;
+
+/* micro-benchmark: counts heap allocations done while strings from test corpus
+ * (symbol and section names from binaries) are copied and put to containers */
+
+static size_t allocationsCount = 0;
+
+void* operator new(size_t size)
+{
+    allocationsCount++;
+    void* ptr = ::malloc(size!=0 ? size : 1);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{ ::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept
+{ ::free(ptr); }
+
+// old CString allocation scheme (always allocate for every non-empty copy)
+class PlainCString
+{
+private:
+    char* ptr;
+public:
+    PlainCString(const char* str) : ptr(nullptr)
+    {
+        const size_t n = ::strlen(str);
+        if (n == 0)
+            return;
+        ptr = new char[n+1];
+        ::memcpy(ptr, str, n+1);
+    }
+    PlainCString(const PlainCString& s) : PlainCString(s.c_str())
+    { }
+    PlainCString(PlainCString&& s) noexcept : ptr(s.ptr)
+    { s.ptr = nullptr; }
+    ~PlainCString()
+    { delete[] ptr; }
+    PlainCString& operator=(const PlainCString& s)
+    {
+        PlainCString t(s);
+        std::swap(ptr, t.ptr);
+        return *this;
+    }
+    PlainCString& operator=(PlainCString&& s) noexcept
+    {
+        std::swap(ptr, s.ptr);
+        return *this;
+    }
+    const char* c_str() const
+    { return ptr!=nullptr ? ptr : ""; }
+    bool operator==(const PlainCString& s) const
+    { return ::strcmp(c_str(), s.c_str())==0; }
+    bool operator<(const PlainCString& s) const
+    { return ::strcmp(c_str(), s.c_str())<0; }
+};
+
+// this same hash for both strings
+template<typename S>
+struct NameHash
+{
+    size_t operator()(const S& s) const
+    {
+        size_t hash = 0;
+        for (const char* p = s.c_str(); *p != 0; p++)
+            hash = ((hash<<8)^(cxbyte)*p)*size_t(0xbf146a3dU);
+        return hash;
+    }
+};
+
+static const char* corpusFiles[] =
+{
+    "amd1.clo", "amdcl2.clo", "gallium1.clo", "new-gallium-llvm40.clo",
+    "rocm-fiji.hsaco", "samplekernels.clo", "samplekernels_64.clo"
+};
+
+template<typename ElfBinary>
+static void getElfNames(const ElfBinary& elf, std::vector<std::string>& names)
+{
+    for (size_t i = 0; i < elf.getSectionHeadersNum(); i++)
+        names.push_back(elf.getSectionName(i));
+    for (size_t i = 0; i < elf.getSymbolsNum(); i++)
+        names.push_back(elf.getSymbolName(i));
+    for (size_t i = 0; i < elf.getDynSymbolsNum(); i++)
+        names.push_back(elf.getDynSymbolName(i));
+}
+
+// workload: construct strings, copy to vector, sort, copy to map and copy containers
+template<typename S>
+static size_t countStringAllocations(const std::vector<std::string>& names)
+{
+    const size_t startCount = allocationsCount;
+    {
+        std::vector<S> strings;
+        strings.reserve(names.size());
+        for (const std::string& name: names)
+            strings.push_back(S(name.c_str()));
+        std::vector<S> sorted(strings);
+        std::sort(sorted.begin(), sorted.end());
+        std::unordered_map<S, size_t, NameHash<S> > nameMap;
+        for (const S& s: strings)
+            nameMap.insert(std::make_pair(s, size_t(0))).first->second++;
+        std::unordered_map<S, size_t, NameHash<S> > nameMap2(nameMap);
+        std::vector<std::pair<S, size_t> > entries(nameMap2.begin(), nameMap2.end());
+    }
+    return allocationsCount - startCount;
+}
+
+static void testCStringAllocations()
+{
+    std::vector<std::string> names;
+    for (const char* file: corpusFiles)
+    {
+        Array<cxbyte> data = loadDataFromFile((std::string(CLRX_SOURCE_DIR
+                    "/tests/amdasm/amdbins/") + file).c_str());
+        if (data.size() < 4 || ::memcmp(data.data(), "\x7f""ELF", 4) != 0)
+        {
+            // Gallium binary (names of kernels and names from inner ELF binary)
+            GalliumBinary binary(data.size(), data.data(), 0);
+            for (uint32_t i = 0; i < binary.getKernelsNum(); i++)
+                names.push_back(binary.getKernel(i).kernelName.c_str());
+            if (binary.is64BitElfBinary())
+                getElfNames(binary.getElfBinary64(), names);
+            else
+                getElfNames(binary.getElfBinary32(), names);
+        }
+        else if (data[4] == 2) // ELFCLASS64
+            getElfNames(ElfBinary64(data.size(), data.data(), 0), names);
+        else
+            getElfNames(ElfBinary32(data.size(), data.data(), 0), names);
+    }
+    size_t shortNames = 0;
+    for (const std::string& name: names)
+        if (name.size() <= 22)
+            shortNames++;
+
+    const size_t plainAllocs = countStringAllocations<PlainCString>(names);
+    const size_t allocs = countStringAllocations<CString>(names);
+    std::cout << "Names: " << names.size() << " (short: " << shortNames << ")\n"
+            "Allocations (plain strings): " << plainAllocs << "\n"
+            "Allocations (CString): " << allocs << std::endl;
+    assertTrue("CStringAllocs", "allocs", allocs < plainAllocs);
+}
+
+// pointers to characters of non-const string must not change copies of string
+static void testCStringCopyOnWrite()
+{
+    const char* longStr = "abcdefghijklmnopqrstuvwxyz0123456789";
+    CString a(longStr);
+    CString b(a);
+    b[0] = 'X';
+    assertString("CStringCOW", "modifyCopy.a", longStr, a.c_str());
+    assertString("CStringCOW", "modifyCopy.b", "Xbcdefghijklmnopqrstuvwxyz0123456789",
+                 b.c_str());
+    
+    // copy after getting pointer to characters
+    char* chars = a.begin();
+    CString c(a);
+    CString d;
+    d = a;
+    chars[1] = 'Y';
+    assertString("CStringCOW", "pointer.a", "aYcdefghijklmnopqrstuvwxyz0123456789",
+                 a.c_str());
+    assertString("CStringCOW", "pointer.c", longStr, c.c_str());
+    assertString("CStringCOW", "pointer.d", longStr, d.c_str());
+    // copies still share buffer and they are copied before modification
+    CString e(c);
+    c.front() = 'Z';
+    assertString("CStringCOW", "copies.c", "Zbcdefghijklmnopqrstuvwxyz0123456789",
+                 c.c_str());
+    assertString("CStringCOW", "copies.e", longStr, e.c_str());
+    
+    // short strings
+    CString f("short");
+    char* fchars = f.begin();
+    CString g(f);
+    fchars[0] = 'S';
+    assertString("CStringCOW", "short.f", "Short", f.c_str());
+    assertString("CStringCOW", "short.g", "short", g.c_str());
+}
+
+int main(int argc, const char** argv)
+{
+    int retVal = 0;
+    retVal |= callTest(testCStringAllocations);
+    retVal |= callTest(testCStringCopyOnWrite);
+    return retVal;
+}
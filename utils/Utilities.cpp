@@ -25,16 +25,27 @@
 #include <direct.h>
 #include <windows.h>
 #include <shlobj.h>
+#include <sys/utime.h>
 #else
 #include <pwd.h>
 #include <unistd.h>
+#include <dirent.h>
+#include <utime.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
 #endif
+#if defined(HAVE_LINUX) || defined(HAVE_BSD)
+#include <sys/mman.h>
+#endif
 #include <fstream>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include <system_error>
 #include <cerrno>
 #include <cstring>
 #include <string>
@@ -463,6 +474,130 @@ Array<cxbyte> CLRX::loadDataFromFile(const char* filename)
     return buf;
 }
 
+/*
+ * MemoryMappedFile
+ */
+
+MemoryMappedFile::MemoryMappedFile() : data(nullptr), size(0), mapped(false)
+#ifdef HAVE_WINDOWS
+        , fileHandle(nullptr), mapHandle(nullptr)
+#endif
+{ }
+
+MemoryMappedFile::MemoryMappedFile(const char* filename)
+        : data(nullptr), size(0), mapped(false)
+#ifdef HAVE_WINDOWS
+        , fileHandle(nullptr), mapHandle(nullptr)
+#endif
+{
+    map(filename);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    unmap();
+}
+
+void MemoryMappedFile::map(const char* filename)
+{
+    if (mapped)
+        throw Exception("MemoryMappedFile already mapped");
+#if defined(HAVE_LINUX) || defined(HAVE_BSD)
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+        throw Exception("Can't open file");
+    struct stat stBuf;
+    if (::fstat(fd, &stBuf) != 0 || !S_ISREG(stBuf.st_mode))
+    {
+        ::close(fd);
+        throw Exception("This is not regular file");
+    }
+    if (uint64_t(stBuf.st_size) > SIZE_MAX)
+    {
+        ::close(fd);
+        throw Exception("File is too big to map");
+    }
+    size = stBuf.st_size;
+    if (size != 0)
+    {
+        void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED)
+        {
+            ::close(fd);
+            size = 0;
+            throw Exception("Can't map file");
+        }
+        // data will be read sequentially
+        ::madvise(ptr, size, MADV_SEQUENTIAL);
+        data = (const cxbyte*)ptr;
+    }
+    // mapping holds reference to file
+    ::close(fd);
+    mapped = true;
+#elif defined(HAVE_WINDOWS)
+    HANDLE hFile = CreateFile(filename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+        throw Exception("Can't open file");
+    LARGE_INTEGER fileSize;
+    if (GetFileType(hFile) != FILE_TYPE_DISK || !GetFileSizeEx(hFile, &fileSize))
+    {
+        CloseHandle(hFile);
+        throw Exception("This is not regular file");
+    }
+    if (uint64_t(fileSize.QuadPart) > SIZE_MAX)
+    {
+        CloseHandle(hFile);
+        throw Exception("File is too big to map");
+    }
+    size = fileSize.QuadPart;
+    if (size != 0)
+    {
+        HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (hMap == nullptr)
+        {
+            CloseHandle(hFile);
+            size = 0;
+            throw Exception("Can't map file");
+        }
+        void* ptr = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+        if (ptr == nullptr)
+        {
+            CloseHandle(hMap);
+            CloseHandle(hFile);
+            size = 0;
+            throw Exception("Can't map file");
+        }
+        data = (const cxbyte*)ptr;
+        mapHandle = (void*)hMap;
+    }
+    fileHandle = (void*)hFile;
+    mapped = true;
+#else
+    throw Exception("Unsupported function");
+#endif
+}
+
+void MemoryMappedFile::unmap()
+{
+    if (!mapped)
+        return;
+#if defined(HAVE_LINUX) || defined(HAVE_BSD)
+    if (data != nullptr)
+        ::munmap((void*)data, size);
+#elif defined(HAVE_WINDOWS)
+    if (data != nullptr)
+        UnmapViewOfFile((LPCVOID)data);
+    if (mapHandle != nullptr)
+        CloseHandle((HANDLE)mapHandle);
+    CloseHandle((HANDLE)fileHandle);
+    mapHandle = fileHandle = nullptr;
+#endif
+    data = nullptr;
+    size = 0;
+    mapped = false;
+}
+
 void CLRX::filesystemPath(char* path)
 {
     while (*path != 0)  // change to native dir separator
@@ -517,6 +652,70 @@ uint64_t CLRX::getFileTimestamp(const char* filename)
 #endif
 }
 
+uint64_t CLRX::getFileSize(const char* filename)
+{
+    struct stat stBuf;
+    errno = 0;
+    if (::stat(filename, &stBuf) != 0)
+    {
+        if (errno == ENOENT)
+            throw Exception("File or directory doesn't exists");
+        else if (errno == EACCES)
+            throw Exception("Access to file or directory is not permitted");
+        else
+            throw Exception("Can't determine size of file");
+    }
+    return stBuf.st_size;
+}
+
+void CLRX::touchFile(const char* filename)
+{
+#ifdef HAVE_WINDOWS
+    if (::_utime(filename, nullptr) != 0)
+#else
+    if (::utime(filename, nullptr) != 0)
+#endif
+        throw Exception("Can't set modification time of file");
+}
+
+std::vector<std::string> CLRX::listDirectory(const char* dirname)
+{
+    std::vector<std::string> entries;
+#ifdef HAVE_WINDOWS
+    WIN32_FIND_DATA findData;
+    HANDLE findHandle = FindFirstFile((std::string(dirname)+"\\*").c_str(), &findData);
+    if (findHandle == INVALID_HANDLE_VALUE)
+    {
+        if (GetLastError() == ERROR_FILE_NOT_FOUND)
+            return entries; // no entries
+        throw Exception("Can't open directory");
+    }
+    do {
+        if (::strcmp(findData.cFileName, ".")!=0 && ::strcmp(findData.cFileName, "..")!=0)
+            entries.push_back(findData.cFileName);
+    } while (FindNextFile(findHandle, &findData));
+    FindClose(findHandle);
+#else
+    DIR* dir = ::opendir(dirname);
+    if (dir == nullptr)
+        throw Exception("Can't open directory");
+    try
+    {
+        struct dirent* entry;
+        while ((entry = ::readdir(dir)) != nullptr)
+            if (::strcmp(entry->d_name, ".")!=0 && ::strcmp(entry->d_name, "..")!=0)
+                entries.push_back(entry->d_name);
+    }
+    catch(...)
+    {
+        ::closedir(dir);
+        throw;
+    }
+    ::closedir(dir);
+#endif
+    return entries;
+}
+
 std::string CLRX::getHomeDir()
 {
 #ifndef HAVE_WINDOWS
@@ -804,3 +1003,59 @@ std::string CLRX::findLLVMConfig()
     }
     return "";
 }
+
+cxuint CLRX::getHardwareThreadsNum()
+{
+    const cxuint threadsNum = std::thread::hardware_concurrency();
+    return (threadsNum != 0) ? threadsNum : 1;
+}
+
+void CLRX::parallelFor(size_t n, cxuint threadsNum,
+            const std::function<void(size_t)>& func)
+{
+    if (threadsNum == 0)
+        threadsNum = getHardwareThreadsNum();
+    if (threadsNum <= 1 || n <= 1)
+    {
+        // serial mode
+        for (size_t i = 0; i < n; i++)
+            func(i);
+        return;
+    }
+    
+    std::atomic<size_t> nextIndex(0);
+    // index of first failed item (items after it are skipped)
+    std::atomic<size_t> failedIndex(SIZE_MAX);
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+    auto worker = [&]()
+    {
+        size_t i;
+        while ((i = nextIndex.fetch_add(1)) < n && i < failedIndex.load())
+            try
+            { func(i); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (i < failedIndex.load())
+                {
+                    failedIndex.store(i);
+                    exception = std::current_exception();
+                }
+            }
+    };
+    
+    std::vector<std::thread> threads;
+    const size_t workersNum = std::min(size_t(threadsNum), n) - 1;
+    for (size_t t = 0; t < workersNum; t++)
+        try
+        { threads.push_back(std::thread(worker)); }
+        catch(const std::system_error&)
+        { break; } // can not create thread, hence use fewer threads
+    // current thread is also worker
+    worker();
+    for (std::thread& thread: threads)
+        thread.join();
+    if (exception)
+        std::rethrow_exception(exception);
+}